@@ -27,6 +27,19 @@
 
 #define SMOOTH_FONT
 
-#define SPI_FREQUENCY 27000000
+// The write clock is a variable, raised at boot by the clock tuner
+// (src/Display/SpiClock.h) from the safe default below
+#define SPI_CLOCK_DEFAULT_HZ 27000000
+#ifdef __cplusplus
+extern "C" unsigned long g_spiFrequency;
+#else
+extern unsigned long g_spiFrequency;
+#endif
+#define SPI_FREQUENCY g_spiFrequency
+
+// Reads (tuner readback) go over the bidirectional SDA line, the Box-3 has
+// no MISO, at a clock the panel's read timing allows
+#define TFT_SDA_READ
+#define SPI_READ_FREQUENCY 16000000
 
 #define TOUCH_CS -1
\ No newline at end of file
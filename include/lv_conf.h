@@ -6,25 +6,23 @@
 #define LV_COLOR_DEPTH 16
 #define LV_COLOR_16_SWAP 1
 
+/* Monotonic tick from esp_timer: time spent rendering, flushing or blocked in
+ * BLE connects is accounted for, unlike a fixed lv_tick_inc() per loop. */
+#define LV_TICK_CUSTOM 1
+#define LV_TICK_CUSTOM_INCLUDE "esp_timer.h"
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR ((uint32_t)(esp_timer_get_time() / 1000))
+
+/* The sizes the SquareLine screens use, and DICT_FONT_SIZES
+ * (src/DictionaryView.h) so the pinch zoom keeps all its steps when the
+ * asset pack has no dict_<size> fonts (assets/fonts.txt). Other sizes, and
+ * glyphs beyond Latin (IPA, CJK), come from the asset pack at run time
+ * (src/Assets/AssetFont.h). */
 #define LV_FONT_MONTSERRAT_12	1
 #define LV_FONT_MONTSERRAT_14	1
 #define LV_FONT_MONTSERRAT_16	1
 #define LV_FONT_MONTSERRAT_18	1
 #define LV_FONT_MONTSERRAT_20	1
-#define LV_FONT_MONTSERRAT_22	1
 #define LV_FONT_MONTSERRAT_24	1
-#define LV_FONT_MONTSERRAT_26	1
-#define LV_FONT_MONTSERRAT_28	1
-#define LV_FONT_MONTSERRAT_30	1
-#define LV_FONT_MONTSERRAT_32	1
-#define LV_FONT_MONTSERRAT_34	1
-#define LV_FONT_MONTSERRAT_36	1
-#define LV_FONT_MONTSERRAT_38	1
-#define LV_FONT_MONTSERRAT_40	1
-#define LV_FONT_MONTSERRAT_42	1
-#define LV_FONT_MONTSERRAT_44	1
-#define LV_FONT_MONTSERRAT_46	1
-#define LV_FONT_MONTSERRAT_48	1
 
 #define LV_FONT_DEFAULT        &lv_font_montserrat_14
 
@@ -0,0 +1,70 @@
+// Host stand-in for the small part of the Arduino core used by the portable
+// sources (native environment only).
+#pragma once
+
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define RISING 0x01
+#define FALLING 0x02
+
+// Added to the host clock: tests step through timeouts with hostAdvanceMs()
+// instead of sleeping
+inline std::atomic<uint64_t> &hostClockOffsetUs() {
+  static std::atomic<uint64_t> offset{0};
+  return offset;
+}
+inline void hostAdvanceMs(uint32_t ms) {
+  hostClockOffsetUs() += (uint64_t)ms * 1000;
+}
+
+inline uint64_t hostMicros64() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start)
+             .count() +
+         hostClockOffsetUs();
+}
+
+inline unsigned long micros() { return (unsigned long)hostMicros64(); }
+inline unsigned long millis() { return (unsigned long)(hostMicros64() / 1000); }
+inline void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+inline void delayMicroseconds(uint32_t us) {
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return LOW; }
+
+class HostSerial {
+public:
+  void begin(unsigned long) {}
+  size_t print(const char *s) { return fputs(s, stdout) >= 0 ? strlen(s) : 0; }
+  size_t println(const char *s = "") { return print(s) + print("\n"); }
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3))) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vprintf(fmt, ap);
+    va_end(ap);
+    return n < 0 ? 0 : (size_t)n;
+  }
+  void flush() { fflush(stdout); }
+};
+
+inline HostSerial Serial;
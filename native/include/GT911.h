@@ -0,0 +1,37 @@
+// Host stand-in for the GT911 touch driver (native environment only).
+// Reports no touches unless a test harness injects points.
+#pragma once
+
+#include <Arduino.h>
+
+#define GT911_MODE_INTERRUPT 0
+#define GT911_MODE_POLLING 1
+#define GT911_MAX_CONTACTS 5
+
+struct GTPoint {
+  uint8_t trackId;
+  uint16_t x;
+  uint16_t y;
+  uint16_t area;
+  uint8_t reserved;
+};
+
+class GT911 {
+public:
+  bool begin(int8_t = -1, int8_t = -1, uint8_t = 0x5D, uint32_t = 400000) {
+    return true;
+  }
+  uint8_t touched(uint8_t = GT911_MODE_POLLING) { return m_count; }
+  GTPoint *getPoints() { return m_points; }
+  GTPoint getPoint(uint8_t n) { return m_points[n]; }
+
+  /** Host only: set the contacts returned by the next touched() calls. */
+  void inject(const GTPoint *points, uint8_t count) {
+    m_count = count > GT911_MAX_CONTACTS ? GT911_MAX_CONTACTS : count;
+    memcpy(m_points, points, m_count * sizeof(GTPoint));
+  }
+
+private:
+  GTPoint m_points[GT911_MAX_CONTACTS] = {};
+  uint8_t m_count = 0;
+};
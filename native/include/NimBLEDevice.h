@@ -0,0 +1,428 @@
+// Host stand-in for the NimBLE-Arduino API surface used by src/BLE (native
+// environment only). There is no radio: scans find nothing and, by default,
+// connects fail, so BleKeyboardHost stays idle while its key path can still
+// be driven by calling parseHIDReport() directly.
+//
+// For the reconnect path a single fake bonded peer can be put in range with
+// NativeBle::peer(): directed connects to its address then succeed, CCCD
+// writes and connection parameter updates are recorded, and
+// NativeBle::notify() delivers a notification through the registered GAP
+// event listeners like the NimBLE host would. Its failures (keys lost on
+// the peer's side, rejected CCCD writes) can be switched on, and scan
+// starts are counted (test/test_ble_reconnect, test/test_conn_param_policy).
+#pragma once
+
+#include <Arduino.h>
+
+#include <string>
+#include <vector>
+
+#ifndef NIMBLE_MAX_CONNECTIONS
+#define NIMBLE_MAX_CONNECTIONS 3
+#endif
+
+#define BLE_HS_CONN_HANDLE_NONE 0xffff
+#define BLE_HS_EALREADY 2
+#define BLE_HS_ENOTCONN 7
+#define BLE_HS_EAPP 9
+#define BLE_GAP_EVENT_CONNECT 0
+#define BLE_GAP_EVENT_DISCONNECT 1
+#define BLE_GAP_EVENT_CONN_UPDATE 3
+#define BLE_GAP_EVENT_NOTIFY_RX 12
+
+class NimBLEClient;
+class NimBLERemoteService;
+
+// --- Minimal NimBLE host C API -----------------------------------------------
+
+struct os_mbuf {
+  const uint8_t *om_data;
+  uint16_t om_len;
+};
+#define OS_MBUF_PKTLEN(om) ((om)->om_len)
+
+inline int os_mbuf_copydata(const struct os_mbuf *om, int off, int len,
+                            void *dst) {
+  if (off < 0 || len < 0 || off + len > om->om_len)
+    return -1;
+  memcpy(dst, om->om_data + off, len);
+  return 0;
+}
+
+struct ble_gap_event {
+  uint8_t type;
+  union {
+    struct {
+      struct os_mbuf *om;
+      uint16_t attr_handle;
+      uint16_t conn_handle;
+      uint8_t indication : 1;
+    } notify_rx;
+    struct {
+      int status;
+      uint16_t conn_handle;
+    } conn_update;
+  };
+};
+
+typedef int ble_gap_event_fn(struct ble_gap_event *event, void *arg);
+typedef int ble_gatt_attr_fn(uint16_t, const void *, void *, void *);
+
+struct ble_gap_event_listener {
+  ble_gap_event_fn *fn;
+  void *arg;
+  ble_gap_event_listener *next;
+};
+
+// --- Fake peer ----------------------------------------------------------------
+
+struct NativeBle {
+  struct Peer {
+    uint8_t address[6];
+    uint8_t addressType;
+    bool inRange;
+    bool bonded;
+    bool lostKeys; // encryption fails although we still hold the bond
+    bool failCccd; // CCCD writes are rejected
+    uint16_t connHandle;
+    bool connected;
+    uint16_t cccdWrites; // number of CCCD writes seen
+    uint16_t connUpdates; // connection parameter update requests
+    uint16_t latency;     // slave latency as last requested
+  };
+
+  struct Scan {
+    uint16_t starts;
+    uint16_t interval; // as last set, in ms
+  };
+
+  static Peer &peer() {
+    static Peer p = {{0}, 0, false, false, false, false, 1, false, 0};
+    return p;
+  }
+
+  static Scan &scan() {
+    static Scan s = {0, 0};
+    return s;
+  }
+
+  static ble_gap_event_listener *&listeners() {
+    static ble_gap_event_listener *head = nullptr;
+    return head;
+  }
+
+  /** Deliver a notification from the connected fake peer. */
+  static void notify(uint16_t attrHandle, const uint8_t *data, uint16_t len,
+                     bool indication = false) {
+    os_mbuf om = {data, len};
+    ble_gap_event event;
+    event.type = BLE_GAP_EVENT_NOTIFY_RX;
+    event.notify_rx.om = &om;
+    event.notify_rx.attr_handle = attrHandle;
+    event.notify_rx.conn_handle = peer().connHandle;
+    event.notify_rx.indication = indication;
+    for (auto *l = listeners(); l; l = l->next)
+      l->fn(&event, l->arg);
+  }
+};
+
+inline int ble_gap_event_listener_register(ble_gap_event_listener *listener,
+                                           ble_gap_event_fn *fn, void *arg) {
+  for (auto *l = NativeBle::listeners(); l; l = l->next) {
+    if (l == listener)
+      return BLE_HS_EALREADY;
+  }
+  listener->fn = fn;
+  listener->arg = arg;
+  listener->next = NativeBle::listeners();
+  NativeBle::listeners() = listener;
+  return 0;
+}
+
+inline int ble_gattc_write_flat(uint16_t connHandle, uint16_t, const void *,
+                                uint16_t, ble_gatt_attr_fn *, void *) {
+  NativeBle::Peer &p = NativeBle::peer();
+  if (!p.connected || connHandle != p.connHandle)
+    return BLE_HS_ENOTCONN;
+  if (p.failCccd)
+    return BLE_HS_EAPP;
+  p.cccdWrites++;
+  return 0;
+}
+
+class NimBLEUUID {
+public:
+  NimBLEUUID() : m_uuid(0) {}
+  explicit NimBLEUUID(uint16_t uuid) : m_uuid(uuid) {}
+  bool operator==(const NimBLEUUID &o) const { return m_uuid == o.m_uuid; }
+  std::string toString() const {
+    char buf[8];
+    snprintf(buf, sizeof(buf), "0x%04x", m_uuid);
+    return buf;
+  }
+
+private:
+  uint16_t m_uuid;
+};
+
+class NimBLEAddress {
+public:
+  NimBLEAddress() : m_type(0) { memset(m_val, 0, sizeof(m_val)); }
+  NimBLEAddress(const uint8_t *val, uint8_t type) : m_type(type) {
+    memcpy(m_val, val, sizeof(m_val));
+  }
+  const uint8_t *getVal() const { return m_val; }
+  uint8_t getType() const { return m_type; }
+  bool isNull() const {
+    static const uint8_t zero[6] = {};
+    return memcmp(m_val, zero, sizeof(m_val)) == 0;
+  }
+  bool operator==(const NimBLEAddress &o) const {
+    return m_type == o.m_type && memcmp(m_val, o.m_val, sizeof(m_val)) == 0;
+  }
+  std::string toString() const {
+    char buf[18];
+    snprintf(buf, sizeof(buf), "%02x:%02x:%02x:%02x:%02x:%02x", m_val[5],
+             m_val[4], m_val[3], m_val[2], m_val[1], m_val[0]);
+    return buf;
+  }
+
+private:
+  uint8_t m_val[6];
+  uint8_t m_type;
+};
+
+class NimBLEConnInfo {
+public:
+  uint16_t getConnHandle() const { return 0; }
+  NimBLEAddress getAddress() const { return NimBLEAddress(); }
+  bool isEncrypted() const { return true; }
+  bool isBonded() const { return true; }
+  uint16_t getConnInterval() const { return 12; }
+  uint16_t getConnLatency() const { return 0; }
+  uint16_t getConnTimeout() const { return 150; }
+};
+
+class NimBLEAttValue {
+public:
+  NimBLEAttValue() {}
+  NimBLEAttValue(const uint8_t *data, size_t len) : m_data(data, data + len) {}
+  const uint8_t *data() const { return m_data.data(); }
+  size_t size() const { return m_data.size(); }
+  size_t length() const { return m_data.size(); }
+
+private:
+  std::vector<uint8_t> m_data;
+};
+
+class NimBLERemoteDescriptor {
+public:
+  uint16_t getHandle() const { return 0; }
+  NimBLEUUID getUUID() const { return NimBLEUUID(); }
+  NimBLEAttValue readValue() { return NimBLEAttValue(); }
+  bool writeValue(const uint8_t *, size_t, bool = false) { return false; }
+};
+
+class NimBLERemoteCharacteristic {
+public:
+  typedef void (*notify_callback)(NimBLERemoteCharacteristic *, uint8_t *,
+                                  size_t, bool);
+
+  uint16_t getHandle() const { return 0; }
+  NimBLEUUID getUUID() const { return NimBLEUUID(); }
+  bool canNotify() const { return false; }
+  bool canIndicate() const { return false; }
+  bool canRead() const { return false; }
+  bool subscribe(bool = true, notify_callback = nullptr, bool = true) {
+    return false;
+  }
+  NimBLEAttValue readValue() { return NimBLEAttValue(); }
+  NimBLERemoteDescriptor *getDescriptor(const NimBLEUUID &) { return nullptr; }
+  const std::vector<NimBLERemoteDescriptor *> &
+  getDescriptors(bool = false) const {
+    return m_descriptors;
+  }
+  NimBLEClient *getClient() const { return nullptr; }
+  NimBLERemoteService *getRemoteService() const { return nullptr; }
+
+private:
+  std::vector<NimBLERemoteDescriptor *> m_descriptors;
+};
+
+class NimBLERemoteService {
+public:
+  NimBLEUUID getUUID() const { return NimBLEUUID(); }
+  NimBLERemoteCharacteristic *getCharacteristic(const NimBLEUUID &) {
+    return nullptr;
+  }
+  const std::vector<NimBLERemoteCharacteristic *> &
+  getCharacteristics(bool = false) const {
+    return m_characteristics;
+  }
+
+private:
+  std::vector<NimBLERemoteCharacteristic *> m_characteristics;
+};
+
+class NimBLEAdvertisedDevice {
+public:
+  NimBLEAddress getAddress() const { return NimBLEAddress(); }
+  bool isAdvertisingService(const NimBLEUUID &) const { return false; }
+  bool haveAppearance() const { return false; }
+  uint16_t getAppearance() const { return 0; }
+  int getRSSI() const { return 0; }
+  std::string toString() const { return "host"; }
+};
+
+class NimBLEClientCallbacks {
+public:
+  virtual ~NimBLEClientCallbacks() {}
+  virtual void onConnect(NimBLEClient *) {}
+  virtual void onConnectFail(NimBLEClient *, int) {}
+  virtual void onDisconnect(NimBLEClient *, int) {}
+  virtual void onPassKeyEntry(NimBLEConnInfo &) {}
+  virtual void onAuthenticationComplete(NimBLEConnInfo &) {}
+  virtual void onConfirmPasskey(NimBLEConnInfo &, uint32_t) {}
+};
+
+class NimBLEClient {
+public:
+  void setClientCallbacks(NimBLEClientCallbacks *cb, bool = true) {
+    m_callbacks = cb;
+  }
+  void setConnectionParams(uint16_t, uint16_t, uint16_t, uint16_t,
+                           uint16_t = 16, uint16_t = 16) {}
+  bool updateConnParams(uint16_t, uint16_t, uint16_t latency, uint16_t) {
+    if (!isConnected())
+      return false;
+    NativeBle::peer().connUpdates++;
+    NativeBle::peer().latency = latency;
+    return true;
+  }
+  void setConnectTimeout(uint32_t) {}
+  bool connect(const NimBLEAdvertisedDevice *, bool = true, bool = false,
+               bool = true) {
+    return false;
+  }
+  bool connect(const NimBLEAddress &address, bool = true, bool = false,
+               bool = true) {
+    NativeBle::Peer &p = NativeBle::peer();
+    if (!p.inRange || !(address == NimBLEAddress(p.address, p.addressType)))
+      return false;
+    p.connected = true;
+    m_peer = address;
+    if (m_callbacks)
+      m_callbacks->onConnect(this);
+    return true;
+  }
+  bool disconnect(uint8_t = 0) {
+    if (!isConnected())
+      return true;
+    NativeBle::peer().connected = false;
+    if (m_callbacks)
+      m_callbacks->onDisconnect(this, 0x13);
+    return true;
+  }
+  bool isConnected() const {
+    NativeBle::Peer &p = NativeBle::peer();
+    return p.connected && m_peer == NimBLEAddress(p.address, p.addressType);
+  }
+  bool secureConnection(bool = false) const {
+    NativeBle::Peer &p = NativeBle::peer();
+    return isConnected() && p.bonded && !p.lostKeys;
+  }
+  NimBLEAddress getPeerAddress() const { return m_peer; }
+  NimBLEConnInfo getConnInfo() const { return NimBLEConnInfo(); }
+  uint16_t getConnHandle() const {
+    return isConnected() ? NativeBle::peer().connHandle
+                         : BLE_HS_CONN_HANDLE_NONE;
+  }
+  int getRssi() const { return 0; }
+  NimBLERemoteService *getService(const NimBLEUUID &) { return nullptr; }
+
+private:
+  NimBLEClientCallbacks *m_callbacks = nullptr;
+  NimBLEAddress m_peer;
+};
+
+class NimBLEScanResults {
+public:
+  int getCount() const { return 0; }
+};
+
+class NimBLEScanCallbacks {
+public:
+  virtual ~NimBLEScanCallbacks() {}
+  virtual void onDiscovered(const NimBLEAdvertisedDevice *) {}
+  virtual void onResult(const NimBLEAdvertisedDevice *) {}
+  virtual void onScanEnd(const NimBLEScanResults &, int) {}
+};
+
+class NimBLEScan {
+public:
+  void setScanCallbacks(NimBLEScanCallbacks *cb, bool = false) {
+    m_callbacks = cb;
+  }
+  void setInterval(uint16_t ms) { NativeBle::scan().interval = ms; }
+  void setWindow(uint16_t) {}
+  void setActiveScan(bool) {}
+  bool isScanning() const { return false; }
+  bool start(uint32_t, bool = false, bool = true) {
+    NativeBle::scan().starts++;
+    return true;
+  }
+  bool stop() { return true; }
+
+private:
+  NimBLEScanCallbacks *m_callbacks = nullptr;
+};
+
+class NimBLEDevice {
+public:
+  static bool init(const std::string &) { return true; }
+  static bool setPower(int8_t) { return true; }
+  static NimBLEScan *getScan() {
+    static NimBLEScan scan;
+    return &scan;
+  }
+  static void setSecurityAuth(bool, bool, bool) {}
+  // One client is enough for the single fake peer
+  static size_t getCreatedClientCount() { return clientCreated() ? 1 : 0; }
+  static NimBLEClient *createClient() {
+    clientCreated() = true;
+    return &client();
+  }
+  static bool deleteClient(NimBLEClient *) {
+    clientCreated() = false;
+    return true;
+  }
+  static NimBLEClient *getClientByPeerAddress(const NimBLEAddress &address) {
+    return clientCreated() && client().getPeerAddress() == address ? &client()
+                                                                   : nullptr;
+  }
+  static NimBLEClient *getClientByHandle(uint16_t handle) {
+    return clientCreated() && client().getConnHandle() == handle ? &client()
+                                                                 : nullptr;
+  }
+  static NimBLEClient *getDisconnectedClient() {
+    return clientCreated() && !client().isConnected() ? &client() : nullptr;
+  }
+  static bool isBonded(const NimBLEAddress &address) {
+    NativeBle::Peer &p = NativeBle::peer();
+    return p.bonded && address == NimBLEAddress(p.address, p.addressType);
+  }
+  static bool injectPassKey(const NimBLEConnInfo &, uint32_t) { return true; }
+  static bool injectConfirmPasskey(const NimBLEConnInfo &, bool) {
+    return true;
+  }
+
+private:
+  static NimBLEClient &client() {
+    static NimBLEClient c;
+    return c;
+  }
+  static bool &clientCreated() {
+    static bool created = false;
+    return created;
+  }
+};
@@ -0,0 +1,9 @@
+// Host stand-in for NimBLE-Arduino logging (native environment only).
+#pragma once
+
+#include <stdio.h>
+
+#define NIMBLE_LOGD(tag, format, ...) ((void)0)
+#define NIMBLE_LOGI(tag, format, ...) printf("I %s: " format "\n", tag, ##__VA_ARGS__)
+#define NIMBLE_LOGW(tag, format, ...) printf("W %s: " format "\n", tag, ##__VA_ARGS__)
+#define NIMBLE_LOGE(tag, format, ...) printf("E %s: " format "\n", tag, ##__VA_ARGS__)
@@ -0,0 +1,58 @@
+// Host stand-in for the Arduino-ESP32 Preferences (NVS) API, kept in memory
+// for the lifetime of the process (native environment only).
+#pragma once
+
+#include <Arduino.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+class Preferences {
+public:
+  bool begin(const char *name, bool readOnly = false) {
+    m_ns = name;
+    m_readOnly = readOnly;
+    return true;
+  }
+  void end() { m_ns.clear(); }
+
+  size_t getBytesLength(const char *key) {
+    auto it = store().find(fullKey(key));
+    return it == store().end() ? 0 : it->second.size();
+  }
+  size_t getBytes(const char *key, void *buf, size_t maxLen) {
+    auto it = store().find(fullKey(key));
+    if (it == store().end() || it->second.size() > maxLen)
+      return 0;
+    memcpy(buf, it->second.data(), it->second.size());
+    return it->second.size();
+  }
+  size_t putBytes(const char *key, const void *value, size_t len) {
+    if (m_readOnly)
+      return 0;
+    const uint8_t *p = static_cast<const uint8_t *>(value);
+    store()[fullKey(key)].assign(p, p + len);
+    return len;
+  }
+  uint32_t getUInt(const char *key, uint32_t defaultValue = 0) {
+    uint32_t v;
+    return getBytes(key, &v, sizeof(v)) == sizeof(v) ? v : defaultValue;
+  }
+  size_t putUInt(const char *key, uint32_t value) {
+    return putBytes(key, &value, sizeof(value));
+  }
+  bool remove(const char *key) {
+    return !m_readOnly && store().erase(fullKey(key)) > 0;
+  }
+
+private:
+  std::string m_ns;
+  bool m_readOnly = false;
+
+  std::string fullKey(const char *key) const { return m_ns + "/" + key; }
+  static std::map<std::string, std::vector<uint8_t>> &store() {
+    static std::map<std::string, std::vector<uint8_t>> s;
+    return s;
+  }
+};
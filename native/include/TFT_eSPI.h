@@ -0,0 +1,29 @@
+// Host stand-in for TFT_eSPI (native environment only). Nothing is drawn;
+// the headless build flushes through FramebufferTransport instead.
+#pragma once
+
+#include <Arduino.h>
+
+class TFT_eSPI {
+public:
+  void begin() {}
+  void setRotation(uint8_t) {}
+  void setSwapBytes(bool swap) { m_swap = swap; }
+  bool getSwapBytes() { return m_swap; }
+
+  bool initDMA(bool = false) { return true; }
+  void deInitDMA() {}
+  bool dmaBusy() { return false; }
+  void dmaWait() {}
+
+  void startWrite() {}
+  void endWrite() {}
+  void setAddrWindow(int32_t, int32_t, int32_t, int32_t) {}
+  void pushPixels(const void *, uint32_t) {}
+  void pushPixelsDMA(uint16_t *, uint32_t) {}
+  void pushImageDMA(int32_t, int32_t, int32_t, int32_t, uint16_t *,
+                    uint16_t * = nullptr) {}
+
+private:
+  bool m_swap = false;
+};
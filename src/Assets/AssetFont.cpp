@@ -0,0 +1,125 @@
+#include "AssetFont.h"
+
+#include <Arduino.h>
+
+#include "AssetStore.h"
+#include "FontPack.h"
+
+struct LoadedFont {
+  lv_font_t font;
+  const uint8_t *data;
+  FontInfo info;
+  uint16_t entry; // index in the asset pack
+};
+
+static LoadedFont s_fonts[FONT_MAX_LOADED];
+static uint8_t s_loaded = 0;
+
+static GlyphCache s_cache;
+static size_t s_cacheBytes = FONT_CACHE_BYTES;
+static uint32_t s_cacheCaps = FONT_CACHE_CAPS;
+static uint16_t s_slotBytes = 0; // largest glyph of the loaded fonts
+// Unpack target while the cache cannot be allocated
+static uint8_t *s_scratch = nullptr;
+
+static void resizeCache(uint16_t slotBytes) {
+  s_slotBytes = slotBytes;
+  if (s_cache.begin(s_cacheBytes, s_cacheCaps, slotBytes)) {
+    heap_caps_free(s_scratch);
+    s_scratch = nullptr;
+    return;
+  }
+  Serial.printf("[FONT] No glyph cache (%u bytes), unpacking every draw\n",
+                (unsigned)s_cacheBytes);
+  heap_caps_free(s_scratch);
+  s_scratch = (uint8_t *)heap_caps_malloc(slotBytes, MALLOC_CAP_8BIT);
+}
+
+static bool getGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc,
+                        uint32_t letter, uint32_t letterNext) {
+  const LoadedFont *f = (const LoadedFont *)font->dsc;
+  FontGlyph g = {};
+  if (!fontFindGlyph(f->data, f->info, letter, g))
+    return false;
+  dsc->adv_w = g.advance;
+  dsc->box_w = g.boxW;
+  dsc->box_h = g.boxH;
+  dsc->ofs_x = g.ofsX;
+  dsc->ofs_y = g.ofsY;
+  dsc->bpp = FONT_BPP;
+  dsc->is_placeholder = false;
+  return true;
+}
+
+static const uint8_t *getGlyphBitmap(const lv_font_t *font, uint32_t letter) {
+  const LoadedFont *f = (const LoadedFont *)font->dsc;
+  FontGlyph g = {};
+  if (!fontFindGlyph(f->data, f->info, letter, g))
+    return nullptr;
+  if (fontGlyphIsRaw(g))
+    return g.bitmap; // drawn from the mapped flash
+
+  uint32_t key = (uint32_t)(f - s_fonts) << 24 | letter;
+  const uint8_t *cached = s_cache.find(key);
+  if (cached)
+    return cached;
+  uint8_t *out = s_cache.isActive() ? s_cache.insert(key) : s_scratch;
+  if (!out)
+    return nullptr;
+  if (!fontUnpackGlyph(g, out)) {
+    // Corrupt glyph: cached blank rather than unpacked again
+    memset(out, 0, fontBitmapBytes(g.boxW, g.boxH));
+  }
+  return out;
+}
+
+void fontCacheConfig(size_t bytes, uint32_t caps) {
+  s_cacheBytes = bytes;
+  s_cacheCaps = caps;
+  if (s_slotBytes)
+    resizeCache(s_slotBytes);
+}
+
+const lv_font_t *fontLoad(const char *name, const lv_font_t *fallback) {
+  AssetInfo asset = {};
+  if (!assets().find(name, asset) || asset.type != ASSET_FONT)
+    return nullptr;
+  for (uint8_t i = 0; i < s_loaded; i++) {
+    if (s_fonts[i].entry == asset.index)
+      return &s_fonts[i].font;
+  }
+
+  FontInfo info = {};
+  if (!fontParse(asset.data, asset.size, info)) {
+    Serial.printf("[FONT] %s: invalid font\n", name);
+    return nullptr;
+  }
+  if (s_loaded == FONT_MAX_LOADED) {
+    Serial.printf("[FONT] %s: more than %u fonts\n", name, FONT_MAX_LOADED);
+    return nullptr;
+  }
+  if (info.maxBitmapBytes > s_slotBytes)
+    resizeCache(info.maxBitmapBytes);
+
+  LoadedFont &f = s_fonts[s_loaded++];
+  memset(&f.font, 0, sizeof(f.font));
+  f.data = asset.data;
+  f.info = info;
+  f.entry = asset.index;
+  f.font.get_glyph_dsc = getGlyphDsc;
+  f.font.get_glyph_bitmap = getGlyphBitmap;
+  f.font.line_height = info.lineHeight;
+  f.font.base_line = info.baseLine;
+  f.font.subpx = LV_FONT_SUBPX_NONE;
+  f.font.underline_position = info.underlinePosition;
+  f.font.underline_thickness = info.underlineThickness;
+  f.font.dsc = &f;
+  f.font.fallback = fallback;
+  Serial.printf("[FONT] %s: %u glyphs, line height %u\n", name,
+                info.glyphCount, info.lineHeight);
+  return &f.font;
+}
+
+const GlyphCache::Stats &fontCacheStats() { return s_cache.stats(); }
+
+void fontCacheResetStats() { s_cache.resetStats(); }
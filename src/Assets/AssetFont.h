@@ -0,0 +1,40 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include "esp_heap_caps.h"
+
+#include "GlyphCache.h"
+
+/**
+ * Fonts from the asset pack (FontPack.h), loaded on demand.
+ *
+ * fontLoad() only validates the glyph table in the mapped partition and
+ * fills an lv_font_t; glyph bitmaps are read when LVGL draws them.
+ * Bitmaps stored unpacked are handed to LVGL straight from flash,
+ * compressed ones are unpacked into the glyph cache, an LRU in PSRAM of
+ * FONT_CACHE_BYTES (fontCacheConfig()), so a glyph on screen is unpacked
+ * once rather than on every redraw. fontCacheStats() has the hit and miss
+ * counts.
+ *
+ * Code points a pack font lacks are drawn from its fallback font (LVGL
+ * resolves lv_font_t::fallback per glyph).
+ */
+
+#define FONT_CACHE_BYTES (64 * 1024)
+#define FONT_CACHE_CAPS (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+// Distinct pack fonts that can be loaded at the same time
+#define FONT_MAX_LOADED 8
+
+/** Glyph cache budget and memory; takes effect with the next fontLoad(). */
+void fontCacheConfig(size_t bytes, uint32_t caps = FONT_CACHE_CAPS);
+
+/**
+ * Font name from the asset pack, or nullptr if the pack has no valid font
+ * of that name. Loading it again returns the same font; it stays loaded
+ * until reboot.
+ */
+const lv_font_t* fontLoad(const char* name, const lv_font_t* fallback = LV_FONT_DEFAULT);
+
+const GlyphCache::Stats& fontCacheStats();
+void fontCacheResetStats();
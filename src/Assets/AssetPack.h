@@ -0,0 +1,177 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Read-only asset pack: an index followed by aligned blobs, built by
+ * tools/asset_pack.py and read in place from memory-mapped flash
+ * (AssetStore.h), so the data of an asset is never copied into RAM.
+ *
+ * Layout (little-endian):
+ *     0   "APK1"
+ *     4   u32 entry count
+ *     8   u32 pack size in bytes
+ *     12  u32 FNV-1a of the index entries
+ *     16  index entries, ASSET_ENTRY_SIZE bytes each, sorted by name
+ *     ... blobs, each starting at a multiple of ASSET_ALIGN
+ *
+ * Index entry:
+ *     0   name, NUL padded (at most ASSET_NAME_MAX - 1 characters)
+ *     32  u32 blob offset from the start of the pack, u32 blob size
+ *     40  u8 type (AssetType), u8 format (per type)
+ *     42  u16 width, u16 height (images), u16 reserved
+ *
+ * The reader does no allocation and all of it is constexpr. It is tested
+ * against packs mapped from files in test/test_asset_pack.
+ */
+
+#define ASSET_HEADER_SIZE 16
+#define ASSET_ENTRY_SIZE 48
+#define ASSET_NAME_MAX 32
+#define ASSET_ALIGN 16
+
+enum AssetType : uint8_t {
+    ASSET_RAW = 0,
+    ASSET_IMAGE = 1,
+    ASSET_FONT = 2, // FontPack.h
+};
+
+/** Format of an ASSET_IMAGE blob. */
+enum AssetImageFormat : uint8_t {
+    ASSET_IMG_RLE = 0,          // stream of Display/RleImage.h
+    ASSET_IMG_RGB565 = 1,       // LV_IMG_CF_TRUE_COLOR pixels
+    ASSET_IMG_RGB565_ALPHA = 2, // LV_IMG_CF_TRUE_COLOR_ALPHA pixels
+};
+
+struct AssetInfo {
+    uint16_t index;
+    AssetType type;
+    uint8_t format;
+    uint16_t width;
+    uint16_t height;
+    uint32_t size;
+    const uint8_t* data; // size bytes, in the mapped pack
+};
+
+constexpr uint32_t assetRead16(const uint8_t* p) { return (uint32_t)p[0] | (uint32_t)p[1] << 8; }
+
+constexpr uint32_t assetRead32(const uint8_t* p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+constexpr uint32_t assetFnv1a(const uint8_t* p, size_t size) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < size; i++)
+        h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+class AssetPack {
+public:
+    constexpr AssetPack() = default;
+
+    /**
+     * Validates the header and index of the pack at base (mapped size
+     * bytes). Returns false, leaving the pack empty, if anything is out of
+     * place; blobs themselves are not checked.
+     */
+    constexpr bool open(const uint8_t* base, size_t size) {
+        close();
+        if (!base || size < ASSET_HEADER_SIZE || base[0] != 'A' || base[1] != 'P' ||
+            base[2] != 'K' || base[3] != '1')
+            return false;
+        uint32_t count = assetRead32(base + 4);
+        uint32_t packSize = assetRead32(base + 8);
+        if (count > UINT16_MAX || packSize > size)
+            return false;
+        size_t indexEnd = ASSET_HEADER_SIZE + (size_t)count * ASSET_ENTRY_SIZE;
+        if (indexEnd > packSize)
+            return false;
+        if (assetFnv1a(base + ASSET_HEADER_SIZE, indexEnd - ASSET_HEADER_SIZE) !=
+            assetRead32(base + 12))
+            return false;
+
+        for (uint32_t i = 0; i < count; i++) {
+            const uint8_t* e = base + ASSET_HEADER_SIZE + i * ASSET_ENTRY_SIZE;
+            if (e[0] == 0 || e[ASSET_NAME_MAX - 1] != 0)
+                return false;
+            if (i > 0 && compareName(e - ASSET_ENTRY_SIZE, e) >= 0)
+                return false; // unsorted or duplicate
+            uint32_t offset = assetRead32(e + 32);
+            uint32_t blobSize = assetRead32(e + 36);
+            if (offset % ASSET_ALIGN || offset < indexEnd || offset > packSize ||
+                blobSize > packSize - offset)
+                return false;
+        }
+        m_base = base;
+        m_count = (uint16_t)count;
+        m_size = packSize;
+        return true;
+    }
+
+    constexpr void close() {
+        m_base = nullptr;
+        m_count = 0;
+        m_size = 0;
+    }
+
+    constexpr bool isOpen() const { return m_base != nullptr; }
+    constexpr uint16_t count() const { return m_count; }
+    constexpr uint32_t size() const { return m_size; }
+
+    constexpr AssetInfo at(uint16_t index) const {
+        const uint8_t* e = entry(index);
+        return {index,
+                (AssetType)e[40],
+                e[41],
+                (uint16_t)assetRead16(e + 42),
+                (uint16_t)assetRead16(e + 44),
+                assetRead32(e + 36),
+                m_base + assetRead32(e + 32)};
+    }
+
+    /** Binary search of the index. */
+    constexpr bool find(const char* name, AssetInfo& out) const {
+        int lo = 0;
+        int hi = (int)m_count - 1;
+        while (lo <= hi) {
+            int mid = (lo + hi) / 2;
+            int c = compareName(entry((uint16_t)mid), name);
+            if (c == 0) {
+                out = at((uint16_t)mid);
+                return true;
+            }
+            if (c < 0)
+                lo = mid + 1;
+            else
+                hi = mid - 1;
+        }
+        return false;
+    }
+
+    /** NUL-terminated name of entry index. */
+    const char* name(uint16_t index) const { return (const char*)entry(index); }
+
+private:
+    constexpr const uint8_t* entry(uint16_t index) const {
+        return m_base + ASSET_HEADER_SIZE + (size_t)index * ASSET_ENTRY_SIZE;
+    }
+
+    // strcmp() of an entry name against another entry or a string
+    template <typename Char>
+    static constexpr int compareName(const uint8_t* a, const Char* b) {
+        for (size_t i = 0; i < ASSET_NAME_MAX; i++) {
+            uint8_t cb = (uint8_t)b[i];
+            if (a[i] != cb)
+                return a[i] < cb ? -1 : 1;
+            if (cb == 0)
+                return 0;
+        }
+        return 0;
+    }
+
+    const uint8_t* m_base = nullptr;
+    uint16_t m_count = 0;
+    uint32_t m_size = 0;
+};
@@ -0,0 +1,181 @@
+#include "AssetStore.h"
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#include "Display/RleImage.h"
+
+static AssetPack s_pack;
+
+const AssetPack &assets() { return s_pack; }
+
+static bool openPack(const uint8_t *base, size_t size, const char *source) {
+  if (!s_pack.open(base, size)) {
+    Serial.printf("[ASSETS] No valid pack in %s\n", source);
+    return false;
+  }
+  Serial.printf("[ASSETS] %u assets, %u bytes mapped from %s\n",
+                s_pack.count(), s_pack.size(), source);
+  return true;
+}
+
+#ifndef NATIVE
+
+#include "esp_idf_version.h"
+#include "esp_partition.h"
+
+#if ESP_IDF_VERSION_MAJOR >= 5
+#define ASSET_MMAP_DATA ESP_PARTITION_MMAP_DATA
+#define assetMunmap esp_partition_munmap
+typedef esp_partition_mmap_handle_t AssetMmapHandle;
+#else
+#define ASSET_MMAP_DATA SPI_FLASH_MMAP_DATA
+#define assetMunmap spi_flash_munmap
+typedef spi_flash_mmap_handle_t AssetMmapHandle;
+#endif
+
+bool assetsBegin() {
+  const esp_partition_t *part = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, ASSET_PARTITION_LABEL);
+  if (!part) {
+    Serial.println("[ASSETS] No \"" ASSET_PARTITION_LABEL "\" partition");
+    return false;
+  }
+
+  // Map only what the header says is used; the MMU maps 64 KB pages
+  uint8_t header[ASSET_HEADER_SIZE];
+  if (esp_partition_read(part, 0, header, sizeof(header)) != ESP_OK)
+    return false;
+  uint32_t size = assetRead32(header + 8);
+  if (size < ASSET_HEADER_SIZE || size > part->size)
+    size = ASSET_HEADER_SIZE; // let open() report it
+
+  const void *base = nullptr;
+  AssetMmapHandle handle;
+  if (esp_partition_mmap(part, 0, size, ASSET_MMAP_DATA, &base, &handle) !=
+      ESP_OK) {
+    Serial.println("[ASSETS] esp_partition_mmap failed");
+    return false;
+  }
+  // The mapping stays for the lifetime of the firmware
+  if (!openPack((const uint8_t *)base, size, "flash")) {
+    assetMunmap(handle);
+    return false;
+  }
+  return true;
+}
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool assetsBegin() { return false; }
+
+bool assetsBeginFile(const char *path) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    Serial.printf("[ASSETS] Cannot open %s\n", path);
+    return false;
+  }
+  struct stat st;
+  void *base = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > 0)
+    base = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    Serial.printf("[ASSETS] Cannot map %s\n", path);
+    return false;
+  }
+  if (!openPack((const uint8_t *)base, st.st_size, path)) {
+    munmap(base, st.st_size);
+    return false;
+  }
+  return true;
+}
+
+#endif
+
+// ============================================================================
+// LVGL DECODER
+// ============================================================================
+
+static bool assetSource(const void *src, AssetInfo &info) {
+  if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE)
+    return false;
+  const lv_img_dsc_t *img = (const lv_img_dsc_t *)src;
+  return img->header.cf == LV_IMG_CF_USER_ENCODED_1 &&
+         s_pack.find((const char *)img->data, info) &&
+         info.type == ASSET_IMAGE;
+}
+
+static lv_res_t assetInfo(lv_img_decoder_t *decoder, const void *src,
+                          lv_img_header_t *header) {
+  AssetInfo info = {};
+  if (!assetSource(src, info))
+    return LV_RES_INV;
+
+  bool alpha = info.format == ASSET_IMG_RGB565_ALPHA ||
+               (info.format == ASSET_IMG_RLE && info.size > 8 &&
+                info.data[8] == 3);
+  header->always_zero = 0;
+  header->w = info.width;
+  header->h = info.height;
+  header->cf = alpha ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+  return LV_RES_OK;
+}
+
+static lv_res_t assetOpen(lv_img_decoder_t *decoder,
+                          lv_img_decoder_dsc_t *dsc) {
+  AssetInfo info = {};
+  if (!assetSource(dsc->src, info))
+    return LV_RES_INV;
+
+  switch (info.format) {
+  case ASSET_IMG_RGB565:
+  case ASSET_IMG_RGB565_ALPHA: {
+    uint32_t bpp = info.format == ASSET_IMG_RGB565 ? 2 : 3;
+    if (info.size < (uint32_t)info.width * info.height * bpp)
+      return LV_RES_INV;
+    // LVGL reads the pixels straight from the mapped flash
+    dsc->img_data = info.data;
+    return LV_RES_OK;
+  }
+  case ASSET_IMG_RLE: {
+    RleInfo rle = {};
+    if (!rleParse(info.data, info.size, rle) || rle.width != info.width ||
+        rle.height != info.height)
+      return LV_RES_INV;
+    dsc->img_data = nullptr;
+    dsc->user_data = (void *)(uintptr_t)info.index;
+    return LV_RES_OK;
+  }
+  default:
+    return LV_RES_INV;
+  }
+}
+
+static lv_res_t assetReadLine(lv_img_decoder_t *decoder,
+                              lv_img_decoder_dsc_t *dsc, lv_coord_t x,
+                              lv_coord_t y, lv_coord_t len, uint8_t *buf) {
+  // Only RLE blobs get here; validated in assetOpen()
+  AssetInfo info = s_pack.at((uint16_t)(uintptr_t)dsc->user_data);
+  RleInfo rle = {info.width, info.height, info.data[8]};
+  if (x < 0 || y < 0 || len < 0)
+    return LV_RES_INV;
+  return rleDecodeLine(info.data, info.size, rle, y, x, len, buf)
+             ? LV_RES_OK
+             : LV_RES_INV;
+}
+
+static void assetClose(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {}
+
+void assetImageInit() {
+  lv_img_decoder_t *decoder = lv_img_decoder_create();
+  lv_img_decoder_set_info_cb(decoder, assetInfo);
+  lv_img_decoder_set_open_cb(decoder, assetOpen);
+  lv_img_decoder_set_read_line_cb(decoder, assetReadLine);
+  lv_img_decoder_set_close_cb(decoder, assetClose);
+}
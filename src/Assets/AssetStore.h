@@ -0,0 +1,33 @@
+#pragma once
+
+#include "AssetPack.h"
+
+/**
+ * The asset pack mapped from flash.
+ *
+ * On the device the "assets" data partition (partitions.csv) is mapped
+ * into the data address space with esp_partition_mmap() and read through
+ * the flash cache; flash it with `pio run -e dictionary -t uploadassets`.
+ * The native build maps a pack file instead.
+ *
+ * In the device build the UI images are compiled as small descriptors of
+ * cf LV_IMG_CF_USER_ENCODED_1 whose data is the asset name
+ * (tools/asset_pack.py). The decoder registered by assetImageInit() looks the
+ * name up and hands LVGL the mapped pixels directly, or decodes an RLE
+ * blob line by line from the mapping (Display/RleImage.h).
+ */
+
+#define ASSET_PARTITION_LABEL "assets"
+
+/** Map the asset partition. False (and an empty pack) if it is missing or invalid. */
+bool assetsBegin();
+
+#ifdef NATIVE
+/** Map a pack file (host builds have no partitions). */
+bool assetsBeginFile(const char* path);
+#endif
+
+const AssetPack& assets();
+
+/** Register the LVGL decoder for pack images. Called from initLVGL(). */
+void assetImageInit();
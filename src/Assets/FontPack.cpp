@@ -0,0 +1,127 @@
+#include "FontPack.h"
+
+// Glyph lookup and unpacking of a three-glyph font built at compile time.
+
+namespace {
+
+constexpr size_t TABLE_END = FONT_HEADER_SIZE + 3 * FONT_GLYPH_SIZE;
+
+// 'A' 3x2 stored raw, 'B' 4x3 as tokens, 'C' 2x1 with corrupt tokens
+constexpr uint8_t RAW_A[] = {0x12, 0x34, 0x56};
+constexpr uint8_t PACKED_B[] = {
+    0x80, 4,          // run of five 0
+    0x02, 0xF1, 0x20, // literals F 1 2
+    0x8F, 3,          // run of four F
+};
+constexpr uint8_t BAD_C[] = {0x80, 2}; // run of three in a box of two
+
+constexpr size_t FONT_SIZE =
+    TABLE_END + sizeof(RAW_A) + sizeof(PACKED_B) + sizeof(BAD_C);
+
+struct Font {
+  uint8_t bytes[FONT_SIZE];
+};
+
+constexpr void put(uint8_t *p, uint32_t v, int n) {
+  for (int i = 0; i < n; i++)
+    p[i] = (uint8_t)(v >> (8 * i));
+}
+
+constexpr void putGlyph(Font &f, int i, uint32_t cp, uint32_t offset,
+                        const uint8_t *bits, uint16_t size, uint8_t w,
+                        uint8_t h) {
+  uint8_t *g = f.bytes + FONT_HEADER_SIZE + i * FONT_GLYPH_SIZE;
+  put(g, cp, 4);
+  put(g + 4, offset, 4);
+  put(g + 8, size, 2);
+  put(g + 10, w + 1, 2);
+  g[12] = w;
+  g[13] = h;
+  g[15] = (uint8_t)-1;
+  for (uint16_t k = 0; k < size; k++)
+    f.bytes[offset + k] = bits[k];
+}
+
+constexpr Font build(bool unsorted = false) {
+  Font f = {};
+  f.bytes[0] = 'F';
+  f.bytes[1] = 'N';
+  f.bytes[2] = 'T';
+  f.bytes[3] = '1';
+  put(f.bytes + 4, 3, 2);
+  f.bytes[6] = 12; // line height
+  f.bytes[7] = 3;  // base line
+  f.bytes[10] = FONT_BPP;
+  put(f.bytes + 12, 6, 2); // 'B': 12 pixels
+  size_t o = TABLE_END;
+  putGlyph(f, 0, 'A', o, RAW_A, sizeof(RAW_A), 3, 2);
+  o += sizeof(RAW_A);
+  putGlyph(f, 1, unsorted ? 'D' : 'B', o, PACKED_B, sizeof(PACKED_B), 4, 3);
+  o += sizeof(PACKED_B);
+  putGlyph(f, 2, 'C', o, BAD_C, sizeof(BAD_C), 2, 1);
+  return f;
+}
+
+constexpr Font FONT = build();
+constexpr Font UNSORTED = build(true);
+
+constexpr bool parses(const Font &f, size_t size = FONT_SIZE) {
+  FontInfo info = {};
+  return fontParse(f.bytes, size, info);
+}
+
+constexpr FontGlyph glyph(uint32_t cp, bool &found) {
+  FontInfo info = {};
+  FontGlyph g = {};
+  found = fontParse(FONT.bytes, FONT_SIZE, info) &&
+          fontFindGlyph(FONT.bytes, info, cp, g);
+  return g;
+}
+
+constexpr bool finds(uint32_t cp) {
+  bool found = false;
+  glyph(cp, found);
+  return found;
+}
+
+struct Unpacked {
+  bool ok;
+  uint8_t bytes[6];
+};
+
+constexpr Unpacked unpack(uint32_t cp) {
+  bool found = false;
+  FontGlyph g = glyph(cp, found);
+  Unpacked u = {};
+  u.ok = found && fontUnpackGlyph(g, u.bytes);
+  return u;
+}
+
+static_assert(parses(FONT), "valid font");
+static_assert(!parses(UNSORTED), "glyph table must be sorted");
+static_assert(!parses(FONT, TABLE_END - 1), "truncated glyph table");
+
+static_assert(finds('A') && finds('B') && finds('C'), "glyphs found");
+static_assert(!finds('@') && !finds('D') && !finds(0x4E00), "missing glyphs");
+
+constexpr bool glyphA() {
+  bool found = false;
+  FontGlyph g = glyph('A', found);
+  return found && fontGlyphIsRaw(g) && g.bitmap[0] == 0x12 && g.advance == 4 &&
+         g.boxW == 3 && g.boxH == 2 && g.ofsY == -1;
+}
+static_assert(glyphA(), "raw glyph drawn in place");
+
+constexpr bool glyphB() {
+  bool found = false;
+  FontGlyph g = glyph('B', found);
+  Unpacked u = unpack('B');
+  // 0 0 0 0 | 0 F 1 2 | F F F F
+  return !fontGlyphIsRaw(g) && u.ok && u.bytes[0] == 0x00 &&
+         u.bytes[1] == 0x00 && u.bytes[2] == 0x0F && u.bytes[3] == 0x12 &&
+         u.bytes[4] == 0xFF && u.bytes[5] == 0xFF;
+}
+static_assert(glyphB(), "runs and odd literals unpack to LVGL's layout");
+static_assert(!unpack('C').ok, "run past the box");
+
+} // namespace
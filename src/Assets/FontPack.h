@@ -0,0 +1,173 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "AssetPack.h"
+
+/**
+ * Bitmap font stored as an ASSET_FONT entry of the asset pack, built from
+ * a TrueType font by tools/asset_pack.py (assets/fonts.txt lists them).
+ *
+ * Layout (little-endian):
+ *     0   "FNT1"
+ *     4   u16 glyph count
+ *     6   u8 line height, u8 base line (pixels above the bottom of the line)
+ *     8   i8 underline position, u8 underline thickness, u8 bpp (4), u8 0
+ *     12  u16 largest unpacked glyph bitmap in bytes, u16 0
+ *     16  glyph table, FONT_GLYPH_SIZE bytes each, sorted by code point:
+ *           u32 code point, u32 bitmap offset from the font start,
+ *           u16 stored bitmap size, u16 advance in pixels,
+ *           u8 box width, u8 box height, i8 x offset, i8 y offset
+ *     ... bitmaps
+ *
+ * A bitmap unpacks to what LVGL draws: box width x box height pixels of
+ * 4 bits, first pixel in the high nibble, rows not padded. It is stored
+ * that way if compressing does not make it smaller, otherwise as tokens:
+ * a control byte n < 0x80 is followed by n + 1 literal pixels packed the
+ * same way (an odd count leaves the low nibble of the last byte unused);
+ * n >= 0x80 is one byte more, the run length - 1, for a run of the pixel
+ * value n & 0x0F.
+ */
+
+#define FONT_HEADER_SIZE 16
+#define FONT_GLYPH_SIZE 16
+#define FONT_BPP 4
+
+struct FontInfo {
+    uint16_t glyphCount;
+    uint8_t lineHeight;
+    uint8_t baseLine;
+    int8_t underlinePosition;
+    uint8_t underlineThickness;
+    uint16_t maxBitmapBytes;
+};
+
+struct FontGlyph {
+    uint32_t codepoint;
+    uint16_t index;
+    uint16_t advance;
+    uint8_t boxW;
+    uint8_t boxH;
+    int8_t ofsX;
+    int8_t ofsY;
+    uint16_t storedSize;
+    const uint8_t* bitmap; // storedSize bytes
+};
+
+/** Bytes of an unpacked bitmap. */
+constexpr uint32_t fontBitmapBytes(uint8_t boxW, uint8_t boxH) {
+    return ((uint32_t)boxW * boxH * FONT_BPP + 7) / 8;
+}
+
+/** Validates the header and glyph table of the font at data (size bytes). */
+constexpr bool fontParse(const uint8_t* data, size_t size, FontInfo& info) {
+    if (size < FONT_HEADER_SIZE || data[0] != 'F' || data[1] != 'N' || data[2] != 'T' ||
+        data[3] != '1' || data[10] != FONT_BPP)
+        return false;
+    info.glyphCount = (uint16_t)assetRead16(data + 4);
+    info.lineHeight = data[6];
+    info.baseLine = data[7];
+    info.underlinePosition = (int8_t)data[8];
+    info.underlineThickness = data[9];
+    info.maxBitmapBytes = (uint16_t)assetRead16(data + 12);
+    size_t tableEnd = FONT_HEADER_SIZE + (size_t)info.glyphCount * FONT_GLYPH_SIZE;
+    if (size < tableEnd)
+        return false;
+
+    uint32_t prev = 0;
+    for (uint16_t i = 0; i < info.glyphCount; i++) {
+        const uint8_t* g = data + FONT_HEADER_SIZE + i * FONT_GLYPH_SIZE;
+        uint32_t cp = assetRead32(g);
+        uint32_t offset = assetRead32(g + 4);
+        uint32_t stored = assetRead16(g + 8);
+        if ((i > 0 && cp <= prev) || offset < tableEnd || offset > size ||
+            stored > size - offset || fontBitmapBytes(g[12], g[13]) > info.maxBitmapBytes)
+            return false;
+        prev = cp;
+    }
+    return true;
+}
+
+constexpr FontGlyph fontGlyphAt(const uint8_t* data, uint16_t index) {
+    const uint8_t* g = data + FONT_HEADER_SIZE + (size_t)index * FONT_GLYPH_SIZE;
+    return {assetRead32(g),
+            index,
+            (uint16_t)assetRead16(g + 10),
+            g[12],
+            g[13],
+            (int8_t)g[14],
+            (int8_t)g[15],
+            (uint16_t)assetRead16(g + 8),
+            data + assetRead32(g + 4)};
+}
+
+/** Binary search of the glyph table of a parsed font. */
+constexpr bool fontFindGlyph(const uint8_t* data, const FontInfo& info, uint32_t codepoint,
+                             FontGlyph& out) {
+    int lo = 0;
+    int hi = (int)info.glyphCount - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        uint32_t cp = assetRead32(data + FONT_HEADER_SIZE + mid * FONT_GLYPH_SIZE);
+        if (cp == codepoint) {
+            out = fontGlyphAt(data, (uint16_t)mid);
+            return true;
+        }
+        if (cp < codepoint)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    return false;
+}
+
+/** Whether the glyph's bitmap is stored unpacked and can be drawn in place. */
+constexpr bool fontGlyphIsRaw(const FontGlyph& g) {
+    return g.storedSize == fontBitmapBytes(g.boxW, g.boxH);
+}
+
+/**
+ * Unpack a compressed glyph bitmap into out (fontBitmapBytes() bytes).
+ * False if the tokens are corrupt or do not cover the box exactly.
+ */
+constexpr bool fontUnpackGlyph(const FontGlyph& g, uint8_t* out) {
+    const uint32_t pixels = (uint32_t)g.boxW * g.boxH;
+    const uint32_t bytes = fontBitmapBytes(g.boxW, g.boxH);
+    for (uint32_t i = 0; i < bytes; i++)
+        out[i] = 0;
+
+    uint32_t px = 0;
+    size_t pos = 0;
+    while (px < pixels) {
+        if (pos >= g.storedSize)
+            return false;
+        uint8_t ctrl = g.bitmap[pos++];
+        uint32_t count = 0;
+        uint8_t value = 0;
+        bool run = ctrl & 0x80;
+        if (run) {
+            if (pos >= g.storedSize)
+                return false;
+            count = g.bitmap[pos++] + 1u;
+            value = ctrl & 0x0F;
+        } else {
+            count = ctrl + 1u;
+            if (pos + (count + 1) / 2 > g.storedSize)
+                return false;
+        }
+        if (px + count > pixels)
+            return false;
+        for (uint32_t i = 0; i < count; i++) {
+            if (!run) {
+                uint8_t b = g.bitmap[pos + i / 2];
+                value = (i & 1) ? b & 0x0F : b >> 4;
+            }
+            out[(px + i) / 2] |= ((px + i) & 1) ? value : (uint8_t)(value << 4);
+        }
+        if (!run)
+            pos += (count + 1) / 2;
+        px += count;
+    }
+    return pos == g.storedSize;
+}
@@ -0,0 +1,155 @@
+#include "GlyphCache.h"
+
+#include "esp_heap_caps.h"
+
+bool GlyphCache::begin(size_t budget, uint32_t caps, uint16_t slotBytes) {
+  end();
+  if (slotBytes == 0)
+    return false;
+
+  // Each slot costs its bitmap, its links and two table buckets (the table
+  // is a power of two at least twice the slot count)
+  slotBytes = (slotBytes + 3) & ~3u;
+  size_t perSlot = slotBytes + sizeof(Slot) + 2 * 2 * sizeof(uint16_t);
+  size_t slots = budget / perSlot;
+  if (slots > NONE - 1)
+    slots = NONE - 1;
+  if (slots < 2)
+    return false;
+  size_t buckets = 1;
+  while (buckets < 2 * slots)
+    buckets <<= 1;
+
+  size_t bytes = slots * sizeof(Slot) + buckets * sizeof(uint16_t) +
+                 slots * slotBytes;
+  m_mem = heap_caps_malloc(bytes, caps);
+  if (!m_mem)
+    return false;
+
+  uint8_t *p = (uint8_t *)m_mem;
+  m_slots = (Slot *)p;
+  p += slots * sizeof(Slot);
+  m_table = (uint16_t *)p;
+  p += buckets * sizeof(uint16_t);
+  m_data = p;
+  for (size_t i = 0; i < buckets; i++)
+    m_table[i] = NONE;
+  m_tableMask = buckets - 1;
+  m_head = m_tail = NONE;
+
+  m_stats.slots = slots;
+  m_stats.used = 0;
+  m_stats.slotBytes = slotBytes;
+  m_stats.bytes = bytes;
+  return true;
+}
+
+void GlyphCache::end() {
+  if (m_mem)
+    heap_caps_free(m_mem);
+  m_mem = nullptr;
+  m_slots = nullptr;
+  m_table = nullptr;
+  m_data = nullptr;
+  m_head = m_tail = NONE;
+  m_stats.slots = m_stats.used = m_stats.slotBytes = 0;
+  m_stats.bytes = 0;
+}
+
+void GlyphCache::resetStats() {
+  m_stats.hits = m_stats.misses = m_stats.evictions = 0;
+}
+
+uint32_t GlyphCache::bucketOf(uint32_t key) const {
+  // Fibonacci hashing; code points of one font are mostly consecutive
+  return (key * 2654435769u >> 16) & m_tableMask;
+}
+
+uint16_t GlyphCache::lookup(uint32_t key) const {
+  for (uint32_t b = bucketOf(key);; b = (b + 1) & m_tableMask) {
+    uint16_t s = m_table[b];
+    if (s == NONE || m_slots[s].key == key)
+      return s;
+  }
+}
+
+void GlyphCache::unlink(uint16_t slot) {
+  Slot &s = m_slots[slot];
+  if (s.prev != NONE)
+    m_slots[s.prev].next = s.next;
+  else
+    m_head = s.next;
+  if (s.next != NONE)
+    m_slots[s.next].prev = s.prev;
+  else
+    m_tail = s.prev;
+}
+
+void GlyphCache::pushFront(uint16_t slot) {
+  Slot &s = m_slots[slot];
+  s.prev = NONE;
+  s.next = m_head;
+  if (m_head != NONE)
+    m_slots[m_head].prev = slot;
+  m_head = slot;
+  if (m_tail == NONE)
+    m_tail = slot;
+}
+
+void GlyphCache::removeFromTable(uint16_t slot) {
+  uint32_t b = bucketOf(m_slots[slot].key);
+  while (m_table[b] != slot)
+    b = (b + 1) & m_tableMask;
+
+  // Backward shift: move later entries of the probe run into the hole so
+  // lookups never need tombstones
+  uint32_t hole = b;
+  for (uint32_t i = (hole + 1) & m_tableMask; m_table[i] != NONE;
+       i = (i + 1) & m_tableMask) {
+    uint32_t home = bucketOf(m_slots[m_table[i]].key);
+    // Movable if its home is not in (hole, i]
+    if (((i - home) & m_tableMask) >= ((i - hole) & m_tableMask)) {
+      m_table[hole] = m_table[i];
+      hole = i;
+    }
+  }
+  m_table[hole] = NONE;
+}
+
+const uint8_t *GlyphCache::find(uint32_t key) {
+  if (!m_mem)
+    return nullptr;
+  uint16_t s = lookup(key);
+  if (s == NONE) {
+    m_stats.misses++;
+    return nullptr;
+  }
+  m_stats.hits++;
+  if (s != m_head) {
+    unlink(s);
+    pushFront(s);
+  }
+  return bitmap(s);
+}
+
+uint8_t *GlyphCache::insert(uint32_t key) {
+  if (!m_mem)
+    return nullptr;
+  uint16_t s;
+  if (m_stats.used < m_stats.slots) {
+    s = m_stats.used++;
+  } else {
+    s = m_tail;
+    unlink(s);
+    removeFromTable(s);
+    m_stats.evictions++;
+  }
+
+  m_slots[s].key = key;
+  uint32_t b = bucketOf(key);
+  while (m_table[b] != NONE)
+    b = (b + 1) & m_tableMask;
+  m_table[b] = s;
+  pushFront(s);
+  return bitmap(s);
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Least recently used cache of unpacked glyph bitmaps (AssetFont.h).
+ *
+ * One allocation of the configured budget holds everything: equal slots of
+ * the largest bitmap size of the fonts in use, their LRU links and an
+ * open-addressing table from key to slot. A lookup or insert is O(1) and
+ * never allocates; when all slots are taken the least recently used glyph
+ * is overwritten.
+ *
+ * Not thread safe; used from the LVGL task only.
+ */
+
+class GlyphCache {
+public:
+    struct Stats {
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+        uint32_t evictions = 0;
+        uint16_t slots = 0;     // capacity in glyphs
+        uint16_t used = 0;      // slots holding a glyph, filled in order
+        uint16_t slotBytes = 0; // bitmap bytes per slot
+        size_t bytes = 0;       // allocated, metadata included
+    };
+
+    GlyphCache() = default;
+    ~GlyphCache() { end(); }
+
+    /**
+     * Allocate budget bytes with heap_caps_malloc(caps) and split them into
+     * slots of slotBytes. False if that leaves fewer than two slots or the
+     * allocation fails. Any earlier contents are dropped; stats are kept.
+     */
+    bool begin(size_t budget, uint32_t caps, uint16_t slotBytes);
+    void end();
+
+    bool isActive() const { return m_mem != nullptr; }
+    uint16_t slotBytes() const { return m_stats.slotBytes; }
+
+    /** Bitmap cached for key (now most recently used), or nullptr. */
+    const uint8_t* find(uint32_t key);
+
+    /**
+     * Slot of slotBytes() to fill with the bitmap of key, which must not be
+     * cached yet; evicts the least recently used glyph if needed.
+     */
+    uint8_t* insert(uint32_t key);
+
+    const Stats& stats() const { return m_stats; }
+    void resetStats();
+
+private:
+    static constexpr uint16_t NONE = 0xFFFF;
+
+    struct Slot {
+        uint32_t key;
+        uint16_t prev; // towards the most recently used
+        uint16_t next;
+    };
+
+    uint32_t bucketOf(uint32_t key) const;
+    uint16_t lookup(uint32_t key) const;
+    void unlink(uint16_t slot);
+    void pushFront(uint16_t slot);
+    void removeFromTable(uint16_t slot);
+    uint8_t* bitmap(uint16_t slot) const { return m_data + (size_t)slot * m_stats.slotBytes; }
+
+    void* m_mem = nullptr;
+    Slot* m_slots = nullptr;
+    uint16_t* m_table = nullptr; // slot index per bucket, NONE if empty
+    uint32_t m_tableMask = 0;
+    uint8_t* m_data = nullptr;
+    uint16_t m_head = NONE; // most recently used
+    uint16_t m_tail = NONE; // least recently used
+    Stats m_stats;
+};
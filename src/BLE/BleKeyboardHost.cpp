@@ -4,303 +4,644 @@
 #include "NimBLELog.h"
 #include "lvgl.h"
 
+#ifndef NATIVE
+#if defined(CONFIG_NIMBLE_CPP_IDF)
+#include "host/ble_gap.h"
+#include "host/ble_gatt.h"
+#include "host/ble_hs.h"
+#else
+#include "nimble/nimble/host/include/host/ble_gap.h"
+#include "nimble/nimble/host/include/host/ble_gatt.h"
+#include "nimble/nimble/host/include/host/ble_hs.h"
+#endif
+#endif
+
 static const char* LOG_TAG = "BLEKeyboardHost";
 
 ClientCallbacks clientCallbacks;
 ScanCallbacks scanCallbacks;
 
-void defaultNotifyCB(NimBLERemoteCharacteristic *pRemoteCharacteristic,
-                     uint8_t *pData, size_t length, bool isNotify) {
+void defaultNotifyCB(uint16_t connHandle, uint16_t handle, uint8_t *pData,
+                     size_t length, bool isNotify) {
   NIMBLE_LOGI(LOG_TAG, "notification received, please implement your own callback");
 }
 
+static struct ble_gap_event_listener s_gapListener;
+
+static void resetParser(HidPeer &peer) {
+  peer.modifiers = 0;
+  memset(peer.keys, 0, sizeof(peer.keys));
+  memset(peer.keyReport, 0, sizeof(peer.keyReport));
+  memset(peer.keyCodes, 0, sizeof(peer.keyCodes));
+}
+
 BleKeyboardHost::BleKeyboardHost()
-    : m_doConnect(false), m_isConnected(false), m_scanTimeMs(0),
-      m_advDevice(nullptr), m_notifyCB(defaultNotifyCB) {}
+    : m_doConnect(false), m_advDevice(nullptr), m_scanTimeMs(0),
+      m_connecting(nullptr), m_layout(LAYOUT_US),
+      m_notifyCB(defaultNotifyCB), m_lastInputMs(0u - CONN_TYPING_HOLD_MS) {
+  for (uint8_t i = 0; i < HID_MAX_PEERS; i++) {
+    HidPeer &peer = m_peers[i];
+    peer.slot = i;
+    peer.isConnected = false;
+    peer.connHandle = BLE_HS_CONN_HANDLE_NONE;
+    peer.tryCached = false;
+    peer.cache.clear();
+    resetParser(peer);
+  }
+}
 
 void BleKeyboardHost::begin(uint32_t scanTimeMs) {
   m_scanTimeMs = scanTimeMs;
   NimBLEDevice::init("NimBLE-Client");
   NimBLEDevice::setPower(3); /** 3dbm */
+  // Bond, so peers can be reconnected later without pairing again
+  NimBLEDevice::setSecurityAuth(true, false, true);
   NimBLEScan *pScan = NimBLEDevice::getScan();
   
   // Create scan callbacks with pointer to this host
   scanCallbacks.setHost(this);
   pScan->setScanCallbacks(&scanCallbacks, false);
-  pScan->setInterval(100);
-  pScan->setWindow(100);
+  pScan->setInterval(SCAN_IDLE_INTERVAL_MS);
+  pScan->setWindow(SCAN_IDLE_WINDOW_MS);
+
+  // Reports are taken straight from the GAP event stream, so they arrive
+  // whether or not the characteristics were discovered on this connection
+  ble_gap_event_listener_register(&s_gapListener, gapEventHandler, this);
+
+  for (HidPeer &peer : m_peers) {
+    // Only trust the cache while NimBLE still holds the bond
+    if (bondCacheLoad(peer.slot, peer.cache) &&
+        !NimBLEDevice::isBonded(peer.cache.getAddress())) {
+      NIMBLE_LOGI(LOG_TAG, "Cached peer %d is no longer bonded", peer.slot);
+      forgetCachedKeyboard(peer.slot);
+    }
+    peer.tryCached = peer.cache.valid();
+  }
 }
 
 void BleKeyboardHost::tick() {
+  // Directed reconnects to cached peers first, one attempt each, then scan
+  for (HidPeer &peer : m_peers) {
+    if (peer.isConnected || !peer.tryCached)
+      continue;
+    peer.tryCached = false;
+    if (connectCached(peer))
+      NIMBLE_LOGI(LOG_TAG, "Reconnected to cached peer %d", peer.slot);
+    else
+      NIMBLE_LOGE(LOG_TAG, "Cached reconnect of peer %d failed", peer.slot);
+  }
   if (m_doConnect) {
     m_doConnect = false;
     /** Found a device we want to connect to, do it now */
     if (connectToServer()) {
-      m_isConnected = true;
       NIMBLE_LOGI(LOG_TAG, "Success! we should now be getting notifications!");
     } else {
       NIMBLE_LOGE(LOG_TAG, "Failed to connect, starting scan");
     }
   }
-  if (!m_isConnected) {
-    if (!NimBLEDevice::getScan()->isScanning()) {
+
+  if (m_connPolicy.update(millis(), m_lastInputMs))
+    applyConnParams();
+
+  // Keep looking for further HID peers while there is room for one
+  uint8_t connected = connectedCount();
+  NimBLEScan *pScan = NimBLEDevice::getScan();
+  if (connected < HID_MAX_PEERS && !pScan->isScanning()) {
+    if (connected == 0) {
       NIMBLE_LOGI(LOG_TAG, "No connection, scanning for peripherals");
-      NimBLEDevice::getScan()->start(m_scanTimeMs, false, true);
+      pScan->setInterval(SCAN_IDLE_INTERVAL_MS);
+      pScan->setWindow(SCAN_IDLE_WINDOW_MS);
+    } else {
+      pScan->setInterval(SCAN_CONNECTED_INTERVAL_MS);
+      pScan->setWindow(SCAN_CONNECTED_WINDOW_MS);
     }
+    pScan->start(m_scanTimeMs, false, true);
   }
 }
 
-void BleKeyboardHost::setNotifyCB(
-    void (*notifyCB)(NimBLERemoteCharacteristic *pRemoteCharacteristic,
-                     uint8_t *pData, size_t length, bool isNotify)) {
+void BleKeyboardHost::applyConnParams() {
+  const ConnParams &p = m_connPolicy.params();
+  NIMBLE_LOGI(LOG_TAG, "Connection mode %s: interval %d-%d, latency %d, timeout %d",
+              connModeName(m_connPolicy.mode()), p.minInterval, p.maxInterval,
+              p.latency, p.timeout);
+  for (HidPeer &peer : m_peers) {
+    if (!peer.isConnected)
+      continue;
+    NimBLEClient *pClient = NimBLEDevice::getClientByHandle(peer.connHandle);
+    // The result arrives as BLE_GAP_EVENT_CONN_UPDATE, see gapEventHandler()
+    if (pClient)
+      pClient->updateConnParams(p.minInterval, p.maxInterval, p.latency,
+                                p.timeout);
+  }
+}
+
+void BleKeyboardHost::setNotifyCB(HidReportCB notifyCB) {
   m_notifyCB = notifyCB;
 }
 
+uint8_t BleKeyboardHost::connectedCount() const {
+  uint8_t n = 0;
+  for (const HidPeer &peer : m_peers)
+    n += peer.isConnected ? 1 : 0;
+  return n;
+}
+
+bool BleKeyboardHost::isConnectedTo(const NimBLEAddress &address) const {
+  for (const HidPeer &peer : m_peers) {
+    if (peer.isConnected && peer.address == address)
+      return true;
+  }
+  return false;
+}
+
+HidPeer *BleKeyboardHost::peerByConnHandle(uint16_t connHandle) {
+  if (connHandle == BLE_HS_CONN_HANDLE_NONE)
+    return nullptr;
+  for (HidPeer &peer : m_peers) {
+    if (peer.connHandle == connHandle)
+      return &peer;
+  }
+  return nullptr;
+}
+
+HidPeer *BleKeyboardHost::peerForAddress(const NimBLEAddress &address) {
+  // The slot that caches this device, else an unused one, else any free one
+  // (whose cached device then falls back to scanning)
+  for (HidPeer &peer : m_peers) {
+    if (peer.cache.valid() && peer.cache.getAddress() == address)
+      return peer.isConnected ? nullptr : &peer;
+  }
+  for (HidPeer &peer : m_peers) {
+    if (!peer.isConnected && !peer.cache.valid())
+      return &peer;
+  }
+  for (HidPeer &peer : m_peers) {
+    if (!peer.isConnected)
+      return &peer;
+  }
+  return nullptr;
+}
+
 bool BleKeyboardHost::connectToServer() {
-  NimBLEClient *pClient = nullptr;
+  const NimBLEAddress address = m_advDevice->getAddress();
+  HidPeer *peer = peerForAddress(address);
+  if (!peer) {
+    NIMBLE_LOGE(LOG_TAG, "No free peer slot for %s", address.toString().c_str());
+    return false;
+  }
+  return connectTo(*peer, address);
+}
 
-  /** Check if we have a client we should reuse first **/
-  if (NimBLEDevice::getCreatedClientCount()) {
-    /**
-     *  Special case when we already know this device, we send false as the
-     *  second argument in connect() to prevent refreshing the service database.
-     *  This saves considerable time and power.
-     */
-    pClient = NimBLEDevice::getClientByPeerAddress(m_advDevice->getAddress());
-    if (pClient) {
-      if (!pClient->connect(m_advDevice, false)) {
-        NIMBLE_LOGE(LOG_TAG, "Reconnect failed");
-        return false;
-      }
-      NIMBLE_LOGI(LOG_TAG, "Reconnected client");
-    } else {
-      /**
-       *  We don't already have a client that knows this device,
-       *  check for a client that is disconnected that we can use.
-       */
-      pClient = NimBLEDevice::getDisconnectedClient();
-    }
+bool BleKeyboardHost::connectCached(HidPeer &peer) {
+  if (!peer.cache.valid())
+    return false;
+  if (NimBLEDevice::getScan()->isScanning())
+    NimBLEDevice::getScan()->stop();
+  return connectTo(peer, peer.cache.getAddress());
+}
+
+void BleKeyboardHost::forgetCachedKeyboard(uint8_t slot) {
+  if (slot >= HID_MAX_PEERS)
+    return;
+  bondCacheClear(slot);
+  m_peers[slot].cache.clear();
+  m_peers[slot].tryCached = false;
+}
+
+void BleKeyboardHost::onPeerConnected(NimBLEClient *pClient) {
+  // Set here, in the host task, so reports arriving before connect() returns
+  // are already routed
+  if (m_connecting)
+    m_connecting->connHandle = pClient->getConnHandle();
+}
+
+void BleKeyboardHost::onPeerDisconnected(NimBLEClient *pClient) {
+  const NimBLEAddress address = pClient->getPeerAddress();
+  for (HidPeer &peer : m_peers) {
+    if (peer.connHandle == BLE_HS_CONN_HANDLE_NONE || !(peer.address == address))
+      continue;
+    peer.isConnected = false;
+    peer.connHandle = BLE_HS_CONN_HANDLE_NONE;
+    // No release reports will arrive any more
+    releaseAllKeys(peer);
+    // Come back through the cache first, then scanning
+    peer.tryCached = peer.cache.valid();
+    NIMBLE_LOGI(LOG_TAG, "Peer %d disconnected", peer.slot);
   }
+}
+
+NimBLEClient *BleKeyboardHost::acquireClient(const NimBLEAddress &address,
+                                             bool &created) {
+  created = false;
+  /** Check if we have a client we should reuse first **/
+  NimBLEClient *pClient = NimBLEDevice::getClientByPeerAddress(address);
+  if (!pClient)
+    pClient = NimBLEDevice::getDisconnectedClient();
+  if (pClient)
+    return pClient;
 
   /** No client to reuse? Create a new one. */
-  if (!pClient) {
-    if (NimBLEDevice::getCreatedClientCount() >= NIMBLE_MAX_CONNECTIONS) {
-      NIMBLE_LOGE(LOG_TAG, "Max clients reached - no more connections available");
-      return false;
-    }
+  if (NimBLEDevice::getCreatedClientCount() >= NIMBLE_MAX_CONNECTIONS) {
+    NIMBLE_LOGE(LOG_TAG, "Max clients reached - no more connections available");
+    return nullptr;
+  }
 
-    pClient = NimBLEDevice::createClient();
+  pClient = NimBLEDevice::createClient();
+  created = true;
 
-    NIMBLE_LOGI(LOG_TAG, "New client created");
+  NIMBLE_LOGI(LOG_TAG, "New client created");
 
-    clientCallbacks.setHost(this);
-    pClient->setClientCallbacks(&clientCallbacks, false);
-    /**
-     *  Set initial connection parameters:
-     *  These settings are safe for 3 clients to connect reliably, can go faster
-     * if you have less connections. Timeout should be a multiple of the
-     * interval, minimum is 100ms. Min interval: 12 * 1.25ms = 15, Max interval:
-     * 12 * 1.25ms = 15, 0 latency, 150 * 10ms = 1500ms timeout
-     */
-    pClient->setConnectionParams(12, 12, 0, 150);
+  clientCallbacks.setHost(this);
+  pClient->setClientCallbacks(&clientCallbacks, false);
+  /**
+   *  Set initial connection parameters from the current ConnParamPolicy
+   * mode; tick() renegotiates them as the mode changes. Timeout should be a
+   * multiple of the interval, minimum is 100ms.
+   */
+  const ConnParams &p = m_connPolicy.params();
+  pClient->setConnectionParams(p.minInterval, p.maxInterval, p.latency,
+                               p.timeout);
 
-    /** Set how long we are willing to wait for the connection to complete
-     * (milliseconds), default is 30000. */
-    pClient->setConnectTimeout(5 * 1000);
+  /** Set how long we are willing to wait for the connection to complete
+   * (milliseconds), default is 30000. */
+  pClient->setConnectTimeout(5 * 1000);
+  return pClient;
+}
 
-    if (!pClient->connect(m_advDevice)) {
-      /** Created a client but failed to connect, don't need to keep it as it
-       * has no data */
-      NimBLEDevice::deleteClient(pClient);
-      NIMBLE_LOGE(LOG_TAG, "Failed to connect, deleted client");
-      return false;
-    }
-  }
+bool BleKeyboardHost::connectTo(HidPeer &peer, const NimBLEAddress &address) {
+  // Cached handles make the GATT database unnecessary
+  bool cached = peer.cache.valid() && peer.cache.getAddress() == address;
+
+  bool created;
+  NimBLEClient *pClient = acquireClient(address, created);
+  if (!pClient)
+    return false;
 
+  peer.address = address;
+  resetParser(peer);
   if (!pClient->isConnected()) {
-    if (!pClient->connect(m_advDevice)) {
-      NIMBLE_LOGE(LOG_TAG, "Failed to connect");
+    /**
+     *  Special case when we already know this device, we send false as the
+     *  second argument in connect() to prevent refreshing the service database.
+     *  This saves considerable time and power.
+     */
+    bool known = pClient->getPeerAddress() == address;
+    m_connecting = &peer;
+    bool ok = pClient->connect(address, !known);
+    m_connecting = nullptr;
+    if (!ok) {
+      /** Created a client but failed to connect, don't need to keep it as it
+       * has no data */
+      if (created)
+        NimBLEDevice::deleteClient(pClient);
+      NIMBLE_LOGE(LOG_TAG, "Failed to connect to %s",
+                  address.toString().c_str());
+      peer.connHandle = BLE_HS_CONN_HANDLE_NONE;
       return false;
     }
   }
+  peer.connHandle = pClient->getConnHandle();
 
   NIMBLE_LOGI(LOG_TAG, "Connected to: %s RSSI: %d",
                 pClient->getPeerAddress().toString().c_str(),
                 pClient->getRssi());
 
-  pClient->secureConnection(); // This fixes write error 261 (insufficient
-                               // auth)! or in ESP-IDF stack, call
-                               // `ble_gap_security_initiate(uint16_t
-                               // conn_handle);`
+  // This fixes write error 261 (insufficient auth)! or in ESP-IDF stack, call
+  // `ble_gap_security_initiate(uint16_t conn_handle);`. With a bond this
+  // only restores encryption from the stored keys.
+  if (!pClient->secureConnection() && cached) {
+    // The keyboard lost its half of the bond: pair again from scratch
+    NIMBLE_LOGE(LOG_TAG, "Encryption with cached keyboard failed");
+    pClient->disconnect();
+    forgetCachedKeyboard(peer.slot);
+    return false;
+  }
+
+  bool subscribed = cached ? restoreSubscriptions(peer, pClient)
+                           : discoverAndSubscribe(peer, pClient);
+  if (!subscribed) {
+    pClient->disconnect();
+    if (cached)
+      forgetCachedKeyboard(peer.slot); // rediscover on the next connection
+    return false;
+  }
+
+  peer.isConnected = true;
+  NIMBLE_LOGI(LOG_TAG, "Done with this device! (peer %d, %d connected)",
+              peer.slot, connectedCount());
+  return true;
+}
+
+bool BleKeyboardHost::restoreSubscriptions(HidPeer &peer,
+                                           NimBLEClient *pClient) {
+  // Rewrite the CCCDs; bonded HID devices normally keep them, but this is
+  // cheap and covers keyboards that do not
+  for (uint8_t i = 0; i < peer.cache.reportCount; i++) {
+    const CachedReport &r = peer.cache.reports[i];
+    if (r.cccdHandle == 0)
+      continue;
+    uint8_t value[2] = {(uint8_t)(r.cccdValue & 0xFF), (uint8_t)(r.cccdValue >> 8)};
+    int rc = ble_gattc_write_flat(pClient->getConnHandle(), r.cccdHandle, value,
+                                  sizeof(value), nullptr, nullptr);
+    if (rc != 0) {
+      NIMBLE_LOGE(LOG_TAG, "CCCD write to handle %d failed, rc=%d",
+                  r.cccdHandle, rc);
+      return false;
+    }
+  }
+  NIMBLE_LOGI(LOG_TAG, "Restored %d cached report subscriptions",
+              peer.cache.reportCount);
+  return true;
+}
 
+bool BleKeyboardHost::discoverAndSubscribe(HidPeer &peer,
+                                           NimBLEClient *pClient) {
   /** Now we can read/write/subscribe the characteristics of the services we are
    * interested in */
-  NimBLERemoteService *pSvc = nullptr;
-  NimBLERemoteCharacteristic *pChr = nullptr;
-  NimBLERemoteDescriptor *pDsc = nullptr;
-
-  pSvc = pClient->getService(UUID_HID_SERVICE);
-  if (pSvc) {
-    // Get ALL characteristics with UUID_REPORT (there might be multiple for
-    // different report types)
-    const std::vector<NimBLERemoteCharacteristic *> characteristics =
-        pSvc->getCharacteristics(true);
-    if (characteristics.size() > 0) {
-      NIMBLE_LOGI(LOG_TAG, "Found %d characteristics with UUID_REPORT",
-                    characteristics.size());
-
-      for (auto chr : characteristics) {
-        NIMBLE_LOGI(LOG_TAG,
-            "Characteristic handle: %d, canNotify: %s, canIndicate: %s\n",
-            chr->getHandle(), chr->canNotify() ? "true" : "false",
-            chr->canIndicate() ? "true" : "false");
-
-        if (chr->canNotify()) {
-          if (!chr->subscribe(true, m_notifyCB)) {
-            NIMBLE_LOGE(LOG_TAG, "Failed to subscribe to notifications on handle %d",
-                          chr->getHandle());
-            pClient->disconnect();
-            return false;
-          }
-          NIMBLE_LOGI(LOG_TAG, "Subscribed to notifications on handle %d",
-                        chr->getHandle());
-        } else if (chr->canIndicate()) {
-          if (!chr->subscribe(false, m_notifyCB)) {
-            NIMBLE_LOGE(LOG_TAG, "Failed to subscribe to indications on handle %d",
-                          chr->getHandle());
-            pClient->disconnect();
-            return false;
-          }
-          NIMBLE_LOGI(LOG_TAG, "Subscribed to indications on handle %d",
-                        chr->getHandle());
-        }
+  NimBLERemoteService *pSvc = pClient->getService(UUID_HID_SERVICE);
+  if (!pSvc) {
+    NIMBLE_LOGE(LOG_TAG, "UUID_HID_SERVICE service not found.");
+    return true;
+  }
+
+  // Get ALL characteristics of the service; there is one Report
+  // characteristic per report ID and type
+  const std::vector<NimBLERemoteCharacteristic *> characteristics =
+      pSvc->getCharacteristics(true);
+  if (characteristics.size() == 0) {
+    NIMBLE_LOGE(LOG_TAG, "No characteristics found with UUID_REPORT");
+    return false;
+  }
+  NIMBLE_LOGI(LOG_TAG, "Found %d characteristics in the HID service",
+                (int)characteristics.size());
+
+  peer.cache.clear();
+  peer.cache.setAddress(pClient->getPeerAddress());
+  bool haveMap = readReportMap(peer, pSvc);
+
+  for (auto chr : characteristics) {
+    if (!(chr->getUUID() == UUID_REPORT))
+      continue;
+    NIMBLE_LOGI(LOG_TAG,
+        "Characteristic handle: %d, canNotify: %s, canIndicate: %s\n",
+        chr->getHandle(), chr->canNotify() ? "true" : "false",
+        chr->canIndicate() ? "true" : "false");
+
+    bool notify = chr->canNotify();
+    if (!notify && !chr->canIndicate())
+      continue;
+
+    CachedReport report = {};
+    report.valueHandle = chr->getHandle();
+    report.cccdValue = notify ? 0x0001 : 0x0002;
+
+    // Report Reference: report ID and type. Only input reports whose layout
+    // carries keys are worth a subscription (not mouse, battery, vendor...)
+    NimBLERemoteDescriptor *pRef = chr->getDescriptor(UUID_REPORT_REFERENCE);
+    if (pRef) {
+      NimBLEAttValue ref = pRef->readValue();
+      if (ref.size() >= 2) {
+        report.reportId = ref.data()[0];
+        report.hasReportId = true;
+        if (ref.data()[1] != HID_REPORT_TYPE_INPUT)
+          continue;
       }
-    } else {
-      NIMBLE_LOGE(LOG_TAG, "No characteristics found with UUID_REPORT");
-      pClient->disconnect();
+    }
+    // The boot keyboard fallback layout has no IDs
+    if (!haveMap)
+      report.hasReportId = false;
+    if (haveMap && report.hasReportId) {
+      int idx = peer.cache.reportMap.indexOf(report.reportId);
+      if (idx < 0 || !peer.cache.reportMap.reports[idx].hasKeys()) {
+        NIMBLE_LOGI(LOG_TAG, "Skipping report ID %d on handle %d (no keys)",
+                    report.reportId, report.valueHandle);
+        continue;
+      }
+    }
+
+    // Record the handle before subscribing so the first report is routed
+    NimBLERemoteDescriptor *pDsc = chr->getDescriptor(UUID_CCCD);
+    report.cccdHandle = pDsc ? pDsc->getHandle() : 0;
+    if (!peer.cache.addReport(report)) {
+      NIMBLE_LOGE(LOG_TAG, "Too many reports, handle %d not cached",
+                  chr->getHandle());
+    }
+
+    // Reports are delivered by gapEventHandler(), not a per-characteristic
+    // callback
+    if (!chr->subscribe(notify, nullptr)) {
+      NIMBLE_LOGE(LOG_TAG, "Failed to subscribe to %s on handle %d",
+                    notify ? "notifications" : "indications", chr->getHandle());
       return false;
     }
-  } else {
-    NIMBLE_LOGE(LOG_TAG, "UUID_HID_SERVICE service not found.");
+    NIMBLE_LOGI(LOG_TAG, "Subscribed to %s on handle %d",
+                  notify ? "notifications" : "indications", chr->getHandle());
   }
 
-  NIMBLE_LOGI(LOG_TAG, "Done with this device!");
+  // Pairing completed in secureConnection(), so the bond exists by now
+  if (NimBLEDevice::isBonded(pClient->getPeerAddress())) {
+    peer.cache.version = BOND_CACHE_VERSION;
+    bondCacheSave(peer.slot, peer.cache);
+  }
   return true;
 }
 
+bool BleKeyboardHost::readReportMap(HidPeer &peer, NimBLERemoteService *pSvc) {
+  // Read once per bond; the parsed layout is cached with the handles
+  NimBLERemoteCharacteristic *pMap = pSvc->getCharacteristic(UUID_REPORT_MAP);
+  if (pMap) {
+    NimBLEAttValue desc = pMap->readValue();
+    if (hidParseReportMap(desc.data(), desc.size(), peer.cache.reportMap)) {
+      NIMBLE_LOGI(LOG_TAG, "Report Map: %d bytes, %d input reports%s",
+                  (int)desc.size(), peer.cache.reportMap.count,
+                  peer.cache.reportMap.usesReportIds ? " with IDs" : "");
+      return true;
+    }
+  }
+  // Every HID keyboard must also be able to send boot reports
+  NIMBLE_LOGE(LOG_TAG, "Report Map unusable, assuming boot keyboard reports");
+  peer.cache.reportMap = hidBootKeyboardMap();
+  return false;
+}
+
+int BleKeyboardHost::gapEventHandler(struct ble_gap_event *event, void *arg) {
+  BleKeyboardHost *host = static_cast<BleKeyboardHost *>(arg);
+
+  if (event->type == BLE_GAP_EVENT_CONN_UPDATE) {
+    // Log what was actually negotiated; the peripheral may pick anything in
+    // the requested range or refuse
+    HidPeer *peer = host->peerByConnHandle(event->conn_update.conn_handle);
+    NimBLEClient *pClient =
+        NimBLEDevice::getClientByHandle(event->conn_update.conn_handle);
+    if (peer && pClient) {
+      NimBLEConnInfo info = pClient->getConnInfo();
+      NIMBLE_LOGI(LOG_TAG, "Peer %d conn params (status %d): interval %d "
+                  "(x1.25 ms), latency %d, timeout %d (x10 ms)",
+                  peer->slot, event->conn_update.status,
+                  info.getConnInterval(), info.getConnLatency(),
+                  info.getConnTimeout());
+    }
+    return 0;
+  }
+
+  if (event->type != BLE_GAP_EVENT_NOTIFY_RX)
+    return 0;
+
+  uint16_t connHandle = event->notify_rx.conn_handle;
+  HidPeer *peer = host->peerByConnHandle(connHandle);
+  if (!peer || !peer->cache.hasReport(event->notify_rx.attr_handle))
+    return 0;
+
+  // Reports are at most a few dozen bytes; copy out of the mbuf chain
+  uint8_t buf[64];
+  uint16_t len = OS_MBUF_PKTLEN(event->notify_rx.om);
+  if (len > sizeof(buf))
+    len = sizeof(buf);
+  if (os_mbuf_copydata(event->notify_rx.om, 0, len, buf) != 0)
+    return 0;
+
+  host->m_notifyCB(connHandle, event->notify_rx.attr_handle, buf, len,
+                   !event->notify_rx.indication);
+  return 0;
+}
+
 bool BleKeyboardHost::hasKey() {
-  return !keyQueue.empty();
+  for (const HidPeer &peer : m_peers) {
+    if (!peer.keyQueue.empty())
+      return true;
+  }
+  return false;
 }
 
 KeyEvent BleKeyboardHost::getKey() {
-  if (keyQueue.empty()) {
-      return {0, false, 0};
+  // Merge the per-peer streams, oldest event first
+  HidPeer *oldest = nullptr;
+  KeyEvent key, head;
+  for (HidPeer &peer : m_peers) {
+    if (peer.keyQueue.peek(head) &&
+        (!oldest || (int32_t)(head.timestamp - key.timestamp) < 0)) {
+      oldest = &peer;
+      key = head;
+    }
+  }
+  if (!oldest || !oldest->keyQueue.pop(key)) {
+      return {0, false, 0, 0};
   }
-  
-  KeyEvent key = keyQueue.front();
-  keyQueue.pop();
   return key;
 }
 
-void BleKeyboardHost::parseHIDReport(uint8_t* data, size_t length) {
-  if (length < 8) return; // HID keyboard reports are typically 8 bytes
-  
-  // Standard HID keyboard report format:
-  // Byte 0: Modifier keys (Ctrl, Shift, Alt, etc.)
-  // Byte 1: Reserved
-  // Byte 2-7: Key codes (up to 6 keys can be pressed simultaneously)
-  
-  uint8_t modifiers = data[0];
-  uint8_t keycodes[6];
-  memcpy(keycodes, &data[2], 6);
-  
-  // // Process modifier keys
-  // if (modifiers & 0x01) keyQueue.push({LV_KEY_CTRL, true, millis()});
-  // if (modifiers & 0x02) keyQueue.push({LV_KEY_SHIFT, true, millis()});
-  // if (modifiers & 0x04) keyQueue.push({LV_KEY_ALT, true, millis()});
-  // if (modifiers & 0x08) keyQueue.push({LV_KEY_GUI, true, millis()});
-  
-  // Process regular key codes
-  for (int i = 0; i < 6; i++) {
-      if (keycodes[i] != 0) {
-          // Convert HID key codes to LVGL key codes
-          uint16_t lvglKey = convertHIDToLVGL(keycodes[i]);
-          if (lvglKey != 0) {
-              keyQueue.push({lvglKey, true, millis()});
-              keyQueue.push({lvglKey, false, millis() + 1});
-          }
+uint32_t BleKeyboardHost::droppedKeys() const {
+  uint32_t n = 0;
+  for (const HidPeer &peer : m_peers)
+    n += peer.keyQueue.dropped();
+  return n;
+}
+
+static bool containsCode(const HidInputState &state, uint16_t code) {
+  for (int i = 0; i < state.count; i++) {
+    if (state.codes[i] == code)
+      return true;
+  }
+  return false;
+}
+
+static bool isHeld(const HidPeer &peer, uint16_t code) {
+  for (int i = 0; i < HID_KEY_SLOTS; i++) {
+    if (peer.keys[i] == code)
+      return true;
+  }
+  return false;
+}
+
+void BleKeyboardHost::parseHIDReport(uint16_t connHandle, uint16_t handle,
+                                     uint8_t *data, size_t length) {
+  HidPeer *peer = peerByConnHandle(connHandle);
+  if (!peer) return;
+
+  // The field layout comes from the peer's Report Map (boot keyboard layout
+  // if it had none). The report ID is known from the characteristic's Report
+  // Reference; without one, a device using IDs prefixes them to the data.
+  const CachedReport *report = peer->cache.findReport(handle);
+  int reportId = report && report->hasReportId ? report->reportId : -1;
+  HidInputState state;
+  if (!hidDecodeReport(peer->cache.reportMap, reportId, data, length, state))
+    return;
+
+  // A report is the complete set of keys currently down for its report ID,
+  // so it is diffed against the keys that ID reported before: keys that
+  // disappeared are released, keys that appeared are pressed, keys still
+  // down produce nothing. Holding a key or a repeated identical report
+  // therefore never duplicates input, and a media key report does not
+  // release letters held on the keyboard report.
+
+  // Too many keys down: the keyboard fills every slot with ErrorRollOver and
+  // the real state is unknown, so keep the previous one
+  if (state.rollover) return;
+
+  uint32_t now = millis();
+
+  // Modifiers only select the level (Shift/AltGr) later presses are
+  // translated with; LVGL has no events for them. A key already down keeps
+  // the code it was pressed with, so its release always matches.
+  if (state.hasModifiers)
+    peer->modifiers = state.modifiers;
+  uint8_t modifiers = peer->modifiers;
+
+  // Releases first, so a fast roll from A to B arrives as A up, B down
+  for (int i = 0; i < HID_KEY_SLOTS; i++) {
+    if (peer->keys[i] != 0 && peer->keyReport[i] == state.reportIndex &&
+        !containsCode(state, peer->keys[i])) {
+      if (peer->keyCodes[i] != 0)
+        peer->keyQueue.push({peer->keyCodes[i], false, now, modifiers});
+      peer->keys[i] = 0;
+      peer->keyCodes[i] = 0;
+    }
+  }
+
+  for (int i = 0; i < state.count; i++) {
+    uint16_t code = state.codes[i];
+    if (isHeld(*peer, code))
+      continue;
+
+    // Newly pressed: remember it in a free slot
+    for (int slot = 0; slot < HID_KEY_SLOTS; slot++) {
+      if (peer->keys[slot] == 0) {
+        uint32_t lvglKey = convertHIDToLVGL(code, modifiers);
+        peer->keys[slot] = code;
+        peer->keyReport[slot] = state.reportIndex;
+        peer->keyCodes[slot] = lvglKey;
+        if (lvglKey != 0)
+          peer->keyQueue.push({lvglKey, true, now, modifiers});
+        m_lastInputMs = now;
+        break;
       }
+    }
   }
-  
-  // Note: For a complete implementation, you'd also need to track key releases
-  // This would require maintaining a state of currently pressed keys
 }
 
-// Helper function to convert HID key codes to LVGL key codes
-uint16_t BleKeyboardHost::convertHIDToLVGL(uint8_t hidKey) {
-  // Basic mapping - you can expand this based on your needs
-  switch (hidKey) {
-      case 0x04: return 'a'; // A
-      case 0x05: return 'b'; // B
-      case 0x06: return 'c'; // C
-      case 0x07: return 'd'; // D
-      case 0x08: return 'e'; // E
-      case 0x09: return 'f'; // F
-      case 0x0A: return 'g'; // G
-      case 0x0B: return 'h'; // H
-      case 0x0C: return 'i'; // I
-      case 0x0D: return 'j'; // J
-      case 0x0E: return 'k'; // K
-      case 0x0F: return 'l'; // L
-      case 0x10: return 'm'; // M
-      case 0x11: return 'n'; // N
-      case 0x12: return 'o'; // O
-      case 0x13: return 'p'; // P
-      case 0x14: return 'q'; // Q
-      case 0x15: return 'r'; // R
-      case 0x16: return 's'; // S
-      case 0x17: return 't'; // T
-      case 0x18: return 'u'; // U
-      case 0x19: return 'v'; // V
-      case 0x1A: return 'w'; // W
-      case 0x1B: return 'x'; // X
-      case 0x1C: return 'y'; // Y
-      case 0x1D: return 'z'; // Z
-      case 0x1E: return '1'; // 1
-      case 0x1F: return '2'; // 2
-      case 0x20: return '3'; // 3
-      case 0x21: return '4'; // 4
-      case 0x22: return '5'; // 5
-      case 0x23: return '6'; // 6
-      case 0x24: return '7'; // 7
-      case 0x25: return '8'; // 8
-      case 0x26: return '9'; // 9
-      case 0x27: return '0'; // 0
-      case 0x28: return LV_KEY_ENTER; // Enter
-      case 0x29: return LV_KEY_ESC; // Escape
-      case 0x2A: return LV_KEY_BACKSPACE; // Backspace
-      case 0x2B: return '\t'; // Tab
-      case 0x2C: return ' '; // Space
-      case 0x2D: return '-'; // Minus
-      case 0x2E: return '='; // Equal
-      case 0x2F: return '['; // Left bracket
-      case 0x30: return ']'; // Right bracket
-      case 0x31: return '\\'; // Backslash
-      case 0x32: return '#'; // Hash
-      case 0x33: return ';'; // Semicolon
-      case 0x34: return '\''; // Quote
-      case 0x35: return '`'; // Grave
-      case 0x36: return ','; // Comma
-      case 0x37: return '.'; // Period
-      case 0x38: return '/'; // Slash
-      // case 0x39: return LV_KEY_CAPS_LOCK; // Caps Lock
-      case 0x4A: return LV_KEY_HOME; // Home
-      case 0x4B: return LV_KEY_END; // End
-      case 0x4C: return LV_KEY_DEL; // Delete
-      case 0x4D: return LV_KEY_RIGHT; // Right Arrow
-      case 0x4E: return LV_KEY_LEFT; // Left Arrow
-      case 0x4F: return LV_KEY_DOWN; // Down Arrow
-      case 0x50: return LV_KEY_UP; // Up Arrow
-      default: return 0; // Unknown key
-  }
-}
\ No newline at end of file
+void BleKeyboardHost::releaseAllKeys(HidPeer &peer) {
+  uint32_t now = millis();
+  for (int i = 0; i < HID_KEY_SLOTS; i++) {
+    if (peer.keys[i] != 0 && peer.keyCodes[i] != 0)
+      peer.keyQueue.push({peer.keyCodes[i], false, now, 0});
+    peer.keys[i] = 0;
+    peer.keyCodes[i] = 0;
+  }
+  peer.modifiers = 0;
+}
+
+// Translate a decoded key to an LVGL key using the selected layout
+uint32_t BleKeyboardHost::convertHIDToLVGL(uint16_t hidCode, uint8_t modifiers) {
+  if (hidCode & HID_CONSUMER_FLAG)
+    return hidConsumerToKey(hidCode & ~HID_CONSUMER_FLAG);
+  return hidCode < HID_KEYMAP_SIZE ? hidUsageToKey(m_layout, hidCode, modifiers)
+                                   : 0;
+}
+
+void BleKeyboardHost::setLayout(KeyboardLayout layout) {
+  if (layout >= LAYOUT_COUNT) return;
+  m_layout = layout;
+  NIMBLE_LOGI(LOG_TAG, "Keyboard layout: %s", keyboardLayoutName(layout));
+}
+
+void BleKeyboardHost::noteTextInput() { m_lastInputMs = millis(); }
@@ -1,17 +1,69 @@
 #pragma once
 
 #include <Arduino.h>
-#include <queue>
 #include <NimBLEDevice.h>
+#include <atomic>
+#include "../Util/SpscRing.h"
+#include "BondCache.h"
+#include "ConnParamPolicy.h"
+#include "HidKeymap.h"
+#include "HidReportDescriptor.h"
 
 #define UUID_HID_SERVICE NimBLEUUID((uint16_t)0x1812)
 #define UUID_REPORT NimBLEUUID((uint16_t)0x2A4D)
+#define UUID_REPORT_MAP NimBLEUUID((uint16_t)0x2A4B)
+#define UUID_REPORT_REFERENCE NimBLEUUID((uint16_t)0x2908)
+#define HID_REPORT_TYPE_INPUT 0x01
 #define APPEARANCE_KEYBOARD ((uint16_t)0x03C1)
 
 struct KeyEvent {
-    uint16_t keycode;
+    uint32_t keycode; // LVGL key: LV_KEY_* or UTF-8 packed character
     bool pressed;
     uint32_t timestamp;
+    uint8_t modifiers; // HID modifier byte at the time of the event
+};
+
+// Keys (keyboard and consumer usages) tracked as held, per peer
+#define HID_KEY_SLOTS HID_MAX_KEYS_DOWN
+
+// Key events buffered between the NimBLE host task (producer) and the LVGL
+// task (consumer). Must be a power of two.
+#define KEY_QUEUE_SIZE 64
+
+#define UUID_CCCD NimBLEUUID((uint16_t)0x2902)
+
+// HID peers (keyboards, barcode scanners, ...) connected at the same time
+#define HID_MAX_PEERS NIMBLE_MAX_CONNECTIONS
+
+// Scan duty cycle (ms) with nothing connected, and while looking for an
+// additional peer next to connected ones (kept low to spare their latency)
+#define SCAN_IDLE_INTERVAL_MS 100
+#define SCAN_IDLE_WINDOW_MS 100
+#define SCAN_CONNECTED_INTERVAL_MS 200
+#define SCAN_CONNECTED_WINDOW_MS 20
+
+// Receives every input report of every connected peer, in the NimBLE host
+// task. handle is the report's characteristic value handle.
+typedef void (*HidReportCB)(uint16_t connHandle, uint16_t handle, uint8_t* pData, size_t length, bool isNotify);
+
+// Connection, parser and key stream state of one HID peer
+struct HidPeer {
+    uint8_t slot; // index in the peer table, also its bond cache slot
+    volatile bool isConnected;
+    volatile uint16_t connHandle; // set by ClientCallbacks::onConnect
+    bool tryCached; // a directed reconnect to cache is due
+    NimBLEAddress address;
+    // Address, Report Map and subscribed report handles, restored from /
+    // saved to the bond cache
+    BondedKeyboard cache;
+    // Keys down per the previous report of each report ID, diffed against the
+    // next one so only real press/release edges are queued
+    uint8_t modifiers;
+    uint16_t keys[HID_KEY_SLOTS];     // HidInputState code, 0 = free slot
+    uint8_t keyReport[HID_KEY_SLOTS]; // reportIndex that reported keys[i]
+    uint32_t keyCodes[HID_KEY_SLOTS]; // LVGL key sent on press of keys[i]
+    // Written by the NimBLE host task, read by the LVGL task
+    SpscRing<KeyEvent, KEY_QUEUE_SIZE> keyQueue;
 };
 
 class BleKeyboardHost {
@@ -19,22 +71,63 @@ public:
     BleKeyboardHost();
     void begin(uint32_t scanTimeMs = 1000);
     void tick();
-    void setNotifyCB(void (*notifyCB)(NimBLERemoteCharacteristic* pRemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify));
+    void setNotifyCB(HidReportCB notifyCB);
 
     bool connectToServer();
+    // Forget a cached peer (the bond itself is kept)
+    void forgetCachedKeyboard(uint8_t slot);
+    uint8_t connectedCount() const;
+    bool isConnectedTo(const NimBLEAddress& address) const;
+
+    // Called by ClientCallbacks, in the NimBLE host task
+    void onPeerConnected(NimBLEClient* pClient);
+    void onPeerDisconnected(NimBLEClient* pClient);
 
     // New methods for key handling
+    // hasKey()/getKey() are for the consumer (LVGL task) only and merge all
+    // peers oldest first; parseHIDReport() is for the producer (NimBLE host
+    // task) only.
     bool hasKey();
     KeyEvent getKey();
-    void parseHIDReport(uint8_t* data, size_t length);
-    uint16_t convertHIDToLVGL(uint8_t hidKey);
+    uint32_t droppedKeys() const;
+    // handle is the report's value handle; it selects the report ID and
+    // thereby the field layout from the peer's Report Map
+    void parseHIDReport(uint16_t connHandle, uint16_t handle, uint8_t* data, size_t length);
+    // hidCode is a HidInputState code: a keyboard usage, or a consumer usage
+    // with HID_CONSUMER_FLAG set
+    uint32_t convertHIDToLVGL(uint16_t hidCode, uint8_t modifiers);
+    // Layout used to translate subsequent key presses. Safe to call from any
+    // task; a key already down keeps the code it was pressed with.
+    void setLayout(KeyboardLayout layout);
+    KeyboardLayout layout() const { return m_layout; }
+    // A text input was clicked: counts as typing, like a key press, for the
+    // connection parameters. Safe to call from any task (the LVGL task).
+    void noteTextInput();
+    ConnMode connMode() const { return m_connPolicy.mode(); }
 
     bool m_doConnect;
-    bool m_isConnected;
     const NimBLEAdvertisedDevice *m_advDevice;
     uint32_t m_scanTimeMs;
 
 private:
-    std::queue<KeyEvent> keyQueue;
-    void (*m_notifyCB)(NimBLERemoteCharacteristic* pRemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify);
+    HidPeer m_peers[HID_MAX_PEERS];
+    HidPeer* m_connecting; // peer whose connect() is in progress
+    volatile KeyboardLayout m_layout;
+    HidReportCB m_notifyCB;
+    ConnParamPolicy m_connPolicy; // loop task only
+    // last key press (host task) or text input click (LVGL task)
+    std::atomic<uint32_t> m_lastInputMs;
+
+    HidPeer* peerByConnHandle(uint16_t connHandle);
+    HidPeer* peerForAddress(const NimBLEAddress& address);
+    // Release every key still held (e.g. on disconnect). Producer side only.
+    void releaseAllKeys(HidPeer& peer);
+    NimBLEClient* acquireClient(const NimBLEAddress& address, bool& created);
+    bool connectCached(HidPeer& peer);
+    bool connectTo(HidPeer& peer, const NimBLEAddress& address);
+    bool discoverAndSubscribe(HidPeer& peer, NimBLEClient* pClient);
+    bool readReportMap(HidPeer& peer, NimBLERemoteService* pSvc);
+    bool restoreSubscriptions(HidPeer& peer, NimBLEClient* pClient);
+    void applyConnParams();
+    static int gapEventHandler(struct ble_gap_event* event, void* arg);
 };
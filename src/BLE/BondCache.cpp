@@ -0,0 +1,90 @@
+#include "BondCache.h"
+#include "NimBLELog.h"
+
+#include <Preferences.h>
+
+static const char *LOG_TAG = "BondCache";
+static const char *NVS_NAMESPACE = "blekbd";
+
+void BondedKeyboard::clear() { memset(this, 0, sizeof(*this)); }
+
+void BondedKeyboard::setAddress(const NimBLEAddress &addr) {
+  memcpy(address, addr.getVal(), sizeof(address));
+  addressType = addr.getType();
+}
+
+bool BondedKeyboard::addReport(const CachedReport &report) {
+  if (hasReport(report.valueHandle))
+    return true;
+  if (reportCount >= BOND_CACHE_MAX_REPORTS)
+    return false;
+  reports[reportCount++] = report;
+  return true;
+}
+
+const CachedReport *BondedKeyboard::findReport(uint16_t valueHandle) const {
+  for (uint8_t i = 0; i < reportCount; i++) {
+    if (reports[i].valueHandle == valueHandle)
+      return &reports[i];
+  }
+  return nullptr;
+}
+
+static void slotKey(uint8_t slot, char *key, size_t len) {
+  snprintf(key, len, "peer%u", slot);
+}
+
+bool bondCacheLoad(uint8_t slot, BondedKeyboard &out) {
+  out.clear();
+  char key[8];
+  slotKey(slot, key, sizeof(key));
+
+  Preferences prefs;
+  if (!prefs.begin(NVS_NAMESPACE, true))
+    return false;
+  bool ok = prefs.getBytesLength(key) == sizeof(out) &&
+            prefs.getBytes(key, &out, sizeof(out)) == sizeof(out) &&
+            out.valid() && out.reportCount <= BOND_CACHE_MAX_REPORTS &&
+            out.reportMap.count <= HID_MAX_REPORTS;
+  prefs.end();
+
+  if (!ok) {
+    out.clear();
+    return false;
+  }
+  NIMBLE_LOGI(LOG_TAG, "Slot %u: %s, %u reports", slot,
+              out.getAddress().toString().c_str(), out.reportCount);
+  return true;
+}
+
+bool bondCacheSave(uint8_t slot, const BondedKeyboard &rec) {
+  BondedKeyboard stored;
+  if (bondCacheLoad(slot, stored) && memcmp(&stored, &rec, sizeof(rec)) == 0)
+    return true;
+
+  char key[8];
+  slotKey(slot, key, sizeof(key));
+  Preferences prefs;
+  if (!prefs.begin(NVS_NAMESPACE, false))
+    return false;
+  BondedKeyboard copy = rec;
+  copy.version = BOND_CACHE_VERSION;
+  bool ok = prefs.putBytes(key, &copy, sizeof(copy)) == sizeof(copy);
+  prefs.end();
+
+  if (ok)
+    NIMBLE_LOGI(LOG_TAG, "Slot %u saved", slot);
+  else
+    NIMBLE_LOGE(LOG_TAG, "Slot %u: NVS write failed", slot);
+  return ok;
+}
+
+void bondCacheClear(uint8_t slot) {
+  char key[8];
+  slotKey(slot, key, sizeof(key));
+  Preferences prefs;
+  if (prefs.begin(NVS_NAMESPACE, false)) {
+    prefs.remove(key);
+    prefs.end();
+  }
+}
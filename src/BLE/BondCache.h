@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Arduino.h>
+#include <NimBLEDevice.h>
+#include "HidReportDescriptor.h"
+
+/**
+ * Per-keyboard data kept in NVS so a bonded keyboard can be reconnected
+ * without scanning or GATT discovery: its address, its parsed Report Map and,
+ * for every subscribed input report, the value handle, report ID and the CCCD
+ * handle and value to restore.
+ *
+ * Attribute handles of a bonded HID device are stable (HOGP), and the bond
+ * itself is kept by NimBLE; this cache only saves the discovery round trips.
+ */
+
+#define BOND_CACHE_MAX_REPORTS 8
+// Bump when the record layout changes; older records are then ignored
+#define BOND_CACHE_VERSION 2
+
+struct CachedReport {
+    uint16_t valueHandle;
+    uint16_t cccdHandle; // 0 if the report has no CCCD
+    uint16_t cccdValue;  // 0x0001 notify, 0x0002 indicate
+    uint8_t reportId;    // from the Report Reference descriptor
+    bool hasReportId;    // false: the ID, if any, prefixes each report
+};
+
+struct BondedKeyboard {
+    uint8_t version;
+    uint8_t addressType;
+    uint8_t address[6];
+    uint8_t reportCount;
+    uint8_t reserved; // keeps the record free of padding (compared with memcmp)
+    CachedReport reports[BOND_CACHE_MAX_REPORTS];
+    HidReportMap reportMap;
+
+    void clear();
+    bool valid() const { return version == BOND_CACHE_VERSION; }
+    NimBLEAddress getAddress() const { return NimBLEAddress(address, addressType); }
+    void setAddress(const NimBLEAddress& addr);
+    bool addReport(const CachedReport& report);
+    const CachedReport* findReport(uint16_t valueHandle) const;
+    bool hasReport(uint16_t valueHandle) const { return findReport(valueHandle) != nullptr; }
+};
+
+/** Read slot's record. Returns false (and a cleared record) if none is stored. */
+bool bondCacheLoad(uint8_t slot, BondedKeyboard& out);
+/** Store the record, skipping the flash write when it is unchanged. */
+bool bondCacheSave(uint8_t slot, const BondedKeyboard& rec);
+void bondCacheClear(uint8_t slot);
@@ -9,13 +9,14 @@ static const char *LOG_TAG = "ClientCallbacks";
 
 void ClientCallbacks::onConnect(NimBLEClient *pClient) {
   NIMBLE_LOGI(LOG_TAG, "Connected");
+  host->onPeerConnected(pClient);
 }
 
 void ClientCallbacks::onDisconnect(NimBLEClient *pClient, int reason) {
   //  Serial.printf("%s Disconnected, reason = %d - Starting scan\n",
   //  pClient->getPeerAddress().toString().c_str(), reason);
   //  NimBLEDevice::getScan()->start(scanTimeMs, false, true);
-  host->m_isConnected = false;
+  host->onPeerDisconnected(pClient);
 }
 
 /********************* Security handled here *********************/
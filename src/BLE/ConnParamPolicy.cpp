@@ -0,0 +1,21 @@
+#include "ConnParamPolicy.h"
+
+const char *connModeName(ConnMode mode) {
+  static const char *const names[CONN_MODE_COUNT] = {"typing", "active",
+                                                     "idle"};
+  return mode < CONN_MODE_COUNT ? names[mode] : "?";
+}
+
+namespace {
+
+// Supervision timeout sanity for every mode (10 ms vs 1.25 ms units)
+constexpr bool timeoutsValid() {
+  for (const ConnParams &p : CONN_PARAMS) {
+    if (p.timeout * 10 * 4 <= (1 + p.latency) * p.maxInterval * 5 * 2)
+      return false;
+  }
+  return true;
+}
+static_assert(timeoutsValid(), "supervision timeout too short");
+
+} // namespace
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Chooses BLE connection parameters from what the user is doing.
+ *
+ *   TYPING  a key was pressed or a text input clicked in the last
+ *           CONN_TYPING_HOLD_MS: shortest interval, no slave latency
+ *   ACTIVE  recently used: the previous fixed 15 ms setting
+ *   IDLE    nothing for CONN_IDLE_AFTER_MS: long interval with slave
+ *           latency, so the keyboard's radio mostly sleeps
+ *
+ * Moving to a faster mode is immediate; slowing down waits for the hold
+ * times and at least CONN_MIN_UPDATE_GAP_MS since the previous request, so
+ * bursts of input do not turn into a stream of parameter updates. Focus
+ * alone is not activity: a screen keeps its text input focused while
+ * nobody types (ui_Main's ui_InputWord).
+ *
+ * Pure: the caller feeds it the clock and the observations and applies the
+ * result (see BleKeyboardHost::tick()).
+ */
+
+#define CONN_TYPING_HOLD_MS 2000
+#define CONN_IDLE_AFTER_MS 15000
+#define CONN_MIN_UPDATE_GAP_MS 1000
+
+enum ConnMode : uint8_t {
+    CONN_MODE_TYPING,
+    CONN_MODE_ACTIVE,
+    CONN_MODE_IDLE,
+    CONN_MODE_COUNT
+};
+
+// Units as in the BLE spec / NimBLE: intervals 1.25 ms, timeout 10 ms
+struct ConnParams {
+    uint16_t minInterval;
+    uint16_t maxInterval;
+    uint16_t latency;
+    uint16_t timeout;
+};
+
+// The supervision timeout must exceed (1 + latency) * maxInterval * 2
+constexpr ConnParams CONN_PARAMS[CONN_MODE_COUNT] = {
+    {6, 6, 0, 150},   // TYPING: 7.5 ms
+    {12, 12, 0, 150}, // ACTIVE: 15 ms
+    {40, 48, 4, 400}, // IDLE: 50-60 ms, skip up to 4 events (~300 ms)
+};
+
+class ConnParamPolicy {
+public:
+    constexpr ConnParamPolicy()
+        : m_mode(CONN_MODE_ACTIVE), m_lastActiveMs(0), m_lastUpdateMs(0),
+          m_hasUpdated(false) {}
+
+    /**
+     * Feed the current state. lastInputMs is the time of the most recent
+     * key press or text input click (nowMs - CONN_TYPING_HOLD_MS if there
+     * was none). Returns true when the mode changed and params() should be
+     * requested from the peers.
+     */
+    constexpr bool update(uint32_t nowMs, uint32_t lastInputMs) {
+        bool inputRecent = (int32_t)(nowMs - lastInputMs) >= 0 &&
+                           nowMs - lastInputMs < CONN_TYPING_HOLD_MS;
+        if (inputRecent)
+            m_lastActiveMs = nowMs;
+
+        ConnMode want = CONN_MODE_TYPING;
+        if (!inputRecent)
+            want = nowMs - m_lastActiveMs < CONN_IDLE_AFTER_MS ? CONN_MODE_ACTIVE
+                                                               : CONN_MODE_IDLE;
+
+        if (want == m_mode)
+            return false;
+        // Slowing down is never urgent
+        if (want > m_mode && m_hasUpdated &&
+            nowMs - m_lastUpdateMs < CONN_MIN_UPDATE_GAP_MS)
+            return false;
+
+        m_mode = want;
+        m_lastUpdateMs = nowMs;
+        m_hasUpdated = true;
+        return true;
+    }
+
+    constexpr ConnMode mode() const { return m_mode; }
+    constexpr const ConnParams &params() const { return CONN_PARAMS[m_mode]; }
+
+private:
+    ConnMode m_mode;
+    uint32_t m_lastActiveMs;
+    uint32_t m_lastUpdateMs;
+    bool m_hasUpdated;
+};
+
+const char *connModeName(ConnMode mode);
@@ -0,0 +1,148 @@
+#include "HidKeymap.h"
+#include "lvgl.h"
+
+namespace {
+
+enum Level { PLAIN, SHIFT, ALTGR, SHIFT_ALTGR, LEVELS };
+
+struct Keymap {
+  uint32_t key[HID_KEYMAP_SIZE][LEVELS];
+};
+
+struct AltGrKey {
+  uint8_t usage;
+  char32_t cp;
+};
+
+// Usages 0x04 (a) .. 0x38 (/) are given per layout as one string per level,
+// in usage order. U'\0' marks Enter, Escape, Backspace and Tab (0x28..0x2B),
+// which are the same for every layout.
+constexpr uint8_t BLOCK_FIRST = 0x04;
+constexpr uint8_t BLOCK_LAST = 0x38;
+constexpr size_t BLOCK_LEN = BLOCK_LAST - BLOCK_FIRST + 1;
+typedef char32_t Block[BLOCK_LEN + 1]; // + terminator of the literal
+
+// Pack a code point as UTF-8, first byte lowest (see lv_textarea_add_char)
+constexpr uint32_t utf8(char32_t cp) {
+  return cp < 0x80    ? (uint32_t)cp
+         : cp < 0x800 ? (uint32_t)(0xC0 | (cp >> 6)) |
+                            (uint32_t)(0x80 | (cp & 0x3F)) << 8
+                      : (uint32_t)(0xE0 | (cp >> 12)) |
+                            (uint32_t)(0x80 | ((cp >> 6) & 0x3F)) << 8 |
+                            (uint32_t)(0x80 | (cp & 0x3F)) << 16;
+}
+
+constexpr void setAllLevels(Keymap &m, uint8_t usage, uint32_t key) {
+  for (int l = 0; l < LEVELS; l++)
+    m.key[usage][l] = key;
+}
+
+constexpr Keymap makeKeymap(const Block &plain, const Block &shift,
+                            char32_t nonUsPlain, char32_t nonUsShift,
+                            const AltGrKey *altGr, size_t altGrCount) {
+  Keymap m{};
+
+  for (size_t i = 0; i < BLOCK_LEN; i++) {
+    m.key[BLOCK_FIRST + i][PLAIN] = utf8(plain[i]);
+    m.key[BLOCK_FIRST + i][SHIFT] = utf8(shift[i]);
+  }
+  m.key[0x64][PLAIN] = utf8(nonUsPlain);
+  m.key[0x64][SHIFT] = utf8(nonUsShift);
+
+  // Keypad, Num Lock assumed on
+  const char32_t keypad[] = U"/*-+\n1234567890.";
+  for (uint8_t u = 0x54; u <= 0x63; u++) {
+    m.key[u][PLAIN] = utf8(keypad[u - 0x54]);
+    m.key[u][SHIFT] = m.key[u][PLAIN];
+  }
+
+  // Without an AltGr mapping a key types its Shift/no-Shift character
+  for (uint8_t u = 0; u < HID_KEYMAP_SIZE; u++) {
+    m.key[u][ALTGR] = m.key[u][PLAIN];
+    m.key[u][SHIFT_ALTGR] = m.key[u][SHIFT];
+  }
+  for (size_t i = 0; i < altGrCount; i++)
+    m.key[altGr[i].usage][ALTGR] = utf8(altGr[i].cp);
+
+  // Layout independent keys
+  setAllLevels(m, 0x28, LV_KEY_ENTER);
+  setAllLevels(m, 0x29, LV_KEY_ESC);
+  setAllLevels(m, 0x2A, LV_KEY_BACKSPACE);
+  setAllLevels(m, 0x2B, LV_KEY_NEXT); // Tab moves the focus...
+  m.key[0x2B][SHIFT] = LV_KEY_PREV;   // ...Shift+Tab back
+  m.key[0x2B][SHIFT_ALTGR] = LV_KEY_PREV;
+  setAllLevels(m, 0x4A, LV_KEY_HOME);
+  setAllLevels(m, 0x4C, LV_KEY_DEL);
+  setAllLevels(m, 0x4D, LV_KEY_END);
+  setAllLevels(m, 0x4F, LV_KEY_RIGHT);
+  setAllLevels(m, 0x50, LV_KEY_LEFT);
+  setAllLevels(m, 0x51, LV_KEY_DOWN);
+  setAllLevels(m, 0x52, LV_KEY_UP);
+  setAllLevels(m, 0x58, LV_KEY_ENTER); // Keypad Enter
+  return m;
+}
+
+// --- US (ANSI) --------------------------------------------------------------
+constexpr Block US_PLAIN = U"abcdefghijklmnopqrstuvwxyz1234567890\0\0\0\0 -=[]\\\\;'`,./";
+constexpr Block US_SHIFT = U"ABCDEFGHIJKLMNOPQRSTUVWXYZ!@#$%^&*()\0\0\0\0 _+{}||:\"~<>?";
+
+// --- UK (ISO) ---------------------------------------------------------------
+constexpr Block UK_PLAIN = U"abcdefghijklmnopqrstuvwxyz1234567890\0\0\0\0 -=[]##;'`,./";
+constexpr Block UK_SHIFT = U"ABCDEFGHIJKLMNOPQRSTUVWXYZ!\"£$%^&*()\0\0\0\0 _+{}~~:@¬<>?";
+constexpr AltGrKey UK_ALTGR[] = {{0x21, U'€'}, {0x35, U'¦'}};
+
+// --- DE (QWERTZ) ------------------------------------------------------------
+constexpr Block DE_PLAIN = U"abcdefghijklmnopqrstuvwxzy1234567890\0\0\0\0 ß´ü+##öä^,.-";
+constexpr Block DE_SHIFT = U"ABCDEFGHIJKLMNOPQRSTUVWXZY!\"§$%&/()=\0\0\0\0 ?`Ü*''ÖÄ°;:_";
+constexpr AltGrKey DE_ALTGR[] = {
+    {0x14, U'@'}, {0x08, U'€'}, {0x10, U'µ'}, {0x1F, U'²'},
+    {0x20, U'³'}, {0x24, U'{'}, {0x25, U'['}, {0x26, U']'},
+    {0x27, U'}'}, {0x2D, U'\\'}, {0x30, U'~'}, {0x64, U'|'}};
+
+// --- FR (AZERTY) ------------------------------------------------------------
+constexpr Block FR_PLAIN = U"qbcdefghijkl,noparstuvzxyw&é\"'(-è_çà\0\0\0\0 )=^$**mù²;:!";
+constexpr Block FR_SHIFT = U"QBCDEFGHIJKL?NOPARSTUVZXYW1234567890\0\0\0\0 °+¨£µµM%²./§";
+constexpr AltGrKey FR_ALTGR[] = {
+    {0x1F, U'~'}, {0x20, U'#'}, {0x21, U'{'}, {0x22, U'['}, {0x23, U'|'},
+    {0x24, U'`'}, {0x25, U'\\'}, {0x26, U'^'}, {0x27, U'@'}, {0x2D, U']'},
+    {0x2E, U'}'}, {0x08, U'€'}, {0x30, U'¤'}};
+
+constexpr Keymap KEYMAPS[LAYOUT_COUNT] = {
+    makeKeymap(US_PLAIN, US_SHIFT, U'\\', U'|', nullptr, 0),
+    makeKeymap(UK_PLAIN, UK_SHIFT, U'\\', U'|', UK_ALTGR,
+               sizeof(UK_ALTGR) / sizeof(UK_ALTGR[0])),
+    makeKeymap(DE_PLAIN, DE_SHIFT, U'<', U'>', DE_ALTGR,
+               sizeof(DE_ALTGR) / sizeof(DE_ALTGR[0])),
+    makeKeymap(FR_PLAIN, FR_SHIFT, U'<', U'>', FR_ALTGR,
+               sizeof(FR_ALTGR) / sizeof(FR_ALTGR[0])),
+};
+
+} // namespace
+
+uint32_t hidUsageToKey(KeyboardLayout layout, uint8_t usage,
+                       uint8_t modifiers) {
+  if (layout >= LAYOUT_COUNT || usage >= HID_KEYMAP_SIZE)
+    return 0;
+  // Either Shift selects level 1, AltGr adds 2
+  uint8_t shift = ((modifiers | (modifiers >> 4)) >> 1) & 1;
+  uint8_t altGr = (modifiers >> 6) & 1;
+  return KEYMAPS[layout].key[usage][shift | altGr << 1];
+}
+
+uint32_t hidConsumerToKey(uint16_t usage) {
+  switch (usage) {
+  case 0x0041: return LV_KEY_ENTER; // Menu Pick
+  case 0x0042: return LV_KEY_UP;    // Menu Up
+  case 0x0043: return LV_KEY_DOWN;  // Menu Down
+  case 0x0044: return LV_KEY_LEFT;  // Menu Left
+  case 0x0045: return LV_KEY_RIGHT; // Menu Right
+  case 0x0046: return LV_KEY_ESC;   // Menu Escape
+  case 0x0224: return LV_KEY_ESC;   // AC Back
+  default: return 0;
+  }
+}
+
+const char *keyboardLayoutName(KeyboardLayout layout) {
+  static const char *const names[LAYOUT_COUNT] = {"US", "UK", "DE", "FR"};
+  return layout < LAYOUT_COUNT ? names[layout] : "?";
+}
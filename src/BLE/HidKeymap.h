@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Translation of HID keyboard usages (page 0x07) to LVGL keys.
+ *
+ * Each layout is a table indexed by usage and modifier level (plain, Shift,
+ * AltGr, Shift+AltGr), generated at compile time. Lookup is a bounds check
+ * and one array access. Printable characters are returned as UTF-8 packed
+ * little-endian into a uint32_t, which is what lv_textarea_add_char()
+ * expects; control keys are LV_KEY_* codes.
+ */
+
+enum KeyboardLayout : uint8_t {
+    LAYOUT_US,
+    LAYOUT_UK,
+    LAYOUT_DE,
+    LAYOUT_FR,
+    LAYOUT_COUNT
+};
+
+// Usages 0x00..0x64 (up to Keyboard Non-US \ and |) are translated
+#define HID_KEYMAP_SIZE 0x65
+
+// HID modifier byte bits
+#define HID_MOD_LEFT_CTRL 0x01
+#define HID_MOD_LEFT_SHIFT 0x02
+#define HID_MOD_LEFT_ALT 0x04
+#define HID_MOD_LEFT_GUI 0x08
+#define HID_MOD_RIGHT_CTRL 0x10
+#define HID_MOD_RIGHT_SHIFT 0x20
+#define HID_MOD_RIGHT_ALT 0x40 // AltGr
+#define HID_MOD_RIGHT_GUI 0x80
+
+/** Returns the LVGL key for a usage, or 0 if it has no meaning for LVGL. */
+uint32_t hidUsageToKey(KeyboardLayout layout, uint8_t usage, uint8_t modifiers);
+
+/**
+ * Returns the LVGL key for a Consumer page (0x0C) usage, or 0. Only the
+ * navigation usages some remotes and media keyboards send are mapped.
+ */
+uint32_t hidConsumerToKey(uint16_t usage);
+
+const char *keyboardLayoutName(KeyboardLayout layout);
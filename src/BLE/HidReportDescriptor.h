@@ -0,0 +1,400 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * HID Report Map (characteristic 0x2A4B) parser and table-driven report
+ * decoder.
+ *
+ * hidParseReportMap() walks the descriptor once and records, per input
+ * report ID, where the fields a keyboard-like device can send live:
+ * modifier bits, a key array (boot style), a key bitmap (NKRO), and
+ * consumer control usages as an array or as individual bits. Everything
+ * else (mouse axes, LEDs, vendor data) only advances the bit offset.
+ *
+ * hidDecodeReport() then turns a report into the set of keys currently down
+ * by reading those fixed offsets; the descriptor is never looked at again.
+ * Both are bounds checked against the given lengths; recorded, truncated and
+ * mutated descriptors are run through them in test/test_hid_report_descriptor.
+ */
+
+#define HID_MAX_REPORTS 8
+#define HID_MAX_CONSUMER_BITS 16
+// Usages remembered between two main items (Usage, not Usage Min/Max)
+#define HID_MAX_LOCAL_USAGES 16
+#define HID_MAX_GLOBAL_STACK 4
+// Keys reported down by one decoded report
+#define HID_MAX_KEYS_DOWN 16
+#define HID_NO_FIELD 0xFFFF
+
+#define HID_PAGE_KEYBOARD 0x07
+#define HID_PAGE_CONSUMER 0x0C
+#define HID_USAGE_ERROR_ROLLOVER 0x01
+#define HID_USAGE_FIRST_KEY 0x04
+#define HID_USAGE_LEFT_CTRL 0xE0
+#define HID_USAGE_RIGHT_GUI 0xE7
+
+// Decoded key codes: keyboard usages as is, consumer usages with this flag
+#define HID_CONSUMER_FLAG 0x8000
+
+struct HidReportFormat {
+    uint16_t length;            // bytes, without the report ID prefix
+    uint16_t modifierBit;       // 8 bits, usages E0..E7
+    uint16_t keyArrayBit;       // keyArrayCount entries of keyArraySize bits
+    int16_t keyArrayFirst;      // usage = value + keyArrayFirst
+    uint16_t keyBitmapBit;      // keyBitmapCount bits, from keyBitmapFirst
+    uint16_t consumerArrayBit;
+    int16_t consumerArrayFirst;
+    uint16_t consumerBitmapBit;
+    uint16_t consumerBitmapUsages[HID_MAX_CONSUMER_BITS];
+    uint8_t reportId; // 0 if the device uses no report IDs
+    uint8_t keyArrayCount;
+    uint8_t keyArraySize;
+    uint8_t keyBitmapFirst;
+    uint8_t keyBitmapCount;
+    uint8_t consumerArrayCount;
+    uint8_t consumerArraySize;
+    uint8_t consumerBitmapCount;
+
+    /** Whether the report carries anything that produces key events. */
+    constexpr bool hasKeys() const {
+        return modifierBit != HID_NO_FIELD || keyArrayCount || keyBitmapCount ||
+               consumerArrayCount || consumerBitmapCount;
+    }
+};
+
+struct HidReportMap {
+    uint8_t count;
+    bool usesReportIds;
+    HidReportFormat reports[HID_MAX_REPORTS];
+
+    constexpr int indexOf(uint8_t reportId) const {
+        for (int i = 0; i < count; i++) {
+            if (reports[i].reportId == reportId)
+                return i;
+        }
+        return -1;
+    }
+};
+
+struct HidInputState {
+    uint8_t reportIndex; // which format of the map produced this state
+    bool hasModifiers;   // modifiers is the keyboard's current modifier state
+    bool rollover;       // ErrorRollOver: the real state is unknown
+    uint8_t modifiers;
+    uint8_t count;
+    uint16_t codes[HID_MAX_KEYS_DOWN];
+};
+
+namespace hid_detail {
+
+struct Globals {
+    uint16_t usagePage;
+    int32_t logicalMin;
+    uint32_t reportSize;
+    uint32_t reportCount;
+    uint8_t reportId;
+};
+
+struct Locals {
+    uint32_t usages[HID_MAX_LOCAL_USAGES]; // page << 16 | id
+    uint8_t usageCount;
+    uint32_t usageMin;
+    uint32_t usageMax;
+    bool haveMin;
+    bool haveMax;
+};
+
+constexpr HidReportFormat emptyFormat(uint8_t reportId) {
+    HidReportFormat f{};
+    f.reportId = reportId;
+    f.modifierBit = HID_NO_FIELD;
+    f.keyArrayBit = HID_NO_FIELD;
+    f.keyBitmapBit = HID_NO_FIELD;
+    f.consumerArrayBit = HID_NO_FIELD;
+    f.consumerBitmapBit = HID_NO_FIELD;
+    return f;
+}
+
+constexpr uint32_t extendUsage(uint32_t value, size_t size, uint16_t page) {
+    return size == 4 ? value : (uint32_t)page << 16 | (value & 0xFFFF);
+}
+
+// Record one Input main item. bitPos is the report's running bit offset.
+constexpr void addInput(HidReportFormat &f, uint32_t &bitPos, const Globals &g,
+                        const Locals &l, uint32_t flags) {
+    // Offsets past 64 Kbit cannot be recorded; saturate instead of wrapping
+    const uint32_t maxPos = 0x1000000;
+    uint32_t bits = g.reportSize * g.reportCount;
+    uint32_t offset = bitPos;
+    bitPos = bits > maxPos - bitPos ? maxPos : bitPos + bits;
+    uint32_t bytes = (bitPos + 7) / 8;
+    if (bytes > f.length)
+        f.length = bytes > 0xFFFF ? 0xFFFF : (uint16_t)bytes;
+
+    bool constant = flags & 0x01;
+    bool variable = flags & 0x02;
+    if (constant || bits == 0 || bitPos > HID_NO_FIELD)
+        return;
+
+    bool range = l.haveMin && l.haveMax;
+    uint32_t first = range ? l.usageMin : (l.usageCount ? l.usages[0] : 0);
+    uint16_t page = first >> 16;
+    uint16_t firstId = first & 0xFFFF;
+    uint32_t count = g.reportCount > 0xFF ? 0xFF : g.reportCount;
+
+    if (page == HID_PAGE_KEYBOARD && variable && g.reportSize == 1) {
+        if (firstId == HID_USAGE_LEFT_CTRL && count >= 8) {
+            if (f.modifierBit == HID_NO_FIELD)
+                f.modifierBit = offset;
+        } else if (f.keyBitmapBit == HID_NO_FIELD && firstId <= 0xFF) {
+            f.keyBitmapBit = offset;
+            f.keyBitmapFirst = firstId;
+            f.keyBitmapCount = count > 0x100u - firstId ? 0x100u - firstId : count;
+        }
+    } else if (page == HID_PAGE_KEYBOARD && !variable && g.reportSize <= 16) {
+        if (f.keyArrayBit == HID_NO_FIELD) {
+            f.keyArrayBit = offset;
+            f.keyArrayCount = count;
+            f.keyArraySize = g.reportSize;
+            f.keyArrayFirst = (int16_t)((range ? firstId : 0) - g.logicalMin);
+        }
+    } else if (page == HID_PAGE_CONSUMER && variable && g.reportSize == 1) {
+        if (f.consumerBitmapBit == HID_NO_FIELD) {
+            f.consumerBitmapBit = offset;
+            f.consumerBitmapCount =
+                count > HID_MAX_CONSUMER_BITS ? HID_MAX_CONSUMER_BITS : count;
+            for (uint8_t j = 0; j < f.consumerBitmapCount; j++) {
+                // Without a range, the last usage applies to the rest
+                uint32_t u = range ? l.usageMin + j
+                                   : l.usages[j < l.usageCount ? j : l.usageCount - 1];
+                f.consumerBitmapUsages[j] = u & 0xFFFF;
+            }
+        }
+    } else if (page == HID_PAGE_CONSUMER && !variable && g.reportSize <= 16) {
+        if (f.consumerArrayBit == HID_NO_FIELD) {
+            f.consumerArrayBit = offset;
+            f.consumerArrayCount = count;
+            f.consumerArraySize = g.reportSize;
+            f.consumerArrayFirst = (int16_t)((range ? firstId : 0) - g.logicalMin);
+        }
+    }
+}
+
+constexpr uint32_t readBits(const uint8_t *data, uint32_t bit, uint8_t size) {
+    uint32_t v = 0;
+    for (uint8_t k = 0; k < size && k < 32; k++, bit++)
+        v |= (uint32_t)((data[bit >> 3] >> (bit & 7)) & 1) << k;
+    return v;
+}
+
+constexpr void addCode(HidInputState &out, uint16_t code) {
+    if (out.count < HID_MAX_KEYS_DOWN)
+        out.codes[out.count++] = code;
+}
+
+// Keyboard usage from an array or bitmap: modifiers may be sent as keys
+constexpr void addKeyboardUsage(HidInputState &out, uint32_t usage) {
+    if (usage >= HID_USAGE_LEFT_CTRL && usage <= HID_USAGE_RIGHT_GUI)
+        out.modifiers |= 1 << (usage - HID_USAGE_LEFT_CTRL);
+    else if (usage >= HID_USAGE_FIRST_KEY && usage < HID_USAGE_LEFT_CTRL)
+        addCode(out, usage);
+}
+
+} // namespace hid_detail
+
+/**
+ * Parse a report descriptor. Returns false on a malformed descriptor
+ * (truncated item, unbalanced Push/Pop, report ID 0, oversized fields) or
+ * when it describes no input report with keys.
+ */
+constexpr bool hidParseReportMap(const uint8_t *desc, size_t len, HidReportMap &map) {
+    using namespace hid_detail;
+    map = HidReportMap{};
+    Globals g{};
+    Globals stack[HID_MAX_GLOBAL_STACK]{};
+    int sp = 0;
+    Locals l{};
+    uint32_t bitPos[HID_MAX_REPORTS]{};
+
+    size_t i = 0;
+    while (i < len) {
+        uint8_t prefix = desc[i++];
+        if (prefix == 0xFE) { // long item: size, tag, data
+            if (len - i < 2 || len - i - 2 < desc[i])
+                return false;
+            i += 2 + desc[i];
+            continue;
+        }
+        size_t size = prefix & 0x03;
+        if (size == 3)
+            size = 4;
+        if (len - i < size)
+            return false;
+        uint32_t uval = 0;
+        for (size_t k = 0; k < size; k++)
+            uval |= (uint32_t)desc[i + k] << (8 * k);
+        int32_t sval = size == 1   ? (int32_t)(int8_t)uval
+                       : size == 2 ? (int32_t)(int16_t)uval
+                                   : (int32_t)uval;
+        i += size;
+
+        uint8_t type = (prefix >> 2) & 0x03;
+        uint8_t tag = prefix >> 4;
+        if (type == 0) { // main
+            if (tag == 0x8) { // Input
+                if (g.reportSize > 32 || g.reportCount > 0xFFFF)
+                    return false;
+                int idx = map.indexOf(g.reportId);
+                if (idx < 0 && map.count < HID_MAX_REPORTS) {
+                    idx = map.count++;
+                    map.reports[idx] = emptyFormat(g.reportId);
+                }
+                if (idx >= 0)
+                    addInput(map.reports[idx], bitPos[idx], g, l, uval);
+            }
+            // Output, Feature, Collection and End Collection only end the
+            // local scope; output/feature bits live in other report spaces
+            l = Locals{};
+        } else if (type == 1) { // global
+            switch (tag) {
+            case 0x0: g.usagePage = uval; break;
+            case 0x1: g.logicalMin = sval; break;
+            case 0x7: g.reportSize = uval; break;
+            case 0x8:
+                if (uval == 0 || uval > 0xFF)
+                    return false;
+                g.reportId = uval;
+                map.usesReportIds = true;
+                break;
+            case 0x9: g.reportCount = uval; break;
+            case 0xA:
+                if (sp >= HID_MAX_GLOBAL_STACK)
+                    return false;
+                stack[sp++] = g;
+                break;
+            case 0xB:
+                if (sp == 0)
+                    return false;
+                g = stack[--sp];
+                break;
+            default: break;
+            }
+        } else if (type == 2) { // local
+            switch (tag) {
+            case 0x0:
+                if (l.usageCount < HID_MAX_LOCAL_USAGES)
+                    l.usages[l.usageCount++] = extendUsage(uval, size, g.usagePage);
+                break;
+            case 0x1:
+                l.usageMin = extendUsage(uval, size, g.usagePage);
+                l.haveMin = true;
+                break;
+            case 0x2:
+                l.usageMax = extendUsage(uval, size, g.usagePage);
+                l.haveMax = true;
+                break;
+            default: break;
+            }
+        }
+    }
+
+    for (int r = 0; r < map.count; r++) {
+        if (map.reports[r].hasKeys())
+            return true;
+    }
+    return false;
+}
+
+/** Table for devices whose Report Map is unavailable: the boot keyboard. */
+constexpr HidReportMap hidBootKeyboardMap() {
+    HidReportMap map{};
+    map.count = 1;
+    map.reports[0] = hid_detail::emptyFormat(0);
+    map.reports[0].length = 8;
+    map.reports[0].modifierBit = 0;
+    map.reports[0].keyArrayBit = 16;
+    map.reports[0].keyArrayCount = 6;
+    map.reports[0].keyArraySize = 8;
+    return map;
+}
+
+/**
+ * Decode one input report. reportId is the ID from the characteristic's
+ * Report Reference, or -1 if unknown: the first byte is then taken as the
+ * ID when the map uses IDs. Fields that do not fit in len are skipped.
+ * Returns false for reports the map does not describe.
+ */
+constexpr bool hidDecodeReport(const HidReportMap &map, int reportId,
+                               const uint8_t *data, size_t len,
+                               HidInputState &out) {
+    using namespace hid_detail;
+    out = HidInputState{};
+    if (reportId < 0) {
+        reportId = 0;
+        if (map.usesReportIds) {
+            if (len == 0)
+                return false;
+            reportId = data[0];
+            data++;
+            len--;
+        }
+    }
+    int idx = map.indexOf((uint8_t)reportId);
+    if (idx < 0)
+        return false;
+    const HidReportFormat &f = map.reports[idx];
+    out.reportIndex = idx;
+
+    uint32_t bits = len * 8;
+    auto fits = [bits](uint16_t bit, uint32_t n) {
+        return bit != HID_NO_FIELD && bit + n <= bits;
+    };
+
+    if (fits(f.modifierBit, 8)) {
+        out.modifiers = readBits(data, f.modifierBit, 8);
+        out.hasModifiers = true;
+    }
+    if (f.keyArrayCount && fits(f.keyArrayBit, f.keyArrayCount * f.keyArraySize)) {
+        // Without a modifier field, modifiers can only come as keys
+        out.hasModifiers |= f.modifierBit == HID_NO_FIELD;
+        for (uint8_t j = 0; j < f.keyArrayCount; j++) {
+            uint32_t v = readBits(data, f.keyArrayBit + j * f.keyArraySize,
+                                  f.keyArraySize);
+            int32_t usage = (int32_t)v + f.keyArrayFirst;
+            if (usage == HID_USAGE_ERROR_ROLLOVER) {
+                out.rollover = true;
+                return true;
+            }
+            if (usage > 0)
+                addKeyboardUsage(out, usage);
+        }
+    }
+    if (f.keyBitmapCount && fits(f.keyBitmapBit, f.keyBitmapCount)) {
+        out.hasModifiers |= f.modifierBit == HID_NO_FIELD;
+        for (uint16_t j = 0; j < f.keyBitmapCount; j++) {
+            if (readBits(data, f.keyBitmapBit + j, 1))
+                addKeyboardUsage(out, f.keyBitmapFirst + j);
+        }
+    }
+    if (f.consumerArrayCount &&
+        fits(f.consumerArrayBit, f.consumerArrayCount * f.consumerArraySize)) {
+        for (uint8_t j = 0; j < f.consumerArrayCount; j++) {
+            uint32_t v = readBits(data, f.consumerArrayBit + j * f.consumerArraySize,
+                                  f.consumerArraySize);
+            int32_t usage = (int32_t)v + f.consumerArrayFirst;
+            if (v != 0 && usage > 0 && usage < HID_CONSUMER_FLAG)
+                addCode(out, HID_CONSUMER_FLAG | usage);
+        }
+    }
+    if (f.consumerBitmapCount && fits(f.consumerBitmapBit, f.consumerBitmapCount)) {
+        for (uint8_t j = 0; j < f.consumerBitmapCount; j++) {
+            uint16_t usage = f.consumerBitmapUsages[j];
+            if (readBits(data, f.consumerBitmapBit + j, 1) && usage &&
+                usage < HID_CONSUMER_FLAG)
+                addCode(out, HID_CONSUMER_FLAG | usage);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,70 @@
+#include "HidTrace.h"
+
+#ifdef HID_TRACE
+
+#include "../Util/SpscRing.h"
+
+static SpscRing<HidTraceRecord, HID_TRACE_RING_SIZE> s_ring;
+
+void hidTraceRecord(uint16_t handle, const uint8_t *data, size_t length,
+                    bool isNotify) {
+  HidTraceRecord rec;
+  rec.timestampUs = micros();
+  rec.handle = handle;
+  rec.length = length > 0xFF ? 0xFF : (uint8_t)length;
+  rec.isNotify = isNotify ? 1 : 0;
+  size_t n = length < HID_TRACE_DATA_LEN ? length : HID_TRACE_DATA_LEN;
+  memcpy(rec.data, data, n);
+  s_ring.push(rec); // a full ring counts a drop, it never blocks
+}
+
+void hidTraceDrain() {
+  static uint32_t s_reportedDrops = 0;
+  HidTraceRecord rec;
+  // "xx " per byte plus the header fits comfortably
+  char line[48 + 3 * HID_TRACE_DATA_LEN];
+
+  while (s_ring.pop(rec)) {
+    int pos = snprintf(line, sizeof(line), "[HID] %10u %s h=%u len=%u:",
+                       (unsigned)rec.timestampUs, rec.isNotify ? "N" : "I", rec.handle,
+                       rec.length);
+    size_t n = rec.length < HID_TRACE_DATA_LEN ? rec.length : HID_TRACE_DATA_LEN;
+    for (size_t i = 0; i < n && pos > 0 && pos < (int)sizeof(line); i++)
+      pos += snprintf(line + pos, sizeof(line) - pos, " %02X", rec.data[i]);
+    Serial.println(line);
+  }
+
+  uint32_t dropped = s_ring.dropped();
+  if (dropped != s_reportedDrops) {
+    Serial.printf("[HID] trace ring full, %u records dropped\n",
+                  dropped - s_reportedDrops);
+    s_reportedDrops = dropped;
+  }
+}
+
+#ifndef NATIVE
+
+static void hidTraceTask(void *) {
+  for (;;) {
+    hidTraceDrain();
+    vTaskDelay(pdMS_TO_TICKS(HID_TRACE_DRAIN_MS));
+  }
+}
+
+void hidTraceBegin() {
+  static TaskHandle_t s_task = nullptr;
+  if (s_task)
+    return;
+  xTaskCreatePinnedToCore(hidTraceTask, "hid_trace", 3072, nullptr,
+                          HID_TRACE_TASK_PRIORITY, &s_task,
+                          HID_TRACE_TASK_CORE);
+}
+
+#else
+
+// The host build has no tasks; call hidTraceDrain() directly
+void hidTraceBegin() {}
+
+#endif
+
+#endif // HID_TRACE
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Optional binary trace of incoming HID notifications.
+ *
+ * Build with -D HID_TRACE to enable. hidTraceRecord() copies the raw report
+ * into a lock-free ring and returns; a low-priority task formats and prints
+ * the records later, so the NimBLE host task never allocates or waits on the
+ * UART. Without HID_TRACE both calls compile to nothing.
+ */
+
+// Report bytes kept per record; longer reports are truncated
+#define HID_TRACE_DATA_LEN 16
+// Records buffered between drains. Must be a power of two.
+#define HID_TRACE_RING_SIZE 64
+#define HID_TRACE_TASK_PRIORITY 1
+#define HID_TRACE_TASK_CORE 0
+#define HID_TRACE_DRAIN_MS 100
+
+struct HidTraceRecord {
+    uint32_t timestampUs;
+    uint16_t handle;
+    uint8_t length; // original report length
+    uint8_t isNotify;
+    uint8_t data[HID_TRACE_DATA_LEN];
+};
+
+#ifdef HID_TRACE
+
+/** Start the drain task. Call once from setup(). */
+void hidTraceBegin();
+
+/** Producer side: call from the NimBLE host task only. */
+void hidTraceRecord(uint16_t handle, const uint8_t *data, size_t length,
+                    bool isNotify);
+
+/** Print all buffered records. Called by the drain task. */
+void hidTraceDrain();
+
+#else
+
+inline void hidTraceBegin() {}
+inline void hidTraceRecord(uint16_t, const uint8_t *, size_t, bool) {}
+inline void hidTraceDrain() {}
+
+#endif
@@ -12,6 +12,10 @@ void ScanCallbacks::onResult(
   if (advertisedDevice->isAdvertisingService(UUID_HID_SERVICE) ||
       (advertisedDevice->haveAppearance() &&
        advertisedDevice->getAppearance() == APPEARANCE_KEYBOARD)) {
+    // Already attached, or a connection is about to be made
+    if (host->m_doConnect ||
+        host->isConnectedTo(advertisedDevice->getAddress()))
+      return;
     NIMBLE_LOGI(LOG_TAG, "Found Our Service");
     /** stop scan before connecting */
     NimBLEDevice::getScan()->stop();
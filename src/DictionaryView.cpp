@@ -0,0 +1,179 @@
+#include "DictionaryView.h"
+#include "Assets/AssetFont.h"
+#include "LvglPort.h"
+#include "ui/ui.h"
+
+struct Lookup {
+  char word[DICT_WORD_LEN];
+  char explanation[DICT_EXPLANATION_LEN];
+};
+
+// Ring of the last lookups; s_shown counts back from the newest
+static Lookup s_history[DICT_HISTORY_LEN];
+static uint8_t s_count = 0;
+static uint8_t s_newest = 0;
+static uint8_t s_shown = 0;
+
+// Explanation font sizes, smallest first; filled by dictionaryViewInit()
+static const uint8_t FONT_SIZES[] = {DICT_FONT_SIZES};
+static const lv_font_t *s_fonts[sizeof(FONT_SIZES)];
+static int s_fontCount = 0;
+static int s_fontIndex = -1;      // -1 until the first pinch
+static int s_pinchBaseIndex = -1; // font when the current pinch started
+
+static void showEntry(uint8_t back) {
+  s_shown = back;
+  // ui_Main not built: shown by dictionaryViewInit() when it is
+  if (!ui_TxtWord || s_count == 0)
+    return;
+  const Lookup &l =
+      s_history[(s_newest + DICT_HISTORY_LEN - back) % DICT_HISTORY_LEN];
+  lv_label_set_text(ui_TxtWord, l.word);
+  lv_label_set_text(ui_TxtExplanation, l.explanation);
+  lv_obj_scroll_to_y(ui_Panel1, 0, LV_ANIM_OFF);
+}
+
+void dictionaryViewShow(const char *word, const char *explanation) {
+  if (s_count)
+    s_newest = (s_newest + 1) % DICT_HISTORY_LEN;
+  if (s_count < DICT_HISTORY_LEN)
+    s_count++;
+  Lookup &l = s_history[s_newest];
+  strncpy(l.word, word ? word : "", sizeof(l.word) - 1);
+  l.word[sizeof(l.word) - 1] = '\0';
+  strncpy(l.explanation, explanation ? explanation : "",
+          sizeof(l.explanation) - 1);
+  l.explanation[sizeof(l.explanation) - 1] = '\0';
+  showEntry(0);
+}
+
+static int currentFontIndex() {
+  if (s_fontIndex >= 0)
+    return s_fontIndex;
+  // Start from the font SquareLine assigned
+  const lv_font_t *font =
+      lv_obj_get_style_text_font(ui_TxtExplanation, LV_PART_MAIN);
+  for (int i = 0; i < s_fontCount; i++) {
+    if (s_fonts[i] == font)
+      return i;
+  }
+  return s_fontCount / 2;
+}
+
+static void onPinch(const Gesture &g) {
+  if (s_fontCount == 0)
+    return;
+  if (s_pinchBaseIndex < 0)
+    s_pinchBaseIndex = currentFontIndex();
+
+  // Whole steps away from 1.0, rounded towards it
+  int steps = g.scaleQ8 >= GESTURE_SCALE_ONE
+                  ? (g.scaleQ8 - GESTURE_SCALE_ONE) / DICT_PINCH_STEP_Q8
+                  : -(int)((GESTURE_SCALE_ONE - g.scaleQ8) * 2 / DICT_PINCH_STEP_Q8);
+  int index = s_pinchBaseIndex + steps;
+  index = index < 0 ? 0 : index >= s_fontCount ? s_fontCount - 1 : index;
+  if (index != currentFontIndex()) {
+    s_fontIndex = index;
+    lv_obj_set_style_text_font(ui_TxtExplanation, s_fonts[index],
+                               LV_PART_MAIN | LV_STATE_DEFAULT);
+  }
+  if (g.phase == GESTURE_PHASE_END)
+    s_pinchBaseIndex = -1;
+}
+
+static void panelGestureEvent(lv_event_t *e) {
+  const Gesture *g = (const Gesture *)lv_event_get_param(e);
+  if (!g)
+    return;
+  switch (g->type) {
+  case GESTURE_SWIPE:
+    // Right goes back in time, like turning a page back
+    if (g->dir == GESTURE_DIR_RIGHT && s_shown + 1 < s_count)
+      showEntry(s_shown + 1);
+    else if (g->dir == GESTURE_DIR_LEFT && s_shown > 0)
+      showEntry(s_shown - 1);
+    break;
+  case GESTURE_PINCH:
+    onPinch(*g);
+    break;
+  default:
+    break;
+  }
+}
+
+// Montserrat compiled in at this size, if any
+static const lv_font_t *builtInFont(uint8_t size) {
+  switch (size) {
+#if LV_FONT_MONTSERRAT_12
+  case 12:
+    return &lv_font_montserrat_12;
+#endif
+#if LV_FONT_MONTSERRAT_14
+  case 14:
+    return &lv_font_montserrat_14;
+#endif
+#if LV_FONT_MONTSERRAT_16
+  case 16:
+    return &lv_font_montserrat_16;
+#endif
+#if LV_FONT_MONTSERRAT_18
+  case 18:
+    return &lv_font_montserrat_18;
+#endif
+#if LV_FONT_MONTSERRAT_20
+  case 20:
+    return &lv_font_montserrat_20;
+#endif
+#if LV_FONT_MONTSERRAT_24
+  case 24:
+    return &lv_font_montserrat_24;
+#endif
+  default:
+    return nullptr;
+  }
+}
+
+// The asset pack font of this size (with IPA coverage) if there is one
+static const lv_font_t *dictFont(uint8_t size) {
+  char name[16];
+  snprintf(name, sizeof(name), "dict_%u", size);
+  const lv_font_t *font = fontLoad(name);
+  return font ? font : builtInFont(size);
+}
+
+// Swap a compiled-in font SquareLine assigned for the pack font of its size
+static void usePackFont(lv_obj_t *obj) {
+  const lv_font_t *font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+  for (uint8_t size : FONT_SIZES) {
+    const lv_font_t *packed = dictFont(size);
+    if (font == builtInFont(size) && packed != font) {
+      lv_obj_set_style_text_font(obj, packed, LV_PART_MAIN | LV_STATE_DEFAULT);
+      return;
+    }
+  }
+}
+
+void dictionaryViewInit() {
+  if (!ui_Panel1)
+    return;
+  s_fontCount = 0;
+  for (uint8_t size : FONT_SIZES) {
+    if (const lv_font_t *font = dictFont(size))
+      s_fonts[s_fontCount++] = font;
+  }
+  usePackFont(ui_TxtWord);
+  usePackFont(ui_TxtExplanation);
+  // ui_Main rebuilt (ScreenManager.h): restore the font and entry shown
+  if (s_fontIndex >= s_fontCount)
+    s_fontIndex = -1;
+  if (s_fontIndex >= 0)
+    lv_obj_set_style_text_font(ui_TxtExplanation, s_fonts[s_fontIndex],
+                               LV_PART_MAIN | LV_STATE_DEFAULT);
+  s_pinchBaseIndex = -1;
+  showEntry(s_shown);
+
+  // Receive the gestures made on the explanation and sample sentence too
+  lv_obj_clear_flag(ui_Panel1, LV_OBJ_FLAG_GESTURE_BUBBLE);
+  lv_obj_add_event_cb(ui_Panel1, panelGestureEvent,
+                      (lv_event_code_t)g_gesture_event, nullptr);
+}
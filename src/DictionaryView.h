@@ -0,0 +1,38 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+/**
+ * Word view on ui_Main: the explanation panel (ui_Panel1) with a short
+ * history of lookups and touch gestures on top of it.
+ *
+ * - swipe right / left on the panel: previous / next lookup in the history
+ * - pinch on the panel: explanation text larger / smaller, one font size
+ *   per DICT_PINCH_STEP_Q8 of scale
+ *
+ * All functions run on the LVGL task (use UiBridge.h from elsewhere).
+ */
+
+#define DICT_HISTORY_LEN 8
+#define DICT_WORD_LEN 32
+#define DICT_EXPLANATION_LEN 256
+// Pinch scale (8.8 fixed point) per font size step: 1.3x / 0.77x
+#define DICT_PINCH_STEP_Q8 77
+// Explanation font sizes the pinch steps through. Each is the asset pack
+// font "dict_<size>" (assets/fonts.txt) or, without it, the Montserrat size
+// compiled in (include/lv_conf.h enables each of them); sizes with neither
+// are skipped.
+#define DICT_FONT_SIZES 12, 14, 16, 18, 20, 24
+
+/**
+ * Hook the gesture handlers to ui_Panel1 and show the current entry.
+ * Called each time ui_Main is built (screenSetBuiltHook()).
+ */
+void dictionaryViewInit();
+
+/**
+ * Show a lookup result and append it to the history; kept for when
+ * ui_Main is built if it is not.
+ */
+void dictionaryViewShow(const char *word, const char *explanation);
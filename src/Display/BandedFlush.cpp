@@ -0,0 +1,117 @@
+#include "BandedFlush.h"
+
+// A rendered band and where it goes
+struct Band {
+  int32_t x, y;
+  uint32_t w, h;
+  lv_color_t *buf;
+};
+
+static lv_disp_drv_t *s_drv = nullptr;
+static FlushTransport *s_transport = nullptr;
+static lv_color_t *s_bufs[BANDED_FLUSH_MAX_BUFS];
+static uint8_t s_bufCount = 0;
+
+// The band on the wire, the one queued behind it (buf nullptr when none)
+// and the buffer LVGL is waiting to get back
+static lv_color_t *s_onWire = nullptr;
+static Band s_queued = {0, 0, 0, 0, nullptr};
+static lv_color_t *s_unacked = nullptr;
+static BandedFlushStats s_stats = {0, 0};
+
+/**
+ * How it works:
+ * 1. LVGL draws content into buf1 or buf2 in RAM
+ * 2. When a buffer is full, LVGL calls my_disp_flush()
+ * 3. We queue the buffer to the transport and return immediately
+ * 4. LVGL continues drawing into the other buffer while the transfer runs
+ * 5. When the transfer completes, the transport calls lcd_flush_done(), which
+ *    hands the buffer back to LVGL
+ * With a third buffer the band may instead wait behind the one on the wire,
+ * and the spare buffer takes its place in draw_buf right away.
+ */
+static bool bufHeld(const lv_color_t *buf) {
+  return buf == s_onWire || buf == s_queued.buf;
+}
+
+static void sendBand(const Band &band) {
+  // Pixels are already big-endian (LV_COLOR_16_SWAP), push them as they are
+  s_onWire = band.buf;
+  s_transport->pushArea(band.x, band.y, band.w, band.h,
+                        (const uint16_t *)band.buf);
+}
+
+// Give LVGL its buffer back once rendering on cannot touch a buffer the
+// transport still reads: the band has been sent, or a spare buffer can be
+// swapped into draw_buf in its place
+static void ackBand() {
+  lv_color_t *buf = s_unacked;
+  if (!buf)
+    return;
+
+  if (bufHeld(buf)) {
+    lv_disp_draw_buf_t *draw_buf = s_drv->draw_buf;
+    lv_color_t *spare = nullptr;
+    for (uint8_t i = 0; i < s_bufCount && !spare; i++) {
+      if (!bufHeld(s_bufs[i]) && s_bufs[i] != draw_buf->buf1 &&
+          s_bufs[i] != draw_buf->buf2)
+        spare = s_bufs[i];
+    }
+    if (!spare)
+      return; // lcd_flush_done() tries again
+    if (draw_buf->buf1 == buf)
+      draw_buf->buf1 = spare;
+    else
+      draw_buf->buf2 = spare;
+  }
+  s_unacked = nullptr;
+  s_stats.acks++;
+  lv_disp_flush_ready(s_drv);
+}
+
+void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area,
+                   lv_color_t *color_p) {
+  uint32_t w = (area->x2 - area->x1 + 1);
+  uint32_t h = (area->y2 - area->y1 + 1);
+  Band band = {area->x1, area->y1, w, h, color_p};
+  s_stats.bands++;
+
+  // LVGL only flushes after the previous band was acknowledged, so the
+  // queue has room whenever the bus is busy
+  if (s_onWire)
+    s_queued = band;
+  else
+    sendBand(band);
+  s_unacked = color_p;
+  ackBand();
+}
+
+// Transfer-complete callback: start the queued band, and tell LVGL its
+// buffer is free again if it was still waiting
+static void lcd_flush_done(void *ctx) {
+  s_onWire = nullptr;
+  if (s_queued.buf) {
+    Band band = s_queued;
+    s_queued.buf = nullptr;
+    sendBand(band);
+  }
+  ackBand();
+}
+
+void bandedFlushInit(lv_disp_drv_t *drv, FlushTransport &transport,
+                     lv_color_t *const *bufs, uint8_t count) {
+  s_drv = drv;
+  s_transport = &transport;
+  s_bufCount = count < BANDED_FLUSH_MAX_BUFS ? count : BANDED_FLUSH_MAX_BUFS;
+  for (uint8_t i = 0; i < s_bufCount; i++)
+    s_bufs[i] = bufs[i];
+  s_onWire = nullptr;
+  s_queued.buf = nullptr;
+  s_unacked = nullptr;
+  s_stats = {0, 0};
+
+  drv->flush_cb = my_disp_flush;
+  transport.setDoneCallback(lcd_flush_done, drv);
+}
+
+const BandedFlushStats &bandedFlushStats() { return s_stats; }
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include "FlushTransport.h"
+
+/**
+ * Flush path of the banded render mode (RENDER_BANDED, LvglPort.h).
+ *
+ * my_disp_flush() queues the band LVGL rendered to the transport and
+ * returns at once; LVGL renders the next band into its other buffer while
+ * this one is on the wire and gets the buffer back (lv_disp_flush_ready())
+ * from the transport's done callback. With a third buffer the band may
+ * instead wait behind the one on the wire, and the spare buffer takes its
+ * place in the draw buffer right away.
+ *
+ * Runs on the LVGL task, like the flush and wait callbacks.
+ */
+
+#define BANDED_FLUSH_MAX_BUFS 3
+
+struct BandedFlushStats {
+    uint32_t bands; // my_disp_flush() calls
+    uint32_t acks;  // lv_disp_flush_ready() calls, one per band
+};
+
+/**
+ * Route drv's flushes to transport and take over its done callback. bufs
+ * are the count draw buffers; drv->draw_buf holds the first one or two.
+ */
+void bandedFlushInit(lv_disp_drv_t *drv, FlushTransport &transport,
+                     lv_color_t *const *bufs, uint8_t count);
+
+void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area,
+                   lv_color_t *color_p);
+
+const BandedFlushStats &bandedFlushStats();
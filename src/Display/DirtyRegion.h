@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Set of screen rectangles still to be sent to the panel, reduced to the
+ * cheapest set of transfers before flushing.
+ *
+ * Every transfer costs its pixels plus a fixed overhead (address window
+ * commands, CS toggling, DMA setup), expressed in pixel times. coalesce()
+ * repeatedly replaces the pair of rectangles whose bounding box is cheapest
+ * relative to sending both, as long as that lowers the total. Overlapping
+ * and nearby areas thus become one transfer; far apart ones stay separate.
+ *
+ * Only valid when the whole frame is in memory (full-frame render mode):
+ * a bounding box includes pixels nobody invalidated, which must be current.
+ *
+ * The merge rules are tested in test/test_dirty_region.
+ */
+
+#define DIRTY_MAX_RECTS 16
+
+struct DirtyRect {
+    int16_t x1, y1, x2, y2; // inclusive, like lv_area_t
+
+    constexpr uint32_t area() const { return (uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1); }
+
+    constexpr DirtyRect unite(const DirtyRect& o) const {
+        return {x1 < o.x1 ? x1 : o.x1, y1 < o.y1 ? y1 : o.y1,
+                x2 > o.x2 ? x2 : o.x2, y2 > o.y2 ? y2 : o.y2};
+    }
+};
+
+class DirtyRegion {
+public:
+    constexpr void clear() { m_count = 0; }
+    constexpr uint8_t count() const { return m_count; }
+    constexpr const DirtyRect& rect(uint8_t i) const { return m_rects[i]; }
+
+    /** Pixels the current set sends, overlaps counted twice. */
+    constexpr uint32_t pixels() const {
+        uint32_t n = 0;
+        for (uint8_t i = 0; i < m_count; i++)
+            n += m_rects[i].area();
+        return n;
+    }
+
+    constexpr void add(const DirtyRect& r) {
+        if (m_count < DIRTY_MAX_RECTS) {
+            m_rects[m_count++] = r;
+            return;
+        }
+        // Full: grow the rectangle that needs the fewest extra pixels
+        uint8_t best = 0;
+        uint32_t bestGrowth = UINT32_MAX;
+        for (uint8_t i = 0; i < m_count; i++) {
+            uint32_t growth = m_rects[i].unite(r).area() - m_rects[i].area();
+            if (growth < bestGrowth) {
+                bestGrowth = growth;
+                best = i;
+            }
+        }
+        m_rects[best] = m_rects[best].unite(r);
+    }
+
+    /** Merge while it lowers pixels + overheadPx per transfer. */
+    constexpr void coalesce(uint32_t overheadPx) {
+        while (m_count > 1) {
+            int64_t bestGain = 0;
+            uint8_t bi = 0, bj = 0;
+            for (uint8_t i = 0; i < m_count; i++) {
+                for (uint8_t j = i + 1; j < m_count; j++) {
+                    int64_t separate = (int64_t)m_rects[i].area() + m_rects[j].area() +
+                                       overheadPx;
+                    int64_t gain = separate - m_rects[i].unite(m_rects[j]).area();
+                    if (gain > bestGain) {
+                        bestGain = gain;
+                        bi = i;
+                        bj = j;
+                    }
+                }
+            }
+            if (bestGain <= 0)
+                return;
+            m_rects[bi] = m_rects[bi].unite(m_rects[bj]);
+            m_rects[bj] = m_rects[--m_count];
+        }
+    }
+
+private:
+    DirtyRect m_rects[DIRTY_MAX_RECTS] = {};
+    uint8_t m_count = 0;
+};
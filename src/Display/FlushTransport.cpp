@@ -0,0 +1,81 @@
+#include "FlushTransport.h"
+
+void FlushTransport::setDoneCallback(DoneCallback cb, void* ctx) {
+  m_doneCb = cb;
+  m_doneCtx = ctx;
+}
+
+void FlushTransport::beginTransfer(uint32_t count) {
+  m_inFlight = true;
+  m_waiting = false;
+  m_startUs = micros();
+  m_stats.transfers++;
+  m_stats.pixels += count;
+  m_windowLeft -= count;
+}
+
+void FlushTransport::pushArea(int32_t x, int32_t y, uint32_t w, uint32_t h,
+                              const uint16_t *pixels, uint32_t count) {
+  // The LVGL flush contract guarantees the previous area was acknowledged
+  // before a new one arrives, but be defensive: never overlap two transfers.
+  if (m_inFlight)
+    waitIdle();
+  // A window left incomplete is simply abandoned by the new one
+  if (m_windowLeft) {
+    m_windowLeft = 0;
+    finishTransfer();
+  }
+
+  if (count > w * h)
+    count = w * h;
+  m_windowLeft = w * h;
+  m_stats.windows++;
+  beginTransfer(count);
+  startTransfer(x, y, w, h, pixels, count);
+}
+
+void FlushTransport::pushPixels(const uint16_t *pixels, uint32_t count) {
+  if (m_inFlight)
+    waitIdle();
+  if (count > m_windowLeft)
+    count = m_windowLeft;
+  if (count == 0)
+    return;
+  beginTransfer(count);
+  continueTransfer(pixels, count);
+}
+
+bool FlushTransport::poll(bool waiting) {
+  if (!m_inFlight)
+    return false;
+
+  if (waiting && !m_waiting) {
+    m_waiting = true;
+    m_waitStartUs = micros();
+  }
+
+  if (!transferDone())
+    return true;
+
+  uint32_t now = micros();
+  m_stats.busyUs += now - m_startUs;
+  if (m_waiting)
+    m_stats.waitUs += now - m_waitStartUs;
+
+  // Keep the bus selected while the window expects more pixels
+  if (m_windowLeft == 0)
+    finishTransfer();
+  m_inFlight = false;
+
+  // The callback may already have queued the next transfer
+  if (m_doneCb)
+    m_doneCb(m_doneCtx);
+  return m_inFlight;
+}
+
+void FlushTransport::waitIdle() {
+  while (poll(true)) {
+  }
+}
+
+void FlushTransport::resetStats() { m_stats = {}; }
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Moves a rectangle of RGB565 pixels (already in panel byte order) to the
+ * display without blocking the caller.
+ *
+ * pushArea() starts the transfer and returns immediately. Completion is
+ * detected by poll(), which LVGL calls from its wait_cb and the main loop
+ * calls once per iteration. When a transfer finishes the done callback fires,
+ * which is where lv_disp_flush_ready() belongs, so LVGL can render the next
+ * band into the other buffer while this one is still on the wire.
+ *
+ * An area can also be sent in several transfers from a small bounce buffer:
+ * pushArea() with fewer pixels than the area opens the address window, and
+ * pushPixels() streams the rest into it without another window command.
+ */
+class FlushTransport {
+public:
+    typedef void (*DoneCallback)(void* ctx);
+
+    struct Stats {
+        uint32_t transfers;
+        uint32_t windows; // address windows set (per-area command overhead)
+        uint64_t pixels;
+        uint64_t busyUs; // time a transfer was in flight
+        uint64_t waitUs; // part of busyUs the renderer spent blocked in poll(true)
+    };
+
+    virtual ~FlushTransport() {}
+    virtual void begin() {}
+
+    void setDoneCallback(DoneCallback cb, void* ctx);
+
+    /** Queue one area. Only one transfer may be in flight at a time. */
+    void pushArea(int32_t x, int32_t y, uint32_t w, uint32_t h, const uint16_t* pixels) {
+        pushArea(x, y, w, h, pixels, w * h);
+    }
+
+    /** Open the area's window and queue its first count pixels. */
+    void pushArea(int32_t x, int32_t y, uint32_t w, uint32_t h, const uint16_t* pixels,
+                  uint32_t count);
+
+    /** Queue the next count pixels of the window opened by pushArea(). */
+    void pushPixels(const uint16_t* pixels, uint32_t count);
+
+    /**
+     * Check whether the current transfer has finished and fire the done
+     * callback if so. Pass waiting = true when the caller is stalled on the
+     * transfer so the stall is accounted in Stats::waitUs.
+     * Returns true while a transfer is still in flight.
+     */
+    bool poll(bool waiting = false);
+
+    /** Block until the bus is idle. */
+    void waitIdle();
+
+    bool isBusy() const { return m_inFlight; }
+    const Stats& stats() const { return m_stats; }
+    void resetStats();
+
+protected:
+    // Set the window (x, y, w, h) and send its first count pixels
+    virtual void startTransfer(int32_t x, int32_t y, uint32_t w, uint32_t h,
+                               const uint16_t* pixels, uint32_t count) = 0;
+    // Send count more pixels into the open window
+    virtual void continueTransfer(const uint16_t* pixels, uint32_t count) = 0;
+    virtual bool transferDone() = 0;
+    // Called once the last pixel of a window is out
+    virtual void finishTransfer() {}
+
+private:
+    void beginTransfer(uint32_t count);
+
+    DoneCallback m_doneCb = nullptr;
+    void* m_doneCtx = nullptr;
+    volatile bool m_inFlight = false;
+    uint32_t m_windowLeft = 0; // pixels of the open window not queued yet
+    uint32_t m_startUs = 0;
+    uint32_t m_waitStartUs = 0;
+    bool m_waiting = false;
+    Stats m_stats = {};
+};
@@ -0,0 +1,67 @@
+#include "FramebufferTransport.h"
+
+#include <stdio.h>
+
+FramebufferTransport::FramebufferTransport(uint16_t width, uint16_t height,
+                                           uint32_t spiHz)
+    : SimulatedFlushTransport(spiHz), m_width(width), m_height(height),
+      m_fb(new uint16_t[(size_t)width * height]()) {}
+
+FramebufferTransport::~FramebufferTransport() { delete[] m_fb; }
+
+void FramebufferTransport::write(const uint16_t *pixels, uint32_t count) {
+  // Like the panel's GRAM pointer: left to right, then the next row
+  for (uint32_t i = 0; i < count && m_cursor < m_winW * m_winH; i++, m_cursor++) {
+    int32_t fx = m_winX + (int32_t)(m_cursor % m_winW);
+    int32_t fy = m_winY + (int32_t)(m_cursor / m_winW);
+    if (fx < 0 || fx >= m_width || fy < 0 || fy >= m_height)
+      continue;
+    m_fb[(size_t)fy * m_width + fx] = pixels[i];
+  }
+}
+
+void FramebufferTransport::startTransfer(int32_t x, int32_t y, uint32_t w,
+                                         uint32_t h, const uint16_t *pixels,
+                                         uint32_t count) {
+  m_winX = x;
+  m_winY = y;
+  m_winW = w;
+  m_winH = h;
+  m_cursor = 0;
+  write(pixels, count);
+  SimulatedFlushTransport::startTransfer(x, y, w, h, pixels, count);
+}
+
+void FramebufferTransport::continueTransfer(const uint16_t *pixels,
+                                            uint32_t count) {
+  write(pixels, count);
+  SimulatedFlushTransport::continueTransfer(pixels, count);
+}
+
+uint16_t FramebufferTransport::pixelAt(uint16_t x, uint16_t y) const {
+  // Stored as the panel expects it: high byte first in memory
+  const uint8_t *p = (const uint8_t *)&m_fb[(size_t)y * m_width + x];
+  return (uint16_t)(p[0] << 8 | p[1]);
+}
+
+bool FramebufferTransport::writePPM(const char *path) const {
+  FILE *f = fopen(path, "wb");
+  if (!f)
+    return false;
+
+  fprintf(f, "P6\n%u %u\n255\n", m_width, m_height);
+  uint8_t rgb[3];
+  for (uint16_t y = 0; y < m_height; y++) {
+    for (uint16_t x = 0; x < m_width; x++) {
+      uint16_t c = pixelAt(x, y);
+      uint8_t r = (c >> 11) & 0x1F;
+      uint8_t g = (c >> 5) & 0x3F;
+      uint8_t b = c & 0x1F;
+      rgb[0] = (r << 3) | (r >> 2);
+      rgb[1] = (g << 2) | (g >> 4);
+      rgb[2] = (b << 3) | (b >> 2);
+      fwrite(rgb, 1, sizeof(rgb), f);
+    }
+  }
+  return fclose(f) == 0;
+}
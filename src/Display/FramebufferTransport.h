@@ -0,0 +1,41 @@
+#pragma once
+
+#include "SimulatedFlushTransport.h"
+
+/**
+ * Headless display: flushed areas land in an in-memory RGB565 framebuffer
+ * (panel byte order, like the ILI9342 GRAM) with the timing of the simulated
+ * SPI bus. Frames can be dumped as binary PPM for inspection or diffing.
+ */
+class FramebufferTransport : public SimulatedFlushTransport {
+public:
+    FramebufferTransport(uint16_t width, uint16_t height, uint32_t spiHz = 27000000);
+    ~FramebufferTransport() override;
+
+    uint16_t width() const { return m_width; }
+    uint16_t height() const { return m_height; }
+    const uint16_t* pixels() const { return m_fb; }
+
+    /** Returns the pixel at (x, y) as host-order RGB565. */
+    uint16_t pixelAt(uint16_t x, uint16_t y) const;
+
+    /** Write the framebuffer as a binary (P6) PPM. Returns false on I/O error. */
+    bool writePPM(const char* path) const;
+
+protected:
+    void startTransfer(int32_t x, int32_t y, uint32_t w, uint32_t h,
+                       const uint16_t* pixels, uint32_t count) override;
+    void continueTransfer(const uint16_t* pixels, uint32_t count) override;
+
+private:
+    // Store count pixels at the window cursor, advancing it
+    void write(const uint16_t* pixels, uint32_t count);
+
+    uint16_t m_width;
+    uint16_t m_height;
+    uint16_t* m_fb;
+    // Open window and the next pixel position in it
+    int32_t m_winX = 0, m_winY = 0;
+    uint32_t m_winW = 0, m_winH = 0;
+    uint32_t m_cursor = 0;
+};
@@ -0,0 +1,66 @@
+#include "RleImage.h"
+
+#include <lvgl.h>
+
+// ============================================================================
+// LVGL DECODER
+// ============================================================================
+
+static bool rleSource(const void *src, const lv_img_dsc_t *&img,
+                      RleInfo &info) {
+  if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE)
+    return false;
+  img = (const lv_img_dsc_t *)src;
+  return img->header.cf == LV_IMG_CF_USER_ENCODED_0 &&
+         rleParse(img->data, img->data_size, info);
+}
+
+static lv_res_t rleInfo(lv_img_decoder_t *decoder, const void *src,
+                        lv_img_header_t *header) {
+  const lv_img_dsc_t *img = nullptr;
+  RleInfo info = {};
+  if (!rleSource(src, img, info))
+    return LV_RES_INV;
+
+  header->always_zero = 0;
+  header->w = info.width;
+  header->h = info.height;
+  // The format read_line delivers
+  header->cf = info.bpp == 3 ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+  return LV_RES_OK;
+}
+
+static lv_res_t rleOpen(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+  const lv_img_dsc_t *img = nullptr;
+  RleInfo info = {};
+  if (!rleSource(dsc->src, img, info))
+    return LV_RES_INV;
+  // No whole-image buffer: LVGL reads the lines it draws
+  dsc->img_data = nullptr;
+  dsc->user_data = (void *)img;
+  return LV_RES_OK;
+}
+
+static lv_res_t rleReadLine(lv_img_decoder_t *decoder,
+                            lv_img_decoder_dsc_t *dsc, lv_coord_t x,
+                            lv_coord_t y, lv_coord_t len, uint8_t *buf) {
+  const lv_img_dsc_t *img = (const lv_img_dsc_t *)dsc->user_data;
+  // Validated in rleOpen()
+  RleInfo info = {(uint16_t)img->header.w, (uint16_t)img->header.h,
+                  img->data[8]};
+  if (x < 0 || y < 0 || len < 0)
+    return LV_RES_INV;
+  return rleDecodeLine(img->data, img->data_size, info, y, x, len, buf)
+             ? LV_RES_OK
+             : LV_RES_INV;
+}
+
+static void rleClose(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {}
+
+void rleImageInit() {
+  lv_img_decoder_t *decoder = lv_img_decoder_create();
+  lv_img_decoder_set_info_cb(decoder, rleInfo);
+  lv_img_decoder_set_open_cb(decoder, rleOpen);
+  lv_img_decoder_set_read_line_cb(decoder, rleReadLine);
+  lv_img_decoder_set_close_cb(decoder, rleClose);
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Run-length encoded images (LV_IMG_CF_USER_ENCODED_0), produced from the
+ * SquareLine exports by tools/rle_images.py, which also documents the
+ * stream layout.
+ *
+ * The decoder registered by rleImageInit() gives LVGL no whole-image
+ * buffer; LVGL then asks for the visible part of every line of the area
+ * being drawn, which is decoded straight into its line buffer and blended
+ * into the current draw band. Every line has its own offset in the stream,
+ * so a band in the middle of the image costs no more than one at the top.
+ *
+ * Opaque images are stored without alpha and drawn as LV_IMG_CF_TRUE_COLOR,
+ * which LVGL copies instead of blending.
+ */
+
+#define RLE_HEADER_SIZE 12
+
+struct RleInfo {
+    uint16_t width;
+    uint16_t height;
+    uint8_t bpp; // bytes per pixel: 2 (RGB565) or 3 (RGB565 + alpha)
+};
+
+constexpr uint32_t rleRead32(const uint8_t* p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+/** Validates the stream header and line table. */
+constexpr bool rleParse(const uint8_t* data, size_t size, RleInfo& info) {
+    if (size < RLE_HEADER_SIZE || data[0] != 'R' || data[1] != 'L' || data[2] != 'E' ||
+        data[3] != '1')
+        return false;
+    info.width = (uint16_t)(data[4] | data[5] << 8);
+    info.height = (uint16_t)(data[6] | data[7] << 8);
+    info.bpp = data[8];
+    if ((info.bpp != 2 && info.bpp != 3) || info.width == 0 || info.height == 0)
+        return false;
+    size_t tableEnd = RLE_HEADER_SIZE + (size_t)info.height * 4;
+    if (size < tableEnd)
+        return false;
+    for (uint16_t y = 0; y < info.height; y++) {
+        uint32_t offset = rleRead32(data + RLE_HEADER_SIZE + y * 4);
+        if (offset < tableEnd || offset > size)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Decode pixels x .. x + len - 1 of line y into out (len * info.bpp bytes).
+ * Returns false if the stream is corrupt or the range is outside the image.
+ */
+constexpr bool rleDecodeLine(const uint8_t* data, size_t size, const RleInfo& info, uint16_t y,
+                             uint16_t x, uint16_t len, uint8_t* out) {
+    if (y >= info.height || x + len > info.width)
+        return false;
+    size_t pos = rleRead32(data + RLE_HEADER_SIZE + y * 4);
+    uint32_t px = 0;          // pixel index within the line
+    const uint32_t end = x + len;
+    while (px < end) {
+        if (pos >= size)
+            return false;
+        uint8_t ctrl = data[pos++];
+        uint32_t count = (ctrl & 0x7F) + 1u;
+        bool run = ctrl & 0x80;
+        size_t bytes = run ? info.bpp : count * info.bpp;
+        if (pos + bytes > size)
+            return false;
+
+        // Part of this token that falls in [x, end)
+        uint32_t from = px > x ? px : x;
+        uint32_t to = px + count < end ? px + count : end;
+        for (uint32_t i = from; i < to; i++) {
+            const uint8_t* src = data + pos + (run ? 0 : (i - px) * info.bpp);
+            uint8_t* dst = out + (i - x) * info.bpp;
+            for (uint8_t b = 0; b < info.bpp; b++)
+                dst[b] = src[b];
+        }
+        pos += bytes;
+        px += count;
+    }
+    return true;
+}
+
+/** Register the LVGL decoder. Called from initLVGL(). */
+void rleImageInit();
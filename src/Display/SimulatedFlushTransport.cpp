@@ -0,0 +1,25 @@
+#include "SimulatedFlushTransport.h"
+
+SimulatedFlushTransport::SimulatedFlushTransport(uint32_t spiHz,
+                                                 uint32_t setupUs)
+    : m_spiHz(spiHz), m_setupUs(setupUs), m_startUs(0), m_durationUs(0) {}
+
+void SimulatedFlushTransport::startTransfer(int32_t x, int32_t y, uint32_t w,
+                                            uint32_t h, const uint16_t *pixels,
+                                            uint32_t count) {
+  uint64_t bits = (uint64_t)count * 16;
+  m_durationUs = m_setupUs + (uint32_t)(bits * 1000000ULL / m_spiHz);
+  m_startUs = micros();
+}
+
+void SimulatedFlushTransport::continueTransfer(const uint16_t *pixels,
+                                               uint32_t count) {
+  // Pixel data only, no address window commands
+  uint64_t bits = (uint64_t)count * 16;
+  m_durationUs = (uint32_t)(bits * 1000000ULL / m_spiHz);
+  m_startUs = micros();
+}
+
+bool SimulatedFlushTransport::transferDone() {
+  return (uint32_t)(micros() - m_startUs) >= m_durationUs;
+}
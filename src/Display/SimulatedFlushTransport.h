@@ -0,0 +1,34 @@
+#pragma once
+
+#include "FlushTransport.h"
+
+/**
+ * Stand-in for the SPI DMA transport that takes as long as the real bus
+ * would to move the pixels, without touching any hardware.
+ *
+ * Used off-device to measure how much of the transfer time LVGL overlaps
+ * with rendering: Stats::busyUs - Stats::waitUs is the time saved compared
+ * to a blocking flush.
+ */
+class SimulatedFlushTransport : public FlushTransport {
+public:
+    /**
+     * @param spiHz clock of the simulated bus, 16 bits per pixel
+     * @param setupUs fixed cost per transfer (address window commands)
+     */
+    explicit SimulatedFlushTransport(uint32_t spiHz = 27000000, uint32_t setupUs = 10);
+
+    uint32_t setupUs() const { return m_setupUs; }
+
+protected:
+    void startTransfer(int32_t x, int32_t y, uint32_t w, uint32_t h,
+                       const uint16_t* pixels, uint32_t count) override;
+    void continueTransfer(const uint16_t* pixels, uint32_t count) override;
+    bool transferDone() override;
+
+private:
+    uint32_t m_spiHz;
+    uint32_t m_setupUs;
+    uint32_t m_startUs;
+    uint32_t m_durationUs;
+};
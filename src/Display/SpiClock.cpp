@@ -0,0 +1,132 @@
+#include "SpiClock.h"
+
+#ifndef NATIVE
+
+#include <Preferences.h>
+
+static const char *NVS_NAMESPACE = "display";
+static const char *NVS_KEY = "spi_hz";
+
+unsigned long g_spiFrequency = SPI_CLOCK_DEFAULT_HZ;
+
+namespace {
+
+// Writes the test strip with DMA and reads it back over SDA
+class TftSpiProbe {
+public:
+  explicit TftSpiProbe(TFT_eSPI &tft) : m_tft(tft) {}
+
+  bool test(uint32_t hz, uint8_t pattern, uint32_t seed) {
+    setClock(hz);
+    for (uint32_t i = 0; i < SPI_TUNE_PIXELS; i++)
+      s_pattern[i] = spiTunePixel(pattern, i, seed);
+
+    // Pixels go out exactly as stored; readRect() returns them the same way
+    bool swap = m_tft.getSwapBytes();
+    m_tft.setSwapBytes(false);
+    m_tft.startWrite();
+    m_tft.pushImageDMA(0, 0, SPI_TUNE_WIDTH, SPI_TUNE_HEIGHT, s_pattern);
+    m_tft.dmaWait();
+    m_tft.endWrite();
+    m_tft.setSwapBytes(swap);
+
+    memset(s_readback, 0, sizeof(s_readback));
+    m_tft.readRect(0, 0, SPI_TUNE_WIDTH, SPI_TUNE_HEIGHT, s_readback);
+    return spiTuneCrc(s_readback, SPI_TUNE_PIXELS) ==
+           spiTunePatternCrc(pattern, seed);
+  }
+
+  // Apply hz to TFT_eSPI: transactions pick up SPI_FREQUENCY on every
+  // start, the DMA device only when it is added
+  void setClock(uint32_t hz) {
+    if (hz == g_spiFrequency && m_dma)
+      return;
+    if (m_dma)
+      m_tft.deInitDMA();
+    g_spiFrequency = hz;
+    m_dma = m_tft.initDMA();
+  }
+
+  // Leave DMA to the flush transport
+  void end() {
+    if (m_dma)
+      m_tft.deInitDMA();
+    m_dma = false;
+  }
+
+private:
+  TFT_eSPI &m_tft;
+  bool m_dma = false;
+  // Static so they are in internal, DMA capable RAM and off the stack
+  static uint16_t s_pattern[SPI_TUNE_PIXELS];
+  static uint16_t s_readback[SPI_TUNE_PIXELS];
+};
+
+uint16_t TftSpiProbe::s_pattern[SPI_TUNE_PIXELS];
+uint16_t TftSpiProbe::s_readback[SPI_TUNE_PIXELS];
+
+bool isTuneStep(uint32_t hz) {
+  for (size_t i = 0; i < SPI_TUNE_STEP_COUNT; i++) {
+    if (SPI_TUNE_STEPS[i] == hz)
+      return true;
+  }
+  return false;
+}
+
+// One round of every pattern at the stored clock
+bool recheck(TftSpiProbe &probe, uint32_t hz) {
+  for (uint8_t p = 0; p < SPI_TUNE_PATTERN_COUNT; p++) {
+    if (!probe.test(hz, p, p + 1))
+      return false;
+  }
+  return true;
+}
+
+} // namespace
+
+SpiTuneResult spiClockBegin(TFT_eSPI &tft, bool retune) {
+  Preferences prefs;
+  uint32_t stored = 0;
+  if (prefs.begin(NVS_NAMESPACE, true)) {
+    stored = prefs.getUInt(NVS_KEY, 0);
+    prefs.end();
+  }
+
+  TftSpiProbe probe(tft);
+  if (!retune && isTuneStep(stored)) {
+    if (recheck(probe, stored)) {
+      probe.end();
+      Serial.printf("[LCD] SPI clock %lu Hz (stored)\n", g_spiFrequency);
+      return {stored, true, SPI_TUNE_PATTERN_COUNT, 0};
+    }
+    Serial.printf("[LCD] Stored SPI clock %u Hz failed, tuning again\n",
+                  stored);
+  }
+
+  uint32_t start = millis();
+  SpiTuneResult r = spiTuneClock(probe);
+  probe.setClock(r.hz);
+  probe.end();
+
+  if (!r.validated) {
+    Serial.printf("[LCD] No panel readback, SPI clock stays at %u Hz\n", r.hz);
+    return r;
+  }
+  Serial.printf("[LCD] SPI clock tuned to %u Hz (%u tests, %u failed, %lu ms)\n",
+                r.hz, r.tests, r.failures, millis() - start);
+  if (r.hz != stored && prefs.begin(NVS_NAMESPACE, false)) {
+    prefs.putUInt(NVS_KEY, r.hz);
+    prefs.end();
+  }
+  return r;
+}
+
+void spiClockClear() {
+  Preferences prefs;
+  if (prefs.begin(NVS_NAMESPACE, false)) {
+    prefs.remove(NVS_KEY);
+    prefs.end();
+  }
+}
+
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <Arduino.h>
+
+#ifndef NATIVE
+
+#include "SpiClockTuner.h"
+#include "TFT_eSPI.h"
+
+/**
+ * Runtime display SPI clock.
+ *
+ * SPI_FREQUENCY (include/Setup252_ESP32_S3_Box_3.h) refers to
+ * g_spiFrequency, which starts at SPI_CLOCK_DEFAULT_HZ. spiClockBegin()
+ * raises it to the fastest clock that passes the readback tests
+ * (SpiClockTuner.h) and keeps the result in NVS. On later boots the stored
+ * clock only has to pass one round of the patterns; if it does not (or
+ * retune is set), the search runs again.
+ *
+ * Without a working readback the clock stays at SPI_CLOCK_DEFAULT_HZ and
+ * nothing is stored.
+ *
+ * Call after tft.begin() and before the flush transport starts DMA. The
+ * test strip is drawn at the top left corner and overwritten by LVGL's
+ * first frame.
+ */
+SpiTuneResult spiClockBegin(TFT_eSPI& tft, bool retune = false);
+
+/** Forget the stored clock; the next spiClockBegin() searches again. */
+void spiClockClear();
+
+#endif
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Finds the highest SPI clock the display link runs reliably at.
+ *
+ * The clock is raised one step at a time. At every step each test pattern
+ * is written to the panel and read back SPI_TUNE_ROUNDS times; the CRC of
+ * what came back must match the CRC of the pattern. The first failing step
+ * ends the search, and the best passing one is confirmed with twice as many
+ * rounds before it is accepted (falling back one step otherwise), so a
+ * marginal clock that passed by luck is not kept.
+ *
+ * If even the first step (the clock the board was designed for) fails, the
+ * readback itself is not trustworthy and the result is not validated; the
+ * caller should stay at that clock.
+ *
+ * The search is a template over the probe so the same code runs on the
+ * panel (SpiClock.cpp) and against scripted probes and SimulatedSpiProbe
+ * on the host (test/test_spi_clock_tuner). A probe provides
+ *     bool test(uint32_t hz, uint8_t pattern, uint32_t seed)
+ * which writes spiTunePixel(pattern, i, seed) for i < SPI_TUNE_PIXELS at
+ * clock hz and returns whether the readback CRC equals
+ * spiTunePatternCrc(pattern, seed).
+ */
+
+#define SPI_TUNE_ROUNDS 3
+#define SPI_TUNE_PATTERN_COUNT 4
+// Test strip written per pattern: 64 x 4 pixels
+#define SPI_TUNE_WIDTH 64
+#define SPI_TUNE_HEIGHT 4
+#define SPI_TUNE_PIXELS (SPI_TUNE_WIDTH * SPI_TUNE_HEIGHT)
+
+// The ESP32-S3 SPI clock is 80 MHz divided by an integer, so these are the
+// distinct clocks from the original 27 MHz (26.7 MHz) up
+constexpr uint32_t SPI_TUNE_STEPS[] = {27000000, 40000000, 80000000};
+constexpr size_t SPI_TUNE_STEP_COUNT = sizeof(SPI_TUNE_STEPS) / sizeof(SPI_TUNE_STEPS[0]);
+
+/**
+ * Pixel i of a test pattern:
+ *   0  black/white alternating, every data line toggles per pixel
+ *   1  0x5555/0xAAAA alternating, every bit toggles on every clock edge
+ *   2  walking one, catches stuck or crossed bit positions
+ *   3  pseudo-random from seed, different in every round
+ */
+constexpr uint16_t spiTunePixel(uint8_t pattern, uint32_t i, uint32_t seed) {
+    switch (pattern) {
+    case 0:
+        return (i & 1) ? 0xFFFF : 0x0000;
+    case 1:
+        return (i & 1) ? 0xAAAA : 0x5555;
+    case 2:
+        return (uint16_t)(1u << (i % 16));
+    default: {
+        // xorshift32, one step per pixel
+        uint32_t x = seed * 2654435761u + i * 40503u + 1;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        return (uint16_t)(x >> 8);
+    }
+    }
+}
+
+/** CRC-32 (IEEE, reflected) over 16-bit values, high byte first. */
+constexpr uint32_t spiTuneCrcUpdate(uint32_t crc, uint16_t value) {
+    for (int b = 0; b < 2; b++) {
+        crc ^= b == 0 ? value >> 8 : value & 0xFF;
+        for (int k = 0; k < 8; k++)
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return crc;
+}
+
+constexpr uint32_t spiTuneCrc(const uint16_t* values, size_t count) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < count; i++)
+        crc = spiTuneCrcUpdate(crc, values[i]);
+    return ~crc;
+}
+
+/** Expected readback CRC of a whole test strip. */
+constexpr uint32_t spiTunePatternCrc(uint8_t pattern, uint32_t seed) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (uint32_t i = 0; i < SPI_TUNE_PIXELS; i++)
+        crc = spiTuneCrcUpdate(crc, spiTunePixel(pattern, i, seed));
+    return ~crc;
+}
+
+struct SpiTuneResult {
+    uint32_t hz;        // clock to use
+    bool validated;     // false: readback failed at the first step already
+    uint16_t tests;     // probe calls made
+    uint16_t failures;  // of which failed
+};
+
+namespace spi_tune_detail {
+
+template <typename Probe>
+constexpr bool passes(Probe& probe, uint32_t hz, uint8_t rounds, uint32_t& seed,
+                      SpiTuneResult& r) {
+    for (uint8_t round = 0; round < rounds; round++) {
+        for (uint8_t p = 0; p < SPI_TUNE_PATTERN_COUNT; p++) {
+            r.tests++;
+            if (!probe.test(hz, p, seed++)) {
+                r.failures++;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace spi_tune_detail
+
+template <typename Probe>
+constexpr SpiTuneResult spiTuneClock(Probe& probe, const uint32_t* steps = SPI_TUNE_STEPS,
+                                     size_t stepCount = SPI_TUNE_STEP_COUNT,
+                                     uint8_t rounds = SPI_TUNE_ROUNDS) {
+    SpiTuneResult r = {steps[0], false, 0, 0};
+    uint32_t seed = 1;
+
+    size_t best = 0;
+    bool any = false;
+    for (size_t i = 0; i < stepCount; i++) {
+        if (!spi_tune_detail::passes(probe, steps[i], rounds, seed, r))
+            break;
+        best = i;
+        any = true;
+    }
+    if (!any)
+        return r;
+
+    // Confirm, stepping down until a clock survives the longer run
+    while (best > 0 &&
+           !spi_tune_detail::passes(probe, steps[best], rounds * 2, seed, r))
+        best--;
+    r.hz = steps[best];
+    r.validated = true;
+    return r;
+}
+
+/**
+ * Stand-in for a display link: clocks up to stableHz always work, clocks up
+ * to flakyHz corrupt one pixel in about failPer256 of 256 strips, and
+ * anything faster corrupts every strip. The corruption is applied to the
+ * simulated readback, which is then checked through the CRC like the panel
+ * readback. Deterministic (LCG), so a seed always gives the same run.
+ */
+class SimulatedSpiProbe {
+public:
+    constexpr SimulatedSpiProbe(uint32_t stableHz, uint32_t flakyHz, uint8_t failPer256,
+                                uint32_t seed = 1)
+        : m_stableHz(stableHz), m_flakyHz(flakyHz), m_failPer256(failPer256), m_rng(seed) {}
+
+    constexpr bool test(uint32_t hz, uint8_t pattern, uint32_t seed) {
+        m_calls++;
+        uint32_t badPixel = UINT32_MAX;
+        if (hz > m_flakyHz) {
+            badPixel = next() % SPI_TUNE_PIXELS;
+        } else if (hz > m_stableHz && (next() & 0xFF) < m_failPer256) {
+            badPixel = next() % SPI_TUNE_PIXELS;
+        }
+
+        uint32_t crc = 0xFFFFFFFFu;
+        for (uint32_t i = 0; i < SPI_TUNE_PIXELS; i++) {
+            uint16_t px = spiTunePixel(pattern, i, seed);
+            if (i == badPixel)
+                px ^= 0x0100; // one flipped bit
+            crc = spiTuneCrcUpdate(crc, px);
+        }
+        return ~crc == spiTunePatternCrc(pattern, seed);
+    }
+
+    constexpr uint32_t calls() const { return m_calls; }
+
+private:
+    constexpr uint32_t next() {
+        m_rng = m_rng * 1664525u + 1013904223u;
+        return m_rng >> 8;
+    }
+
+    uint32_t m_stableHz;
+    uint32_t m_flakyHz;
+    uint8_t m_failPer256;
+    uint32_t m_rng;
+    uint32_t m_calls = 0;
+};
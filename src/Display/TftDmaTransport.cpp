@@ -0,0 +1,44 @@
+#include "TftDmaTransport.h"
+
+TftDmaTransport::TftDmaTransport(TFT_eSPI &tft) : m_tft(tft) {}
+
+void TftDmaTransport::begin() {
+  m_tft.setSwapBytes(false);
+  m_dma = m_tft.initDMA();
+  if (!m_dma)
+    Serial.println("[LCD] DMA init failed, transfers will be blocking");
+}
+
+void TftDmaTransport::startTransfer(int32_t x, int32_t y, uint32_t w,
+                                    uint32_t h, const uint16_t *pixels,
+                                    uint32_t count) {
+  // With swapping on, pushImageDMA() would swap the buffer in place (and
+  // LVGL's next use of it would see scrambled colors)
+  if (m_tft.getSwapBytes())
+    m_tft.setSwapBytes(false);
+  m_tft.startWrite();
+  if (!m_dma) {
+    m_tft.setAddrWindow(x, y, w, h);
+    m_tft.pushPixels(pixels, count);
+  } else if (count == w * h) {
+    // Sets the address window and queues the pixel data, then returns while
+    // the SPI peripheral streams the buffer out.
+    m_tft.pushImageDMA(x, y, w, h, const_cast<uint16_t *>(pixels));
+  } else {
+    // First chunk of a larger window, the rest follows in continueTransfer()
+    m_tft.setAddrWindow(x, y, w, h);
+    m_tft.pushPixelsDMA(const_cast<uint16_t *>(pixels), count);
+  }
+}
+
+void TftDmaTransport::continueTransfer(const uint16_t *pixels, uint32_t count) {
+  if (m_dma)
+    m_tft.pushPixelsDMA(const_cast<uint16_t *>(pixels), count);
+  else
+    m_tft.pushPixels(pixels, count);
+}
+
+// Without DMA the pixels were sent before startTransfer() returned
+bool TftDmaTransport::transferDone() { return !m_dma || !m_tft.dmaBusy(); }
+
+void TftDmaTransport::finishTransfer() { m_tft.endWrite(); }
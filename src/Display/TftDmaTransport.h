@@ -0,0 +1,35 @@
+#pragma once
+
+#include "FlushTransport.h"
+#include "TFT_eSPI.h"
+
+/**
+ * FlushTransport backed by TFT_eSPI's SPI DMA engine.
+ *
+ * The bus stays selected from pushArea() until the DMA queue drains, then it
+ * is released so other users of the transaction lock are not starved.
+ * Pixel buffers must live in DMA capable memory.
+ *
+ * If the DMA channel cannot be set up, pixels are written with blocking
+ * pushPixels() instead: pushArea() returns once they are on the wire.
+ *
+ * Byte order is handled once, by LVGL while rendering (LV_COLOR_16_SWAP).
+ * TFT_eSPI's own swap is kept off, so pixel buffers go to the DMA engine as
+ * they are: no copy and no second pass over the pixels.
+ */
+class TftDmaTransport : public FlushTransport {
+public:
+    explicit TftDmaTransport(TFT_eSPI& tft);
+    void begin() override;
+
+protected:
+    void startTransfer(int32_t x, int32_t y, uint32_t w, uint32_t h,
+                       const uint16_t* pixels, uint32_t count) override;
+    void continueTransfer(const uint16_t* pixels, uint32_t count) override;
+    bool transferDone() override;
+    void finishTransfer() override;
+
+private:
+    TFT_eSPI& m_tft;
+    bool m_dma = false;
+};
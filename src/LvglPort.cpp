@@ -0,0 +1,579 @@
+#include "LvglPort.h"
+#include "Assets/AssetStore.h"
+#include "Display/BandedFlush.h"
+#include "Display/DirtyRegion.h"
+#include "Display/RleImage.h"
+#include "ScreenManager.h"
+#include "Touch/TouchInput.h"
+#include "UiBridge.h"
+
+// The flush path hands LVGL's pixels to the SPI DMA untouched, so LVGL must
+// render them in the panel's byte order (big-endian RGB565)
+#if LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP != 1
+#error "LvglPort expects LV_COLOR_DEPTH 16 with LV_COLOR_16_SWAP 1"
+#endif
+
+// LVGL Display Buffers, allocated by initLVGL() (DrawBufConfig). LVGL
+// renders into the two in draw_buf; a third one stands in for a band that
+// is still waiting for the transport (Display/BandedFlush.h).
+static_assert(DRAW_BUF_MAX_COUNT <= BANDED_FLUSH_MAX_BUFS,
+              "BandedFlush tracks every draw buffer");
+static lv_disp_draw_buf_t draw_buf;
+static lv_color_t *s_bufs[DRAW_BUF_MAX_COUNT];
+static DrawBufConfig s_bufConfig = {0, 0, 0};
+
+// Full-frame modes: the whole screen (PSRAM), and the areas LVGL redrew in
+// it during the current refresh
+static lv_color_t *s_frame = nullptr;
+static DirtyRegion s_dirty;
+static RenderMode s_renderMode = RENDER_BANDED;
+
+// DMA staging buffers for pixels the SPI DMA cannot read in place (PSRAM):
+// the draw buffers in the full-frame modes, or DRAW_BUF_BOUNCE_ROWS buffers
+// in internal memory when the draw buffers are not DMA capable
+static lv_color_t *s_stage[DRAW_BUF_MAX_COUNT];
+static uint8_t s_stageCount = 0;
+static uint16_t s_stageRows = 0;
+static lv_color_t *s_bounce[DRAW_BUF_BOUNCE_COUNT];
+
+// LVGL Display Driver
+static lv_disp_drv_t disp_drv;
+
+// Where flushed areas go (SPI DMA on the device, a framebuffer on the host)
+static FlushTransport *s_transport = nullptr;
+
+lv_indev_t *g_keyboard_indev = nullptr;
+static lv_indev_t *s_touch_indev = nullptr;
+
+uint32_t g_gesture_event = 0;
+static GestureRecognizer s_gestures; // fed by touch_read_cb
+
+#ifndef NATIVE
+// Task that runs lv_timer_handler(), notified by lvglWake()
+static TaskHandle_t s_lvglTask = nullptr;
+static SemaphoreHandle_t s_lvglMutex = nullptr;
+#endif
+
+// ============================================================================
+// LVGL DISPLAY FLUSH CALLBACKS
+// ============================================================================
+
+// The banded mode with DMA-capable draw buffers flushes through
+// my_disp_flush() (Display/BandedFlush.h)
+
+// Send a w x h rectangle of pixels at src (stride pixels per line) to
+// (x, y) as a single address window, staged through the staging buffers in
+// turn. Filling one buffer overlaps the transfer of the other;
+// pushArea()/pushPixels() wait for the bus before starting, so a buffer is
+// never refilled while it is still being sent.
+static void stageRect(const lv_color_t *src, uint32_t stride, int32_t x,
+                      int32_t y, uint32_t w, uint32_t h) {
+  static uint8_t next = 0;
+  const uint32_t capacity = (uint32_t)LCD_H_RES * s_stageRows;
+
+  uint32_t total = w * h;
+  uint32_t sent = 0;
+  while (sent < total) {
+    uint32_t count = total - sent < capacity ? total - sent : capacity;
+    lv_color_t *dst = s_stage[next % s_stageCount];
+    next = (next + 1) % s_stageCount;
+    // A single buffer may still be on the wire
+    if (s_stageCount == 1)
+      s_transport->waitIdle();
+
+    // Rows of the rectangle, possibly starting or ending mid-row
+    for (uint32_t i = 0; i < count;) {
+      uint32_t row = (sent + i) / w;
+      uint32_t col = (sent + i) % w;
+      uint32_t run = w - col < count - i ? w - col : count - i;
+      memcpy(dst + i, src + (size_t)row * stride + col,
+             run * sizeof(lv_color_t));
+      i += run;
+    }
+
+    if (sent == 0)
+      s_transport->pushArea(x, y, w, h, (const uint16_t *)dst, count);
+    else
+      s_transport->pushPixels((const uint16_t *)dst, count);
+    sent += count;
+  }
+}
+
+static void flushFrameRect(const DirtyRect &r) {
+  stageRect(s_frame + (size_t)r.y1 * LCD_H_RES + r.x1, LCD_H_RES, r.x1, r.y1,
+            r.x2 - r.x1 + 1, r.y2 - r.y1 + 1);
+}
+
+/**
+ * Flush callback of the banded mode with draw buffers the SPI DMA cannot
+ * read (DrawBufConfig in PSRAM): the band is copied out through the bounce
+ * buffers, after which LVGL has its buffer back.
+ */
+static void bounce_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area,
+                              lv_color_t *color_p) {
+  uint32_t w = area->x2 - area->x1 + 1;
+  stageRect(color_p, w, area->x1, area->y1, w, area->y2 - area->y1 + 1);
+  lv_disp_flush_ready(disp);
+}
+
+/**
+ * Flush callback of the full-frame modes. LVGL has already drawn the area
+ * into s_frame; only remember it until the last area of the refresh, then
+ * send everything that changed. The frame is copied out before returning,
+ * so LVGL may start on the next refresh right away.
+ */
+static void frame_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area,
+                             lv_color_t *color_p) {
+  s_dirty.add({area->x1, area->y1, area->x2, area->y2});
+
+  if (lv_disp_flush_is_last(disp)) {
+    if (s_renderMode == RENDER_FULL_FRAME_COALESCED)
+      s_dirty.coalesce(DISPLAY_FLUSH_OVERHEAD_PX);
+    for (uint8_t i = 0; i < s_dirty.count(); i++)
+      flushFrameRect(s_dirty.rect(i));
+    s_dirty.clear();
+  }
+  lv_disp_flush_ready(disp);
+}
+
+// Called by LVGL while it waits for a buffer to become free
+static void my_disp_wait(lv_disp_drv_t *disp) { s_transport->poll(true); }
+
+// ============================================================================
+// LVGL INITIALIZATION
+// ============================================================================
+
+// Whole-screen buffer for the full-frame modes, nullptr if there is no room
+static lv_color_t *allocFrame() {
+  size_t bytes = (size_t)LCD_H_RES * LCD_V_RES * sizeof(lv_color_t);
+  return (lv_color_t *)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+}
+
+static bool tryAllocDrawBufs(const DrawBufConfig &cfg) {
+  size_t bytes = (size_t)LCD_H_RES * cfg.rows * sizeof(lv_color_t);
+  for (uint8_t i = 0; i < cfg.count; i++) {
+    s_bufs[i] = (lv_color_t *)heap_caps_malloc(bytes, cfg.caps);
+    if (!s_bufs[i]) {
+      while (i > 0)
+        heap_caps_free(s_bufs[--i]);
+      return false;
+    }
+  }
+  s_bufConfig = cfg;
+  return true;
+}
+
+// The draw buffers are sent as they are unless the DMA cannot read them;
+// then pixels go through DRAW_BUF_BOUNCE_COUNT small internal buffers
+static bool setupStaging() {
+  s_stageRows = s_bufConfig.rows;
+  s_stageCount = s_bufConfig.count;
+  for (uint8_t i = 0; i < s_bufConfig.count; i++)
+    s_stage[i] = s_bufs[i];
+  if (s_bufConfig.caps & MALLOC_CAP_DMA)
+    return true;
+
+  size_t bytes = (size_t)LCD_H_RES * DRAW_BUF_BOUNCE_ROWS * sizeof(lv_color_t);
+  for (uint8_t i = 0; i < DRAW_BUF_BOUNCE_COUNT; i++) {
+    s_bounce[i] = (lv_color_t *)heap_caps_malloc(
+        bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+    if (!s_bounce[i]) {
+      while (i > 0)
+        heap_caps_free(s_bounce[--i]);
+      return false;
+    }
+    s_stage[i] = s_bounce[i];
+  }
+  s_stageRows = DRAW_BUF_BOUNCE_ROWS;
+  s_stageCount = DRAW_BUF_BOUNCE_COUNT;
+  return true;
+}
+
+// Allocate the draw buffers, shrinking the request until it fits
+static bool allocDrawBufs(DrawBufConfig cfg) {
+  if (cfg.count < 1)
+    cfg.count = 1;
+  if (cfg.count > DRAW_BUF_MAX_COUNT)
+    cfg.count = DRAW_BUF_MAX_COUNT;
+  if (cfg.rows < 1)
+    cfg.rows = 1;
+  if (cfg.rows > LCD_V_RES)
+    cfg.rows = LCD_V_RES;
+
+  for (;;) {
+    if (tryAllocDrawBufs(cfg))
+      return true;
+    if (cfg.rows > DRAW_BUF_MIN_ROWS) {
+      cfg.rows = cfg.rows / 2 > DRAW_BUF_MIN_ROWS ? cfg.rows / 2
+                                                   : DRAW_BUF_MIN_ROWS;
+    } else if (cfg.count > 1) {
+      cfg.count--;
+    } else {
+      return false;
+    }
+  }
+}
+
+void initLVGL(FlushTransport &transport, RenderMode mode,
+              const DrawBufConfig &bufConfig) {
+  Serial.println("Initializing LVGL...");
+
+  // Initialize LVGL core
+  lv_init();
+  // Compressed UI images (tools/rle_images.py)
+  rleImageInit();
+  assetImageInit();
+
+  if (!allocDrawBufs(bufConfig)) {
+    Serial.println("ERROR: no memory for the LVGL draw buffers");
+    return;
+  }
+  if (!setupStaging()) {
+    Serial.println("ERROR: no internal DMA memory for the bounce buffers");
+    return;
+  }
+  if (s_bufConfig.rows != bufConfig.rows ||
+      s_bufConfig.count != bufConfig.count)
+    Serial.printf("Draw buffers reduced to %u x %u rows\n",
+                  s_bufConfig.count, s_bufConfig.rows);
+
+  if (mode != RENDER_BANDED) {
+    s_frame = allocFrame();
+    if (!s_frame) {
+      Serial.println("No memory for a full frame, using banded rendering");
+      mode = RENDER_BANDED;
+    }
+  }
+  s_renderMode = mode;
+
+  // Initialize and configure the display driver
+  lv_disp_drv_init(&disp_drv);
+  disp_drv.hor_res = LCD_H_RES;                      // Display width
+  disp_drv.ver_res = LCD_V_RES;                      // Display height
+  disp_drv.wait_cb = my_disp_wait;                   // Poll DMA completion
+  disp_drv.draw_buf = &draw_buf;                     // Use our buffers
+  if (mode == RENDER_BANDED) {
+    // Initialize display buffers for double buffering
+    // This prevents flickering and enables smooth animations
+    lv_disp_draw_buf_init(&draw_buf, s_bufs[0],
+                          s_bufConfig.count > 1 ? s_bufs[1] : nullptr,
+                          (uint32_t)LCD_H_RES * s_bufConfig.rows);
+    if (s_stage[0] == s_bufs[0])
+      bandedFlushInit(&disp_drv, transport, s_bufs, s_bufConfig.count);
+    else
+      disp_drv.flush_cb = bounce_disp_flush;
+  } else {
+    // LVGL draws straight into the frame at screen coordinates
+    lv_disp_draw_buf_init(&draw_buf, s_frame, nullptr, LCD_H_RES * LCD_V_RES);
+    disp_drv.direct_mode = 1;
+    disp_drv.flush_cb = frame_disp_flush;
+  }
+  lv_disp_t *disp = lv_disp_drv_register(&disp_drv); // Register the driver
+
+  // Banded flushes complete asynchronously from the transport. When pixels
+  // are staged (full-frame modes, PSRAM draw buffers) the staging buffers
+  // are reused without LVGL's involvement.
+  s_transport = &transport;
+  s_transport->begin();
+
+  // Create input device for touch
+  static lv_indev_drv_t touch_drv;
+  lv_indev_drv_init(&touch_drv);
+  touch_drv.type = LV_INDEV_TYPE_POINTER;
+  touch_drv.read_cb = touch_read_cb;
+  touch_drv.disp = disp;
+  s_touch_indev = lv_indev_drv_register(&touch_drv);
+  g_gesture_event = lv_event_register_id();
+
+  // Create input device for keyboard
+  static lv_indev_drv_t keyboard_drv;
+  lv_indev_drv_init(&keyboard_drv);
+  keyboard_drv.type = LV_INDEV_TYPE_KEYPAD;
+  keyboard_drv.read_cb = keyboard_read_cb;
+  keyboard_drv.disp = disp;
+  g_keyboard_indev = lv_indev_drv_register(&keyboard_drv);
+  setKeyRepeat(KEY_REPEAT_DELAY_MS, KEY_REPEAT_INTERVAL_MS);
+
+#ifndef NATIVE
+  s_lvglMutex = xSemaphoreCreateRecursiveMutex();
+  s_lvglTask = xTaskGetCurrentTaskHandle();
+#endif
+  uiBridgeInit();
+
+  Serial.printf("LVGL initialized successfully (render mode %u, %u x %u "
+                "rows draw buffers)\n",
+                (unsigned)mode, s_bufConfig.count, s_bufConfig.rows);
+}
+
+RenderMode renderMode() { return s_renderMode; }
+
+const DrawBufConfig &drawBufConfig() { return s_bufConfig; }
+
+// ============================================================================
+// LVGL SCHEDULING
+// ============================================================================
+
+void lvglIdle(uint32_t nextTimerMs) {
+  // LV_NO_TIMER_READY (no timers at all) also ends up at the cap
+  uint32_t sleepMs = nextTimerMs < LVGL_MAX_IDLE_MS ? nextTimerMs
+                                                     : LVGL_MAX_IDLE_MS;
+#ifndef NATIVE
+  // Always block for at least one tick so lower priority tasks (and the idle
+  // task feeding the watchdog) get to run
+  TickType_t ticks = pdMS_TO_TICKS(sleepMs);
+  if (ticks == 0)
+    ticks = 1;
+  bool woken = ulTaskNotifyTake(pdTRUE, ticks) > 0;
+#else
+  delay(sleepMs ? sleepMs : 1);
+  bool woken = false;
+#endif
+
+  if (woken) {
+    // Input is pending: read it on the next lv_timer_handler() call
+    lvglLock();
+    lv_timer_ready(g_keyboard_indev->driver->read_timer);
+    lv_timer_ready(s_touch_indev->driver->read_timer);
+    lvglUnlock();
+  }
+}
+
+void lvglWake() {
+#ifndef NATIVE
+  if (s_lvglTask)
+    xTaskNotifyGive(s_lvglTask);
+#endif
+}
+
+void lvglWakeFromISR() {
+#ifndef NATIVE
+  if (s_lvglTask) {
+    BaseType_t higherPrioWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(s_lvglTask, &higherPrioWoken);
+    portYIELD_FROM_ISR(higherPrioWoken);
+  }
+#endif
+}
+
+void lvglLock() {
+#ifndef NATIVE
+  xSemaphoreTakeRecursive(s_lvglMutex, portMAX_DELAY);
+#endif
+}
+
+void lvglUnlock() {
+#ifndef NATIVE
+  xSemaphoreGiveRecursive(s_lvglMutex);
+#endif
+}
+
+#ifndef NATIVE
+static void lvglTask(void *arg) {
+  s_lvglTask = xTaskGetCurrentTaskHandle();
+
+  for (;;) {
+    lvglLock();
+    // Apply UI requests from other tasks, then render
+    uiBridgeProcess();
+    uint32_t nextTimerMs = lv_timer_handler();
+    // Retire a finished DMA transfer even if LVGL is not waiting on it
+    s_transport->poll();
+    lvglUnlock();
+
+    lvglIdle(nextTimerMs);
+  }
+}
+
+void startLvglTask() {
+  xTaskCreatePinnedToCore(lvglTask, "lvgl", LVGL_TASK_STACK_SIZE, nullptr,
+                          LVGL_TASK_PRIORITY, nullptr, LVGL_TASK_CORE);
+}
+#else
+void startLvglTask() {}
+#endif
+
+// ============================================================================
+// LVGL TOUCH READ CALLBACK
+// ============================================================================
+
+static void sendGesture(const Gesture &gesture) {
+  lv_point_t p = {(lv_coord_t)gesture.x, (lv_coord_t)gesture.y};
+  lv_obj_t *obj = lv_indev_search_obj(lv_scr_act(), &p);
+  while (obj && lv_obj_has_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE))
+    obj = lv_obj_get_parent(obj);
+  if (obj)
+    lv_event_send(obj, (lv_event_code_t)g_gesture_event, (void *)&gesture);
+}
+
+void touch_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
+  // Samples come from the touch reader task (Touch/TouchInput.h); no I2C
+  // here. The last state holds until a new sample arrives, and a release
+  // keeps the last pressed coordinates as LVGL expects.
+  static lv_point_t s_point = {0, 0};
+  static bool s_pressed = false;
+
+  TouchSample sample;
+  if (touchGetSample(sample)) {
+    // Every sample, all contacts, goes through the gesture recognizer; LVGL
+    // itself only sees the first contact
+    Gesture gesture = s_gestures.feed(sample);
+    if (gesture.type != GESTURE_NONE)
+      sendGesture(gesture);
+    s_pressed = sample.count > 0;
+    if (s_pressed) {
+      s_point.x = sample.points[0].x;
+      s_point.y = sample.points[0].y;
+    }
+  }
+
+  data->point = s_point;
+  data->state = s_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+  // Feed every buffered sample within the same LVGL timer run, so short
+  // taps and fast drags are not lost between reads
+  data->continue_reading = touchHasSample();
+}
+
+// ============================================================================
+// LVGL KEYBOARD READ CALLBACK
+// ============================================================================
+
+void keyboard_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
+    // LVGL's keypad handling tracks a single key. BleKeyboardHost delivers
+    // real press/release edges, so the key state is reported until it
+    // changes; holding a key lets LVGL generate the auto-repeat.
+    static uint32_t s_key = 0;
+    static bool s_pressed = false;
+    // A press that arrived while another key was still down
+    static KeyEvent s_pending;
+    static bool s_havePending = false;
+
+    KeyEvent keyEvent;
+    bool haveEvent = false;
+    if (s_havePending) {
+        keyEvent = s_pending;
+        s_havePending = false;
+        haveEvent = true;
+    } else if (bleKeyboardHost.hasKey()) {
+        keyEvent = bleKeyboardHost.getKey();
+        haveEvent = true;
+    }
+
+    if (haveEvent) {
+        if (keyEvent.pressed) {
+            if (s_pressed && s_key != keyEvent.keycode) {
+                // Roll-over: report the held key as released first, then
+                // press the new one on the next read
+                s_pending = keyEvent;
+                s_havePending = true;
+                s_pressed = false;
+            } else {
+                s_key = keyEvent.keycode;
+                s_pressed = true;
+            }
+        } else if (s_pressed && keyEvent.keycode == s_key) {
+            s_pressed = false;
+        }
+        // Releases of keys that were already rolled over are dropped
+    }
+
+    data->key = s_key;
+    data->state = s_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    // Drain queued edges within the same LVGL timer run
+    data->continue_reading = s_havePending || bleKeyboardHost.hasKey();
+}
+
+void setKeyRepeat(uint16_t delayMs, uint16_t intervalMs) {
+    lv_indev_drv_t *drv = g_keyboard_indev->driver;
+    if (delayMs == 0) {
+        // Never reach the long-press threshold: no repeat
+        drv->long_press_time = UINT16_MAX;
+        drv->long_press_repeat_time = UINT16_MAX;
+    } else {
+        drv->long_press_time = delayMs;
+        drv->long_press_repeat_time = intervalMs;
+    }
+}
+
+// ============================================================================
+// KEYBOARD FOCUS GROUPS
+// ============================================================================
+
+void switchToScreen(lv_obj_t **screen) {
+  lv_obj_t *obj = screenLoad(screen);
+  if (obj)
+    activateKeyboardGroupForScreen(obj);
+}
+
+// Each screen has its own group, made with one walk of its tree the first
+// time it is shown. Widgets created later are added from the
+// LV_EVENT_CHILD_CREATED of their parent (every widget of the screen
+// listens for it but the input widgets, whose children are their own
+// parts), and LVGL takes a deleted widget out of its group itself. The
+// group, and with it the focused widget, is kept until the screen is
+// deleted (ScreenManager.h), so a switch only changes the group the
+// keyboard feeds.
+
+// Widgets the keyboard can focus and operate
+static const lv_obj_class_t *const INPUT_CLASSES[] = {
+    &lv_textarea_class, &lv_dropdown_class, &lv_spinbox_class,
+    &lv_slider_class,   &lv_checkbox_class, &lv_switch_class,
+    &lv_btnmatrix_class, &lv_roller_class,
+};
+
+static bool isInputWidget(const lv_obj_t *obj) {
+    const lv_obj_class_t *cls = lv_obj_get_class(obj);
+    for (const lv_obj_class_t *input : INPUT_CLASSES) {
+        if (cls == input)
+            return true;
+    }
+    return false;
+}
+
+static void trackObject(lv_obj_t *obj, lv_group_t *group);
+
+static void childCreated(lv_event_t *e) {
+    trackObject((lv_obj_t *)lv_event_get_param(e),
+                (lv_group_t *)lv_event_get_user_data(e));
+}
+
+static void screenDeleted(lv_event_t *e) {
+    lv_group_del((lv_group_t *)lv_event_get_user_data(e));
+}
+
+// Clicking into a text area (ui_InputWord, ui_InputPassword) is about to be
+// followed by typing: low-latency BLE connection parameters until the keys
+// take over. Having the focus is not enough, ui_Main always focuses its
+// text area.
+static void textInputClicked(lv_event_t *e) {
+    bleKeyboardHost.noteTextInput();
+}
+
+// Add obj and its input widgets to group, and follow the children of every
+// other widget: buttons, panels, tab views and message boxes hold input
+// widgets as well as plain containers do
+static void trackObject(lv_obj_t *obj, lv_group_t *group) {
+    if (isInputWidget(obj)) {
+        lv_group_add_obj(group, obj);
+        if (lv_obj_check_type(obj, &lv_textarea_class))
+            lv_obj_add_event_cb(obj, textInputClicked, LV_EVENT_CLICKED,
+                                nullptr);
+        return;
+    }
+    lv_obj_add_event_cb(obj, childCreated, LV_EVENT_CHILD_CREATED, group);
+    uint32_t count = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < count; i++)
+        trackObject(lv_obj_get_child(obj, i), group);
+}
+
+void activateKeyboardGroupForScreen(lv_obj_t *screen) {
+    lv_group_t *group =
+        (lv_group_t *)lv_obj_get_event_user_data(screen, screenDeleted);
+    if (!group) {
+        group = lv_group_create();
+        // The screen is tracked like any other widget
+        trackObject(screen, group);
+        lv_obj_add_event_cb(screen, screenDeleted, LV_EVENT_DELETE, group);
+    }
+
+    lv_indev_set_group(g_keyboard_indev, group);
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#include "esp_heap_caps.h"
+
+#include "BLE/BleKeyboardHost.h"
+#include "Display/FlushTransport.h"
+#include "GT911.h"
+#include "Touch/GestureRecognizer.h"
+
+// Display geometry (landscape, rotation 3)
+#define LCD_H_RES 320
+#define LCD_V_RES 240
+
+// Owned by the application entry point (main.cpp, or native/main.cpp on the
+// host build)
+extern GT911 gt911;
+extern BleKeyboardHost bleKeyboardHost;
+
+extern lv_indev_t *g_keyboard_indev;
+
+/**
+ * Custom LVGL event code for touch gestures (Touch/GestureRecognizer.h),
+ * registered by initLVGL(). The event parameter is a const Gesture *. Like
+ * LV_EVENT_GESTURE it goes to the object under the gesture, or the first
+ * parent without LV_OBJ_FLAG_GESTURE_BUBBLE, so a container clears that
+ * flag to receive the gestures made on its children.
+ */
+extern uint32_t g_gesture_event;
+
+/**
+ * How LVGL renders and flushes.
+ *
+ * RENDER_BANDED: LVGL renders into the draw buffers (DrawBufConfig). A big
+ * change is rendered and sent as several bands, one address window each,
+ * and the next band renders while the previous one is on the wire.
+ *
+ * RENDER_FULL_FRAME: one whole-screen buffer in PSRAM that LVGL renders into
+ * directly (direct_mode). When a refresh finishes, each invalidated area is
+ * copied through the draw buffers (DMA cannot read PSRAM at full speed) and
+ * sent as one window.
+ *
+ * RENDER_FULL_FRAME_COALESCED: as RENDER_FULL_FRAME, but the invalidated
+ * areas are first merged into fewer rectangles wherever the extra pixels
+ * cost less than another address window (DISPLAY_FLUSH_OVERHEAD_PX).
+ *
+ * If the frame buffer cannot be allocated the banded mode is used.
+ */
+enum RenderMode : uint8_t {
+    RENDER_BANDED,
+    RENDER_FULL_FRAME,
+    RENDER_FULL_FRAME_COALESCED
+};
+
+// Cost of one address window (CASET/RASET/RAMWR plus DMA setup, about 40 us
+// at 27 MHz) expressed in pixels of transfer time
+#define DISPLAY_FLUSH_OVERHEAD_PX 64
+
+/**
+ * Size and placement of the draw buffers, allocated by initLVGL().
+ *
+ * Each buffer holds rows full display lines. With count 1 LVGL waits for
+ * every band to be sent before rendering the next, 2 overlaps rendering
+ * with the transfer, and 3 lets a finished band wait behind the one on the
+ * wire so rendering rarely stalls. caps are heap_caps_malloc() capabilities:
+ * MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA is fastest and the buffers go to the
+ * SPI DMA as they are. Without MALLOC_CAP_DMA (e.g. MALLOC_CAP_SPIRAM, to
+ * leave internal RAM to Wi-Fi/TLS) the DMA cannot read them: each band is
+ * copied through DRAW_BUF_BOUNCE_COUNT internal DMA buffers of
+ * DRAW_BUF_BOUNCE_ROWS lines and LVGL waits for the copy, so rendering
+ * and the transfer overlap much less.
+ *
+ * If the buffers do not fit, rows are halved down to DRAW_BUF_MIN_ROWS and
+ * then count is reduced.
+ */
+struct DrawBufConfig {
+    uint16_t rows;
+    uint8_t count;
+    uint32_t caps;
+};
+
+#define DRAW_BUF_MAX_COUNT 3
+#define DRAW_BUF_MIN_ROWS 10
+#define DRAW_BUF_DEFAULT_CONFIG {40, 2, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA}
+#define DRAW_BUF_BOUNCE_ROWS 10
+#define DRAW_BUF_BOUNCE_COUNT 2
+
+/**
+ * Initialize LVGL, the display driver and the touch/keyboard input devices.
+ * Flushed areas are sent through the given transport.
+ */
+void initLVGL(FlushTransport &transport, RenderMode mode = RENDER_BANDED,
+              const DrawBufConfig &bufConfig = DRAW_BUF_DEFAULT_CONFIG);
+
+/** The mode initLVGL() ended up with. */
+RenderMode renderMode();
+
+/** The draw buffers initLVGL() allocated (count 0 before that). */
+const DrawBufConfig &drawBufConfig();
+
+void touch_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data);
+void keyboard_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data);
+
+/**
+ * Auto-repeat of a held keyboard key: first repeat after delayMs, then every
+ * intervalMs. delayMs = 0 disables repeat. Call from the LVGL task.
+ */
+#define KEY_REPEAT_DELAY_MS 400
+#define KEY_REPEAT_INTERVAL_MS 80
+void setKeyRepeat(uint16_t delayMs, uint16_t intervalMs);
+
+/**
+ * Adaptive scheduler for the task running lv_timer_handler().
+ *
+ * lvglIdle() sleeps until LVGL's next timer is due (the value returned by
+ * lv_timer_handler()), capped at LVGL_MAX_IDLE_MS so the flush transport
+ * is still polled regularly. lvglWake() may be called from any task (or
+ * lvglWakeFromISR() from an interrupt) to end the sleep early; the input
+ * devices are then read on the next lv_timer_handler() call instead of
+ * waiting for their read period.
+ */
+#define LVGL_MAX_IDLE_MS 30
+void lvglIdle(uint32_t nextTimerMs);
+void lvglWake();
+void lvglWakeFromISR();
+
+/**
+ * LVGL runs in its own task, pinned to the core opposite the radio stacks
+ * (NimBLE host and Wi-Fi run on core 0). Code outside that task must either
+ * go through UiBridge.h or hold the LVGL lock while calling into LVGL.
+ */
+#define LVGL_TASK_CORE 1
+#define LVGL_TASK_PRIORITY 3
+#define LVGL_TASK_STACK_SIZE 8192
+
+/** Start the LVGL task. Call after initLVGL() and building the UI. */
+void startLvglTask();
+
+/** Recursive lock around LVGL for callers outside the LVGL task. */
+void lvglLock();
+void lvglUnlock();
+
+/**
+ * Load a screen by the address of its SquareLine global (e.g. &ui_Main),
+ * building it first if needed (ScreenManager.h), and give its input
+ * widgets the keyboard.
+ */
+void switchToScreen(lv_obj_t **screen);
+
+/**
+ * Feed the keyboard to screen's focus group, made the first time and kept
+ * (with its focused widget) until the screen is deleted.
+ */
+void activateKeyboardGroupForScreen(lv_obj_t *screen);
@@ -0,0 +1,170 @@
+#include "ScreenManager.h"
+#include "ui/ui.h"
+
+struct Screen {
+  const char *name;
+  lv_obj_t **obj;
+  void (*init)(void);
+  void (*destroy)(void);
+  lv_obj_t **next; // usually loaded after this one: prebuilt
+  bool once;       // destroyed as soon as another screen is loaded
+  void (*onBuilt)();
+  uint32_t lastShown; // switch count when last loaded, 0 if never
+  uint32_t bytes;     // LVGL heap it took when last built
+};
+
+// Boot goes splash -> Wi-Fi settings -> main; the keyboard settings are
+// opened from the main screen and left back to it
+static Screen s_screens[] = {
+    {"splash", &ui_Splash, ui_Splash_screen_init, ui_Splash_screen_destroy,
+     &ui_WIFI_Settings, true},
+    {"wifi_settings", &ui_WIFI_Settings, ui_WIFI_Settings_screen_init,
+     ui_WIFI_Settings_screen_destroy, &ui_Main, false},
+    {"main", &ui_Main, ui_Main_screen_init, ui_Main_screen_destroy, nullptr,
+     false},
+    {"keyboard_settings", &ui_Keyboard_Settings,
+     ui_Keyboard_Settings_screen_init, ui_Keyboard_Settings_screen_destroy,
+     &ui_Main, false},
+};
+
+static uint32_t s_budget = SCREEN_HEAP_BUDGET;
+static uint32_t s_switches = 0;
+static lv_timer_t *s_prebuildTimer = nullptr;
+static Screen *s_prebuildNext = nullptr;
+static bool s_trimQueued = false;
+static ScreenStats s_stats;
+
+static uint32_t heapUsed() {
+  lv_mem_monitor_t mon;
+  lv_mem_monitor(&mon);
+  s_stats.heapUsed = mon.total_size - mon.free_size;
+  if (mon.max_used > s_stats.heapPeak)
+    s_stats.heapPeak = mon.max_used;
+  return s_stats.heapUsed;
+}
+
+static Screen *find(lv_obj_t **obj) {
+  for (Screen &s : s_screens) {
+    if (s.obj == obj)
+      return &s;
+  }
+  return nullptr;
+}
+
+static lv_obj_t *build(Screen &s) {
+  if (*s.obj)
+    return *s.obj;
+  uint32_t before = heapUsed();
+  uint32_t start = millis();
+  s.init();
+  if (s.onBuilt)
+    s.onBuilt();
+  uint32_t after = heapUsed();
+  s.bytes = after > before ? after - before : 0;
+  s_stats.builds++;
+  Serial.printf("[SCREEN] Built %s: %u bytes of LVGL heap in %lu ms\n", s.name,
+                (unsigned)s.bytes, millis() - start);
+  return *s.obj;
+}
+
+static void destroy(Screen &s) {
+  s.destroy();
+  s_stats.destroys++;
+  heapUsed();
+  Serial.printf("[SCREEN] Destroyed %s, LVGL heap %u bytes\n", s.name,
+                (unsigned)s_stats.heapUsed);
+}
+
+// Deferred to the next lv_timer_handler() call: the switch may come from an
+// event of a widget on the screen being left
+static void trim(void *) {
+  s_trimQueued = false;
+  lv_obj_t *active = lv_scr_act();
+  for (Screen &s : s_screens) {
+    if (s.once && s.lastShown && *s.obj && *s.obj != active)
+      destroy(s);
+  }
+  while (heapUsed() > s_budget) {
+    Screen *lru = nullptr;
+    for (Screen &s : s_screens) {
+      if (*s.obj && *s.obj != active &&
+          (!lru || s.lastShown < lru->lastShown))
+        lru = &s;
+    }
+    if (!lru)
+      break;
+    destroy(*lru);
+  }
+}
+
+static void queueTrim() {
+  if (s_trimQueued)
+    return;
+  s_trimQueued = true;
+  lv_async_call(trim, nullptr);
+}
+
+static void prebuildTimer(lv_timer_t *timer) {
+  // Retried every period until nobody is touching the screen or typing
+  if (lv_disp_get_inactive_time(nullptr) < SCREEN_PREBUILD_DELAY_MS)
+    return;
+  lv_timer_pause(timer);
+  Screen *s = s_prebuildNext;
+  s_prebuildNext = nullptr;
+  if (!s || *s->obj)
+    return;
+  // Known not to fit: it would only be destroyed again
+  if (s->bytes && heapUsed() + s->bytes > s_budget)
+    return;
+  build(*s);
+  s_stats.prebuilds++;
+  queueTrim();
+}
+
+void screenManagerInit(uint32_t heapBudget, bool prebuild) {
+  s_budget = heapBudget;
+
+  // As ui_init() (ui.c, generated), without building every screen
+  lv_disp_t *dispp = lv_disp_get_default();
+  lv_theme_t *theme = lv_theme_default_init(
+      dispp, lv_palette_main(LV_PALETTE_BLUE),
+      lv_palette_main(LV_PALETTE_RED), false, LV_FONT_DEFAULT);
+  lv_disp_set_theme(dispp, theme);
+  ui____initial_actions0 = lv_obj_create(NULL);
+
+  if (prebuild && !s_prebuildTimer) {
+    s_prebuildTimer =
+        lv_timer_create(prebuildTimer, SCREEN_PREBUILD_DELAY_MS, nullptr);
+    lv_timer_pause(s_prebuildTimer);
+  }
+  screenLoad(&ui_Splash);
+}
+
+void screenSetBuiltHook(lv_obj_t **screen, void (*hook)()) {
+  if (Screen *s = find(screen))
+    s->onBuilt = hook;
+}
+
+lv_obj_t *screenLoad(lv_obj_t **screen) {
+  Screen *s = find(screen);
+  lv_obj_t *obj = s ? build(*s) : *screen;
+  if (!obj)
+    return nullptr;
+  lv_scr_load(obj);
+
+  if (s) {
+    s->lastShown = ++s_switches;
+    s_prebuildNext = s->next ? find(s->next) : nullptr;
+    if (s_prebuildTimer && s_prebuildNext && !*s_prebuildNext->obj) {
+      lv_timer_reset(s_prebuildTimer);
+      lv_timer_resume(s_prebuildTimer);
+    }
+  }
+  queueTrim();
+  return obj;
+}
+
+const ScreenStats &screenStats() {
+  heapUsed();
+  return s_stats;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+/**
+ * Lazy construction and teardown of the SquareLine screens.
+ *
+ * Instead of ui_init(), which builds every screen at boot, a screen is
+ * built with its generated ui_<Name>_screen_init() the first time it is
+ * loaded and deleted again with ui_<Name>_screen_destroy() when memory
+ * runs short. Until then (and after) its widget globals are NULL, so
+ * UiBridge.h requests for them are dropped.
+ *
+ * - Prebuild: some time after a screen is shown, the screen usually
+ *   loaded next from it is built while there is no input
+ *   (SCREEN_PREBUILD_DELAY_MS), so that switch costs no construction.
+ * - Budget: after every switch, screens not on display are destroyed,
+ *   least recently shown first, while the LVGL heap (lv_mem_monitor())
+ *   holds more than the budget. Screens shown once, like the splash, go
+ *   as soon as another one is loaded.
+ *
+ * With LV_MEM_CUSTOM (system malloc) LVGL reports no heap use and only
+ * the run-once screens are destroyed.
+ *
+ * All functions run on the LVGL task, like switchToScreen().
+ */
+
+// Default budget: three quarters of LVGL's heap, leaving room for the
+// screen being built and for styles and draw layers
+#if LV_MEM_CUSTOM == 0
+#define SCREEN_HEAP_BUDGET (LV_MEM_SIZE * 3 / 4)
+#else
+#define SCREEN_HEAP_BUDGET 0
+#endif
+// Input-free time after a switch before the next screen is prebuilt
+#define SCREEN_PREBUILD_DELAY_MS 500
+
+struct ScreenStats {
+    uint16_t builds = 0;    // screen constructions, prebuilds included
+    uint16_t prebuilds = 0;
+    uint16_t destroys = 0;
+    uint32_t heapUsed = 0;  // LVGL heap in use
+    uint32_t heapPeak = 0;  // LVGL heap high-water mark since boot
+};
+
+/**
+ * Replaces ui_init(): applies the SquareLine theme and loads the splash
+ * screen, building nothing else. prebuild false turns prebuilding off
+ * (the benchmark measures each switch on its own).
+ */
+void screenManagerInit(uint32_t heapBudget = SCREEN_HEAP_BUDGET, bool prebuild = true);
+
+/** Called each time screen (e.g. &ui_Main) has been built. */
+void screenSetBuiltHook(lv_obj_t **screen, void (*hook)());
+
+/**
+ * Build screen if needed and load it. Any lv_obj_t ** that is not one of
+ * the SquareLine screens is loaded as is if not NULL. Returns the screen
+ * now shown, or nullptr.
+ */
+lv_obj_t *screenLoad(lv_obj_t **screen);
+
+const ScreenStats &screenStats();
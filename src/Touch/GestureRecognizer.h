@@ -0,0 +1,201 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "TouchInput.h"
+
+/**
+ * Turns the multi-point touch sample stream into swipe, pinch and
+ * long-press gestures.
+ *
+ * Integer math only (pinch scale is 8.8 fixed point) and no allocation;
+ * touch traces are replayed through it in test/test_gesture_recognizer.
+ * One recognizer consumes one sample stream in order; feed() returns at
+ * most one gesture per sample.
+ *
+ * Rules:
+ * - swipe: one finger, released within GESTURE_SWIPE_MAX_MS after moving at
+ *   least GESTURE_SWIPE_MIN_PX, mostly along one axis
+ * - long press: one finger held within GESTURE_SLOP_PX for
+ *   GESTURE_LONG_PRESS_MS; the rest of that touch is ignored
+ * - pinch: two fingers; an update each time the scale moved by
+ *   GESTURE_PINCH_STEP_Q8 since the last one, and an end when all fingers
+ *   are lifted
+ */
+
+#define GESTURE_SWIPE_MIN_PX 40
+#define GESTURE_SWIPE_MAX_MS 500
+#define GESTURE_SLOP_PX 10
+#define GESTURE_LONG_PRESS_MS 600
+#define GESTURE_PINCH_STEP_Q8 32 // 1/8
+#define GESTURE_SCALE_ONE 256
+
+enum GestureType : uint8_t {
+    GESTURE_NONE,
+    GESTURE_SWIPE,
+    GESTURE_PINCH,
+    GESTURE_LONG_PRESS,
+};
+
+enum GestureDir : uint8_t {
+    GESTURE_DIR_LEFT,
+    GESTURE_DIR_RIGHT,
+    GESTURE_DIR_UP,
+    GESTURE_DIR_DOWN,
+};
+
+enum GesturePhase : uint8_t {
+    GESTURE_PHASE_UPDATE,
+    GESTURE_PHASE_END, // pinch only: fingers lifted, scale is final
+};
+
+struct Gesture {
+    GestureType type;
+    GestureDir dir; // swipe
+    GesturePhase phase;
+    uint16_t scaleQ8; // pinch: finger distance / distance at start
+    // Where the finger went down (swipe, long press), or the point between
+    // both fingers when the pinch started
+    uint16_t x;
+    uint16_t y;
+};
+
+namespace gesture_detail {
+
+constexpr uint32_t isqrt(uint32_t v) {
+    uint32_t root = 0;
+    for (uint32_t bit = 1u << 30; bit; bit >>= 2) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+    }
+    return root;
+}
+
+constexpr int32_t abs32(int32_t v) { return v < 0 ? -v : v; }
+
+constexpr uint32_t distance(const TouchPoint& a, const TouchPoint& b) {
+    int32_t dx = (int32_t)a.x - b.x;
+    int32_t dy = (int32_t)a.y - b.y;
+    return isqrt((uint32_t)(dx * dx + dy * dy));
+}
+
+} // namespace gesture_detail
+
+class GestureRecognizer {
+public:
+    constexpr Gesture feed(const TouchSample& s) {
+        using namespace gesture_detail;
+        if (s.count == 0) {
+            Gesture g = none();
+            if (m_state == TRACKING)
+                g = swipe(s.timestamp);
+            else if (m_state == PINCHING)
+                g = pinch(GESTURE_PHASE_END, m_lastScale);
+            m_state = IDLE;
+            return g;
+        }
+
+        if (s.count >= 2) {
+            if (m_state == IDLE || m_state == TRACKING) {
+                m_state = PINCHING;
+                m_startDist = distance(s.points[0], s.points[1]);
+                if (m_startDist == 0)
+                    m_startDist = 1;
+                m_lastScale = GESTURE_SCALE_ONE;
+                m_startX = ((uint32_t)s.points[0].x + s.points[1].x) / 2;
+                m_startY = ((uint32_t)s.points[0].y + s.points[1].y) / 2;
+                return none();
+            }
+            if (m_state != PINCHING)
+                return none();
+            uint32_t scale = distance(s.points[0], s.points[1]) *
+                             GESTURE_SCALE_ONE / m_startDist;
+            if (scale > 0xFFFF)
+                scale = 0xFFFF;
+            if (abs32((int32_t)scale - m_lastScale) < GESTURE_PINCH_STEP_Q8)
+                return none();
+            m_lastScale = scale;
+            return pinch(GESTURE_PHASE_UPDATE, scale);
+        }
+
+        // One finger
+        const TouchPoint& p = s.points[0];
+        if (m_state == IDLE) {
+            m_state = TRACKING;
+            m_startMs = s.timestamp;
+            m_startX = m_lastX = p.x;
+            m_startY = m_lastY = p.y;
+            m_moved = false;
+            return none();
+        }
+        if (m_state != TRACKING)
+            return none(); // pinch down to one finger, or after a long press
+        m_lastX = p.x;
+        m_lastY = p.y;
+        if (abs32((int32_t)p.x - m_startX) > GESTURE_SLOP_PX ||
+            abs32((int32_t)p.y - m_startY) > GESTURE_SLOP_PX)
+            m_moved = true;
+        if (!m_moved && s.timestamp - m_startMs >= GESTURE_LONG_PRESS_MS) {
+            m_state = CONSUMED;
+            Gesture g = none();
+            g.type = GESTURE_LONG_PRESS;
+            g.x = m_startX;
+            g.y = m_startY;
+            return g;
+        }
+        return none();
+    }
+
+    constexpr void reset() { m_state = IDLE; }
+
+private:
+    enum State : uint8_t { IDLE, TRACKING, PINCHING, CONSUMED };
+
+    static constexpr Gesture none() { return Gesture{}; }
+
+    constexpr Gesture swipe(uint32_t nowMs) const {
+        using namespace gesture_detail;
+        int32_t dx = (int32_t)m_lastX - m_startX;
+        int32_t dy = (int32_t)m_lastY - m_startY;
+        int32_t ax = abs32(dx);
+        int32_t ay = abs32(dy);
+        if (nowMs - m_startMs > GESTURE_SWIPE_MAX_MS)
+            return none();
+        Gesture g = none();
+        g.x = m_startX;
+        g.y = m_startY;
+        // Mostly along one axis: the other moved at most half as far
+        if (ax >= GESTURE_SWIPE_MIN_PX && ax >= 2 * ay) {
+            g.type = GESTURE_SWIPE;
+            g.dir = dx < 0 ? GESTURE_DIR_LEFT : GESTURE_DIR_RIGHT;
+        } else if (ay >= GESTURE_SWIPE_MIN_PX && ay >= 2 * ax) {
+            g.type = GESTURE_SWIPE;
+            g.dir = dy < 0 ? GESTURE_DIR_UP : GESTURE_DIR_DOWN;
+        }
+        return g;
+    }
+
+    constexpr Gesture pinch(GesturePhase phase, uint32_t scale) const {
+        Gesture g = none();
+        g.type = GESTURE_PINCH;
+        g.phase = phase;
+        g.scaleQ8 = scale;
+        g.x = m_startX;
+        g.y = m_startY;
+        return g;
+    }
+
+    State m_state = IDLE;
+    bool m_moved = false;
+    uint16_t m_lastScale = GESTURE_SCALE_ONE;
+    uint16_t m_startX = 0;
+    uint16_t m_startY = 0;
+    uint16_t m_lastX = 0;
+    uint16_t m_lastY = 0;
+    uint32_t m_startMs = 0;
+    uint32_t m_startDist = 1;
+};
@@ -0,0 +1,144 @@
+#include "TouchI2cBus.h"
+
+#ifndef NATIVE
+
+#include "esp32-hal-i2c.h"
+
+// Controller number of a TwoWire instance, for the HAL calls
+static uint8_t busNumber(const TwoWire &wire) {
+#if SOC_I2C_NUM > 1
+  if (&wire == &Wire1)
+    return 1;
+#endif
+  return 0;
+}
+
+TouchI2cBus::TouchI2cBus(TwoWire &wire, uint8_t address)
+    : m_wire(wire), m_address(address), m_bus(busNumber(wire)),
+      m_failStreak(0), m_okCount(0),
+      m_probeAfter(TOUCH_I2C_PROBE_AFTER), m_stats() {}
+
+void TouchI2cBus::begin() {
+  m_wire.setTimeOut(TOUCH_I2C_TIMEOUT_MS);
+  setClock(TOUCH_I2C_FAST_HZ);
+}
+
+void TouchI2cBus::setClock(uint32_t hz) {
+  m_wire.setClock(hz);
+  m_stats.clockHz = hz;
+  m_okCount = 0;
+}
+
+void TouchI2cBus::resetStats() {
+  uint32_t hz = m_stats.clockHz;
+  m_stats = TouchI2cStats();
+  m_stats.clockHz = hz;
+}
+
+// Register write and read with a repeated start between them. TwoWire
+// queues the write of endTransmission(false) and reports only a byte count
+// from requestFrom(), so the combined transfer goes to the HAL directly to
+// get its error: ESP_FAIL is a NACK (address or data), as in
+// endTransmission().
+TouchI2cBus::Result TouchI2cBus::attemptRead(uint16_t reg, uint8_t *data,
+                                             size_t len) {
+  const uint8_t addr[2] = {(uint8_t)(reg >> 8), (uint8_t)(reg & 0xFF)};
+  size_t got = 0;
+  esp_err_t err =
+      i2cWriteReadNonStop(m_bus, m_address, addr, sizeof(addr), data, len,
+                          TOUCH_I2C_TIMEOUT_MS, &got);
+  if (err == ESP_FAIL)
+    return NACK;
+  if (err == ESP_ERR_TIMEOUT)
+    return TIMEOUT;
+  if (err != ESP_OK || got != len)
+    return OTHER;
+  return OK;
+}
+
+TouchI2cBus::Result TouchI2cBus::attemptWrite(uint16_t reg, const uint8_t *data,
+                                              size_t len) {
+  m_wire.beginTransmission(m_address);
+  m_wire.write(reg >> 8);
+  m_wire.write(reg & 0xFF);
+  m_wire.write(data, len);
+  uint8_t rc = m_wire.endTransmission();
+  return rc == 0 ? OK : rc == 2 || rc == 3 ? NACK : rc == 5 ? TIMEOUT : OTHER;
+}
+
+bool TouchI2cBus::readRegister(uint16_t reg, uint8_t *data, size_t len) {
+  uint32_t start = micros();
+  for (int attempt = 0;; attempt++) {
+    Result r = attemptRead(reg, data, len);
+    if (r == OK)
+      return finish(start, true);
+    m_stats.nacks += r == NACK;
+    m_stats.timeouts += r == TIMEOUT;
+    m_stats.otherErrors += r == OTHER;
+    if (attempt == TOUCH_I2C_MAX_RETRIES)
+      return finish(start, false);
+    m_stats.retries++;
+    delayMicroseconds(TOUCH_I2C_BACKOFF_US << attempt);
+  }
+}
+
+bool TouchI2cBus::writeRegister(uint16_t reg, const uint8_t *data, size_t len) {
+  uint32_t start = micros();
+  for (int attempt = 0;; attempt++) {
+    Result r = attemptWrite(reg, data, len);
+    if (r == OK)
+      return finish(start, true);
+    m_stats.nacks += r == NACK;
+    m_stats.timeouts += r == TIMEOUT;
+    m_stats.otherErrors += r == OTHER;
+    if (attempt == TOUCH_I2C_MAX_RETRIES)
+      return finish(start, false);
+    m_stats.retries++;
+    delayMicroseconds(TOUCH_I2C_BACKOFF_US << attempt);
+  }
+}
+
+// Account for a finished transaction and adapt the clock
+bool TouchI2cBus::finish(uint32_t startUs, bool ok) {
+  m_stats.transactions++;
+  if (!ok) {
+    m_stats.failures++;
+    if (++m_failStreak < TOUCH_I2C_FALLBACK_FAILURES)
+      return false;
+    m_failStreak = 0;
+    if (m_stats.clockHz != TOUCH_I2C_SLOW_HZ) {
+      // Fast Mode failing again soon after a probe backs off further
+      if (m_stats.fallbacks == 0 || m_okCount >= m_probeAfter)
+        m_probeAfter = TOUCH_I2C_PROBE_AFTER;
+      else if (m_probeAfter < TOUCH_I2C_PROBE_AFTER_MAX)
+        m_probeAfter *= 2;
+      m_stats.fallbacks++;
+      setClock(TOUCH_I2C_SLOW_HZ);
+    }
+    return false;
+  }
+
+  m_failStreak = 0;
+  uint32_t us = micros() - startUs;
+  m_stats.totalUs += us;
+  if (us > m_stats.maxUs)
+    m_stats.maxUs = us;
+
+  m_okCount++;
+  if (m_stats.clockHz == TOUCH_I2C_SLOW_HZ && m_okCount >= m_probeAfter)
+    setClock(TOUCH_I2C_FAST_HZ);
+  return true;
+}
+
+void TouchI2cBus::printStats() const {
+  TouchI2cStats s = stats();
+  Serial.printf("[I2C] %u kHz, %u transactions, %u failed, %u retries "
+                "(nack %u, timeout %u, other %u), %u fallbacks, avg %u us, "
+                "max %u us\n",
+                (unsigned)(s.clockHz / 1000), (unsigned)s.transactions,
+                (unsigned)s.failures, (unsigned)s.retries, (unsigned)s.nacks,
+                (unsigned)s.timeouts, (unsigned)s.otherErrors,
+                (unsigned)s.fallbacks, (unsigned)s.avgUs(), (unsigned)s.maxUs);
+}
+
+#endif // NATIVE
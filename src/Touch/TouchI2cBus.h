@@ -0,0 +1,85 @@
+#pragma once
+
+#include <Arduino.h>
+
+#ifndef NATIVE
+
+#include <Wire.h>
+
+/**
+ * Register access to the touch controller over I2C, with error handling
+ * and statistics.
+ *
+ * Runs at 400 kHz Fast Mode. A transfer that NACKs or times out is retried
+ * up to TOUCH_I2C_MAX_RETRIES times with exponential backoff. Only after
+ * TOUCH_I2C_FALLBACK_FAILURES transactions in a row failed despite the
+ * retries does the bus drop to 100 kHz; it probes Fast Mode again after
+ * TOUCH_I2C_PROBE_AFTER good transactions, waiting twice as long each time
+ * Fast Mode fails again soon after a probe.
+ *
+ * Used from one task (the touch reader). stats() may be called from any
+ * task; the counters are 32-bit words written by that task only, so a
+ * snapshot can mix values from adjacent transactions but never tears one.
+ */
+
+#define TOUCH_I2C_FAST_HZ 400000
+#define TOUCH_I2C_SLOW_HZ 100000
+#define TOUCH_I2C_TIMEOUT_MS 10
+#define TOUCH_I2C_MAX_RETRIES 3
+#define TOUCH_I2C_BACKOFF_US 200 // before the first retry, doubled per retry
+#define TOUCH_I2C_FALLBACK_FAILURES 2
+#define TOUCH_I2C_PROBE_AFTER 1000
+#define TOUCH_I2C_PROBE_AFTER_MAX 64000
+
+struct TouchI2cStats {
+    uint32_t transactions; // register reads and writes requested
+    uint32_t failures;     // transactions that failed after all retries
+    uint32_t retries;
+    uint32_t nacks;        // failed attempts: address or data NACK
+    uint32_t timeouts;     // failed attempts: bus timeout
+    uint32_t otherErrors;  // failed attempts: anything else, short reads included
+    uint32_t fallbacks;    // switches to TOUCH_I2C_SLOW_HZ
+    uint32_t totalUs;      // time in successful transactions, retries included
+    uint32_t maxUs;
+    uint32_t clockHz;      // current bus clock
+
+    uint32_t avgUs() const {
+        uint32_t ok = transactions - failures;
+        return ok ? totalUs / ok : 0;
+    }
+};
+
+class TouchI2cBus {
+public:
+    TouchI2cBus(TwoWire& wire, uint8_t address);
+
+    /** Set the clock and timeout. Call after the controller driver's begin(). */
+    void begin();
+
+    /** 16-bit big-endian register address, as used by the GT911. */
+    bool readRegister(uint16_t reg, uint8_t* data, size_t len);
+    bool writeRegister(uint16_t reg, const uint8_t* data, size_t len);
+
+    TouchI2cStats stats() const { return m_stats; }
+    void resetStats();
+    /** Print the counters to Serial. */
+    void printStats() const;
+
+private:
+    enum Result : uint8_t { OK, NACK, TIMEOUT, OTHER };
+
+    Result attemptRead(uint16_t reg, uint8_t* data, size_t len);
+    Result attemptWrite(uint16_t reg, const uint8_t* data, size_t len);
+    bool finish(uint32_t startUs, bool ok);
+    void setClock(uint32_t hz);
+
+    TwoWire& m_wire;
+    uint8_t m_address;
+    uint8_t m_bus;         // I2C controller of m_wire
+    uint8_t m_failStreak;
+    uint32_t m_okCount;    // good transactions since the last clock change
+    uint32_t m_probeAfter; // good transactions before probing Fast Mode
+    TouchI2cStats m_stats;
+};
+
+#endif // NATIVE
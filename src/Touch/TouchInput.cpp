@@ -0,0 +1,127 @@
+#include "TouchInput.h"
+#include "../Util/SpscRing.h"
+
+static void (*s_onSample)() = nullptr;
+static SpscRing<TouchSample, TOUCH_QUEUE_SIZE> s_ring;
+
+#ifndef NATIVE
+
+// GT911 registers
+#define GT911_INFO_REG 0x814E // bit 7: new data, bits 3..0: contacts
+#define GT911_POINTS_REG 0x814F
+#define GT911_POINT_BYTES 8 // track ID, x, y, size (little-endian), reserved
+
+static TouchI2cBus *s_bus = nullptr;
+static TaskHandle_t s_task = nullptr;
+
+// Read all contacts. Returns false if the controller had no new data (or
+// the bus failed, which the bus statistics record).
+static bool readController(TouchSample &sample) {
+  uint8_t info;
+  if (!s_bus->readRegister(GT911_INFO_REG, &info, 1) || !(info & 0x80))
+    return false;
+
+  sample = {};
+  sample.timestamp = millis();
+  uint8_t count = info & 0x0F;
+  sample.count = count > TOUCH_MAX_POINTS ? TOUCH_MAX_POINTS : count;
+  uint8_t raw[TOUCH_MAX_POINTS * GT911_POINT_BYTES];
+  bool ok = sample.count == 0 ||
+            s_bus->readRegister(GT911_POINTS_REG, raw,
+                                sample.count * GT911_POINT_BYTES);
+  // Hand the buffer back to the controller
+  const uint8_t zero = 0;
+  s_bus->writeRegister(GT911_INFO_REG, &zero, 1);
+  if (!ok)
+    return false;
+
+  for (uint8_t i = 0; i < sample.count; i++) {
+    const uint8_t *p = &raw[i * GT911_POINT_BYTES];
+    sample.points[i] = {(uint16_t)(p[1] | p[2] << 8),
+                        (uint16_t)(p[3] | p[4] << 8), p[0]};
+  }
+  return true;
+}
+
+static void IRAM_ATTR touchIsr() {
+  BaseType_t higherPrioWoken = pdFALSE;
+  vTaskNotifyGiveFromISR(s_task, &higherPrioWoken);
+  portYIELD_FROM_ISR(higherPrioWoken);
+}
+
+static void touchTask(void *) {
+  bool down = false;
+  for (;;) {
+    // Block until the next interrupt; while touched, give up after the
+    // release timeout
+    TickType_t wait =
+        down ? pdMS_TO_TICKS(TOUCH_RELEASE_TIMEOUT_MS) : portMAX_DELAY;
+    if (ulTaskNotifyTake(pdTRUE, wait) == 0) {
+      TouchSample release = {};
+      release.timestamp = millis();
+      s_ring.push(release);
+      down = false;
+    } else {
+      // The GT911 also interrupts for scans with no new coordinates; only
+      // changes of the touched state or real coordinates are queued
+      TouchSample sample;
+      if (!readController(sample) || (sample.count == 0 && !down))
+        continue;
+      s_ring.push(sample); // a full ring counts a drop, it never blocks
+      down = sample.count > 0;
+    }
+    if (s_onSample)
+      s_onSample();
+  }
+}
+
+void touchBegin(TouchI2cBus &bus, int8_t intPin, void (*onSample)()) {
+  s_bus = &bus;
+  s_onSample = onSample;
+  if (s_task)
+    return;
+  xTaskCreatePinnedToCore(touchTask, "touch", TOUCH_TASK_STACK_SIZE, nullptr,
+                          TOUCH_TASK_PRIORITY, &s_task, TOUCH_TASK_CORE);
+
+  // Replace the driver's own INT handler. Either edge, so this works with
+  // the rising or falling trigger in the GT911 config; the notification
+  // count is cleared per read, so a pulse costs at most one extra read.
+  detachInterrupt(digitalPinToInterrupt(intPin));
+  pinMode(intPin, INPUT);
+  attachInterrupt(digitalPinToInterrupt(intPin), touchIsr, CHANGE);
+}
+
+bool touchGetSample(TouchSample &out) { return s_ring.pop(out); }
+
+bool touchHasSample() { return !s_ring.empty(); }
+
+#else
+
+static GT911 *s_controller = nullptr;
+
+void touchBegin(GT911 &controller, int8_t, void (*onSample)()) {
+  s_controller = &controller;
+  s_onSample = onSample;
+}
+
+// No reader task: poll the stub once per LVGL read
+bool touchGetSample(TouchSample &out) {
+  if (s_ring.pop(out))
+    return true;
+  if (!s_controller)
+    return false;
+  out = {};
+  out.timestamp = millis();
+  uint8_t count = s_controller->touched(GT911_MODE_POLLING);
+  out.count = count > TOUCH_MAX_POINTS ? TOUCH_MAX_POINTS : count;
+  const GTPoint *tp = s_controller->getPoints();
+  for (uint8_t i = 0; i < out.count; i++)
+    out.points[i] = {tp[i].x, tp[i].y, tp[i].trackId};
+  return true;
+}
+
+bool touchHasSample() { return !s_ring.empty(); }
+
+#endif
+
+uint32_t touchDroppedSamples() { return s_ring.dropped(); }
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "GT911.h"
+#include "TouchI2cBus.h"
+
+/**
+ * Interrupt-driven GT911 touch input.
+ *
+ * The controller's INT line triggers an ISR that only notifies a reader
+ * task. The reader pulls every contact from the GT911 registers through
+ * TouchI2cBus (400 kHz, retries, statistics) into a lock-free sample ring
+ * and calls onSample (lvglWake), so LVGL reads touch as soon as it happens
+ * and touch_read_cb never waits on the I2C bus. While a finger is down the
+ * GT911 interrupts once per scan; if the interrupts stop without a
+ * zero-contact report the reader synthesizes the release.
+ *
+ * The host build has no interrupts or tasks: touchGetSample() reads the
+ * (stubbed) controller directly.
+ */
+
+#define TOUCH_MAX_POINTS GT911_MAX_CONTACTS
+// Samples buffered between the reader task and the LVGL task. Must be a
+// power of two.
+#define TOUCH_QUEUE_SIZE 32
+// No interrupt for this long while touched means the finger was lifted
+#define TOUCH_RELEASE_TIMEOUT_MS 60
+// Above the LVGL task, so a touch is read before the next frame is drawn
+#define TOUCH_TASK_PRIORITY 4
+#define TOUCH_TASK_CORE 1
+#define TOUCH_TASK_STACK_SIZE 3072
+
+struct TouchPoint {
+    uint16_t x;
+    uint16_t y;
+    uint8_t id; // GT911 track ID, stable while the finger stays down
+};
+
+struct TouchSample {
+    uint32_t timestamp; // millis() when read from the controller
+    uint8_t count;      // 0: all fingers lifted
+    TouchPoint points[TOUCH_MAX_POINTS];
+};
+
+#ifndef NATIVE
+/**
+ * Take over the GT911's INT pin (after gt911.begin() has reset and
+ * configured it) and start the reader task, which reads through bus.
+ * onSample is called from the reader task after each new sample.
+ */
+void touchBegin(TouchI2cBus& bus, int8_t intPin, void (*onSample)());
+#else
+/** Host: samples are read from the stub (GT911::inject()). */
+void touchBegin(GT911& controller, int8_t intPin, void (*onSample)());
+#endif
+
+/** Consumer side (LVGL task): oldest buffered sample. */
+bool touchGetSample(TouchSample& out);
+bool touchHasSample();
+
+/** Samples lost because the LVGL task fell behind. */
+uint32_t touchDroppedSamples();
@@ -0,0 +1,127 @@
+#include "UiBridge.h"
+#include "LvglPort.h"
+
+enum UiMessageType : uint8_t {
+  UI_MSG_LABEL_TEXT,
+  UI_MSG_TEXTAREA_TEXT,
+  UI_MSG_BAR_VALUE,
+  UI_MSG_VISIBLE,
+  UI_MSG_SCREEN,
+};
+
+struct UiMessage {
+  UiMessageType type;
+  bool animate;
+  lv_obj_t **target;
+  int32_t value;
+  char text[UI_BRIDGE_TEXT_LEN];
+};
+
+static void apply(const UiMessage &msg) {
+  // Screens are built on first use
+  if (msg.type == UI_MSG_SCREEN) {
+    switchToScreen(msg.target);
+    return;
+  }
+  lv_obj_t *obj = *msg.target;
+  if (!obj)
+    return;
+
+  switch (msg.type) {
+  case UI_MSG_LABEL_TEXT:
+    lv_label_set_text(obj, msg.text);
+    break;
+  case UI_MSG_TEXTAREA_TEXT:
+    lv_textarea_set_text(obj, msg.text);
+    break;
+  case UI_MSG_BAR_VALUE:
+    lv_bar_set_value(obj, msg.value, msg.animate ? LV_ANIM_ON : LV_ANIM_OFF);
+    break;
+  case UI_MSG_VISIBLE:
+    if (msg.value)
+      lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    else
+      lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    break;
+  case UI_MSG_SCREEN: // above
+    break;
+  }
+}
+
+#ifndef NATIVE
+
+static QueueHandle_t s_queue = nullptr;
+
+void uiBridgeInit() {
+  if (!s_queue)
+    s_queue = xQueueCreate(UI_BRIDGE_QUEUE_LEN, sizeof(UiMessage));
+}
+
+static bool post(const UiMessage &msg) {
+  if (!s_queue || xQueueSend(s_queue, &msg, 0) != pdTRUE)
+    return false;
+  lvglWake();
+  return true;
+}
+
+void uiBridgeProcess() {
+  UiMessage msg;
+  while (xQueueReceive(s_queue, &msg, 0) == pdTRUE)
+    apply(msg);
+}
+
+#else
+
+// The host build is single threaded: apply requests immediately
+void uiBridgeInit() {}
+
+static bool post(const UiMessage &msg) {
+  apply(msg);
+  return true;
+}
+
+void uiBridgeProcess() {}
+
+#endif
+
+static bool postText(UiMessageType type, lv_obj_t **target, const char *text) {
+  UiMessage msg;
+  msg.type = type;
+  msg.animate = false;
+  msg.target = target;
+  msg.value = 0;
+  strncpy(msg.text, text ? text : "", sizeof(msg.text) - 1);
+  msg.text[sizeof(msg.text) - 1] = '\0';
+  return post(msg);
+}
+
+static bool postValue(UiMessageType type, lv_obj_t **target, int32_t value,
+                      bool animate = false) {
+  UiMessage msg;
+  msg.type = type;
+  msg.animate = animate;
+  msg.target = target;
+  msg.value = value;
+  msg.text[0] = '\0';
+  return post(msg);
+}
+
+bool uiSetLabelText(lv_obj_t **label, const char *text) {
+  return postText(UI_MSG_LABEL_TEXT, label, text);
+}
+
+bool uiSetTextareaText(lv_obj_t **textarea, const char *text) {
+  return postText(UI_MSG_TEXTAREA_TEXT, textarea, text);
+}
+
+bool uiSetBarValue(lv_obj_t **bar, int32_t value, bool animate) {
+  return postValue(UI_MSG_BAR_VALUE, bar, value, animate);
+}
+
+bool uiSetVisible(lv_obj_t **obj, bool visible) {
+  return postValue(UI_MSG_VISIBLE, obj, visible ? 1 : 0);
+}
+
+bool uiSwitchScreen(lv_obj_t **screen) {
+  return postValue(UI_MSG_SCREEN, screen, 0);
+}
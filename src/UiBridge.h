@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+/**
+ * Thread-safe UI API for code running outside the LVGL task (BLE callbacks,
+ * Wi-Fi, the Arduino loop).
+ *
+ * Requests are copied into a fixed-size message queue and applied by the
+ * LVGL task on its next iteration, so callers never block on rendering and
+ * never dereference an lv_obj_t. Widgets are named by the address of their
+ * SquareLine global (e.g. &ui_TxtWord); the pointer is only read on the LVGL
+ * task, and a request for a widget that does not exist is dropped; that
+ * includes the widgets of a screen not built at the time (ScreenManager.h).
+ * uiSwitchScreen() builds the screen if needed.
+ *
+ * All functions return false when the queue is full.
+ */
+
+#define UI_BRIDGE_QUEUE_LEN 16
+#define UI_BRIDGE_TEXT_LEN 64
+
+bool uiSetLabelText(lv_obj_t **label, const char *text);
+bool uiSetTextareaText(lv_obj_t **textarea, const char *text);
+bool uiSetBarValue(lv_obj_t **bar, int32_t value, bool animate = true);
+bool uiSetVisible(lv_obj_t **obj, bool visible);
+bool uiSwitchScreen(lv_obj_t **screen);
+
+/** Create the queue. Called once from initLVGL(). */
+void uiBridgeInit();
+
+/** Apply all queued requests. Called with the LVGL lock held. */
+void uiBridgeProcess();
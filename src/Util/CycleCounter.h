@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifndef NATIVE
+#include <Arduino.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+/**
+ * Free-running CPU cycle counter for timing short sections of code.
+ *
+ * On the ESP32-S3 this is CCOUNT (240 MHz, wraps after about 18 s). On x86
+ * hosts it is the time stamp counter; on other hosts nanoseconds stand in
+ * for cycles. Only differences of readings are meaningful, taken with
+ * unsigned 32-bit arithmetic so a single wrap is harmless.
+ */
+inline uint32_t cpuCycles() {
+#ifndef NATIVE
+    return ESP.getCycleCount();
+#elif defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+/**
+ * Fixed-capacity, allocation-free, lock-free single-producer/single-consumer
+ * ring buffer.
+ *
+ * Exactly one task may call push() and exactly one (possibly different) task
+ * may call pop()/peek(). Neither side ever blocks. When the ring is full,
+ * push() fails and the item is counted in dropped(), so loss is visible
+ * instead of silent.
+ *
+ * N must be a power of two. Indices are free-running 32-bit counters, so
+ * size() stays correct across wrap-around.
+ */
+template <typename T, size_t N>
+class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+    /** Producer side. Returns false (and counts a drop) when full. */
+    bool push(const T& item) {
+        uint32_t head = m_head.load(std::memory_order_relaxed);
+        uint32_t tail = m_tail.load(std::memory_order_acquire);
+        if (head - tail >= N) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        m_buf[head & (N - 1)] = item;
+        m_head.store(head + 1, std::memory_order_release);
+        m_pushed.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /** Consumer side. Returns false when empty. */
+    bool pop(T& out) {
+        uint32_t tail = m_tail.load(std::memory_order_relaxed);
+        uint32_t head = m_head.load(std::memory_order_acquire);
+        if (head == tail) {
+            return false;
+        }
+        out = m_buf[tail & (N - 1)];
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Consumer side. Copies the oldest item without removing it. */
+    bool peek(T& out) const {
+        uint32_t tail = m_tail.load(std::memory_order_relaxed);
+        uint32_t head = m_head.load(std::memory_order_acquire);
+        if (head == tail) {
+            return false;
+        }
+        out = m_buf[tail & (N - 1)];
+        return true;
+    }
+
+    bool empty() const {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+    size_t size() const {
+        return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+    }
+
+    static constexpr size_t capacity() { return N; }
+
+    /** Items accepted by push() since construction. */
+    uint32_t pushed() const { return m_pushed.load(std::memory_order_relaxed); }
+
+    /** Items rejected by push() because the ring was full. */
+    uint32_t dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    T m_buf[N];
+    std::atomic<uint32_t> m_head{0}; // written by the producer only
+    std::atomic<uint32_t> m_tail{0}; // written by the consumer only
+    std::atomic<uint32_t> m_pushed{0};
+    std::atomic<uint32_t> m_dropped{0};
+};
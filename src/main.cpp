@@ -7,9 +7,18 @@
 #include <vector>
 
 #include "esp_heap_caps.h"
-#include "ui/ui.h" // SquareLine export (ui_init)
+#include "ui/ui.h" // SquareLine export (screens)
 
+#include "Assets/AssetFont.h"
+#include "Assets/AssetStore.h"
 #include "BLE/BleKeyboardHost.h"
+#include "BLE/HidTrace.h"
+#include "DictionaryView.h"
+#include "Display/SpiClock.h"
+#include "Display/TftDmaTransport.h"
+#include "LvglPort.h"
+#include "ScreenManager.h"
+#include "Touch/TouchInput.h"
 
 #include "GT911.h"
 #include "TFT_eSPI.h"
@@ -23,99 +32,47 @@
 #define I2C_SDA_PIN 8   // BSP_I2C_SDA
 #define I2C_SCL_PIN 18  // BSP_I2C_SCL
 
-// Touch configuration
-#define TOUCH_I2C_ADDR 0x5D   // GT911 default address
-#define TOUCH_I2C_FREQ 100000 // 100kHz for compatibility
+// Touch configuration (bus speed: Touch/TouchI2cBus.h)
+#define TOUCH_I2C_ADDR 0x5D // GT911 default address
+
+// Display render mode (LvglPort.h). The full-frame modes keep a 150 KB frame
+// in PSRAM.
+#define LCD_RENDER_MODE RENDER_BANDED
+
+// Draw buffers (LvglPort.h): {rows, count, caps}. E.g. {20, 3, MALLOC_CAP_
+// INTERNAL | MALLOC_CAP_DMA} to leave more internal RAM to Wi-Fi/TLS, or
+// {80, 2, MALLOC_CAP_SPIRAM} to leave all but two 6 KB bounce buffers.
+#define LCD_DRAW_BUF_CONFIG DRAW_BUF_DEFAULT_CONFIG
 
 // ============================================================================
 // GLOBAL VARIABLES
 // ============================================================================
 
 TFT_eSPI tft;
+TftDmaTransport lcdTransport(tft);
 GT911 gt911;
+TouchI2cBus touchBus(Wire, TOUCH_I2C_ADDR);
 BleKeyboardHost bleKeyboardHost;
 
-// LVGL Display Buffers - Double buffering for smooth graphics
-// Buffer size: 320 pixels wide × 40 lines high × 2 bytes per pixel = 25,600
-// bytes
-#define BUF_ROWS 40
-static lv_disp_draw_buf_t draw_buf;
-static lv_color_t buf1[320 * BUF_ROWS]; // Primary buffer
-static lv_color_t buf2[320 * BUF_ROWS]; // Secondary buffer
-
-// LVGL Display Driver
-static lv_disp_drv_t disp_drv;
-
-lv_indev_t *g_keyboard_indev = nullptr;
 // ============================================================================
 // FUNCTION DECLARATIONS
 // ============================================================================
 
 static void dumpHeap(const char *tag);
-void initLVGL();
-void touch_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data);
-void keyboard_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data);
 
 // ============================================================================
-// LVGL DISPLAY FLUSH CALLBACK
+// BLE CALLBACKS
 // ============================================================================
-
 /**
- * This function is called by LVGL when a display buffer is ready to be sent to
- * the TFT.
- *
- * How it works:
- * 1. LVGL draws content into buf1 or buf2 in RAM
- * 2. When a buffer is full, LVGL calls this function
- * 3. We copy the buffer content to the TFT display via SPI
- * 4. LVGL continues drawing the next frame while we update the display
- *
- * This enables smooth, flicker-free graphics!
+ * Input report handler (notification or indication). Runs in the NimBLE
+ * host task on every key report, so it must not allocate or print; build
+ * with -D HID_TRACE to log the raw reports from a background task instead.
  */
-void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area,
-                   lv_color_t *color_p) {
-  uint32_t w = (area->x2 - area->x1 + 1);
-  uint32_t h = (area->y2 - area->y1 + 1);
-
-  // Set the display window to the area we need to update
-  tft.startWrite();
-  tft.setAddrWindow(area->x1, area->y1, w, h);
-
-  // Push pixels (not swapped colors) to the TFT display
-  tft.pushPixels((uint16_t *)color_p,
-                 (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1));
-  tft.endWrite();
-
-  // Tell LVGL we're done flushing this area
-  lv_disp_flush_ready(disp);
-}
-
-// ============================================================================
-// BLE CALLBACKS
-// ============================================================================
-/** Notification / Indication receiving handler callback */
-void notifyCB(NimBLERemoteCharacteristic *pRemoteCharacteristic, uint8_t *pData,
+void notifyCB(uint16_t connHandle, uint16_t handle, uint8_t *pData,
               size_t length, bool isNotify) {
-  Serial.printf("=== NOTIFICATION CALLBACK EXECUTED ===\n");
-  std::string str = (isNotify == true) ? "Notification" : "Indication";
-  str += " from ";
-  str += pRemoteCharacteristic->getClient()->getPeerAddress().toString();
-  str += ": Service = " +
-         pRemoteCharacteristic->getRemoteService()->getUUID().toString();
-  str += ", Characteristic = " + pRemoteCharacteristic->getUUID().toString();
-  str += ", Handle = " + std::to_string(pRemoteCharacteristic->getHandle());
-  str += ", Value = [";
-  for (size_t i = 0; i < length; i++) {
-    if (i > 0)
-      str += ", ";
-    char hexStr[8];
-    sprintf(hexStr, "0x%02X", pData[i]);
-    str += hexStr;
-  }
-  str += "]";
-  Serial.printf("%s\n", str.c_str());
-
-  bleKeyboardHost.parseHIDReport(pData, length);
+  hidTraceRecord(handle, pData, length, isNotify);
+  bleKeyboardHost.parseHIDReport(connHandle, handle, pData, length);
+  lvglWake();
 }
 
 // ============================================================================
@@ -137,6 +94,52 @@ static void dumpHeap(const char *tag) {
   pr("SPIRAM", MALLOC_CAP_SPIRAM);
 #endif
   Serial.printf("[MEM] ESP.getFreeHeap(): %u\n", ESP.getFreeHeap());
+
+  // Screens built so far, in LVGL's own heap
+  const ScreenStats &ss = screenStats();
+  if (ss.builds) {
+    Serial.printf("[MEM] screens: %u built (%u prebuilt), %u destroyed, "
+                  "LVGL heap %u, peak %u\n",
+                  ss.builds, ss.prebuilds, ss.destroys, (unsigned)ss.heapUsed,
+                  (unsigned)ss.heapPeak);
+  }
+}
+
+// Draw buffers and the throughput they achieve; from loop(), once LVGL has
+// flushed for a while
+static void printDisplayStats() {
+  const DrawBufConfig &db = drawBufConfig();
+  if (!db.count)
+    return;
+  lvglLock();
+  FlushTransport::Stats st = lcdTransport.stats();
+  lvglUnlock();
+  Serial.printf("[LCD] draw buf: %u x %u rows in %s (%u bytes), mode %u\n",
+                db.count, db.rows,
+                (db.caps & MALLOC_CAP_SPIRAM) ? "SPIRAM" : "INTERNAL",
+                (unsigned)(db.count * db.rows * LCD_H_RES * sizeof(lv_color_t)),
+                (unsigned)renderMode());
+  // Bytes per microsecond of transfer time = MB/s on the wire
+  Serial.printf("[LCD] flush: %u windows, %llu pixels, %.2f MB/s\n",
+                st.windows, (unsigned long long)st.pixels,
+                st.busyUs ? (double)st.pixels * sizeof(lv_color_t) / st.busyUs
+                          : 0.0);
+}
+
+// Glyph cache of the pack fonts; from loop(), next to printDisplayStats(),
+// once pages have been drawn with them. The LVGL task updates the counters.
+static void printFontStats() {
+  lvglLock();
+  GlyphCache::Stats fc = fontCacheStats();
+  lvglUnlock();
+  if (!fc.slots)
+    return;
+  uint32_t lookups = fc.hits + fc.misses;
+  Serial.printf("[FONT] glyph cache: %u/%u glyphs of %u bytes (%u bytes), "
+                "%u hits, %u misses (%.1f%%), %u evicted\n",
+                fc.used, fc.slots, fc.slotBytes, (unsigned)fc.bytes, fc.hits,
+                fc.misses, lookups ? 100.0 * fc.hits / lookups : 0.0,
+                fc.evictions);
 }
 
 // ============================================================================
@@ -162,148 +165,6 @@ void manualResetAndBacklight() {
   Serial.println("Backlight turned on");
 }
 
-// ============================================================================
-// LVGL INITIALIZATION
-// ============================================================================
-
-void initLVGL() {
-  Serial.println("Initializing LVGL...");
-
-  // Initialize LVGL core
-  lv_init();
-
-  // Initialize display buffers for double buffering
-  // This prevents flickering and enables smooth animations
-  lv_disp_draw_buf_init(&draw_buf, buf1, buf2, 320 * BUF_ROWS);
-
-  // Initialize and configure the display driver
-  lv_disp_drv_init(&disp_drv);
-  disp_drv.hor_res = 320;                            // Display width
-  disp_drv.ver_res = 240;                            // Display height
-  disp_drv.flush_cb = my_disp_flush;                 // Our callback function
-  disp_drv.draw_buf = &draw_buf;                     // Use our buffers
-  lv_disp_t *disp = lv_disp_drv_register(&disp_drv); // Register the driver
-
-  // Create input device for touch
-  static lv_indev_drv_t touch_drv;
-  lv_indev_drv_init(&touch_drv);
-  touch_drv.type = LV_INDEV_TYPE_POINTER;
-  touch_drv.read_cb = touch_read_cb;
-  touch_drv.disp = disp;
-  lv_indev_drv_register(&touch_drv);
-
-  // Create input device for keyboard
-  static lv_indev_drv_t keyboard_drv;
-  lv_indev_drv_init(&keyboard_drv);
-  keyboard_drv.type = LV_INDEV_TYPE_KEYPAD;
-  keyboard_drv.read_cb = keyboard_read_cb;
-  keyboard_drv.disp = disp;
-  g_keyboard_indev = lv_indev_drv_register(&keyboard_drv);
-
-  Serial.println("LVGL initialized successfully");
-}
-
-// ============================================================================
-// LVGL TOUCH READ CALLBACK
-// ============================================================================
-
-void touch_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
-  // use GT911_MODE_INTERRUPT for less queries to the touch controller
-  if (gt911.touched(GT911_MODE_INTERRUPT)) {
-    Serial.println("Touch detected");
-    // Get touch points
-    GTPoint *tp = gt911.getPoints();
-
-    // Use first touch point
-    uint16_t x = tp[0].x;
-    uint16_t y = tp[0].y;
-
-    data->point.x = x;
-    data->point.y = y;
-    data->state = LV_INDEV_STATE_PRESSED;
-
-    Serial.printf("Touch: (%d,%d)\n", x, y);
-  } else {
-    data->state = LV_INDEV_STATE_RELEASED;
-  }
-}
-
-// ============================================================================
-// LVGL KEYBOARD READ CALLBACK
-// ============================================================================
-
-void keyboard_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
-    // Check if we have any keys from the BLE keyboard
-    if (bleKeyboardHost.hasKey()) {
-        KeyEvent keyEvent = bleKeyboardHost.getKey();
-        
-        // Set the key data for LVGL
-        data->key = keyEvent.keycode;
-        data->state = keyEvent.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
-        
-        // Debug output
-        Serial.printf("Key: 0x%04X, State: %s\n", keyEvent.keycode, 
-                     keyEvent.pressed ? "PRESSED" : "RELEASED");
-    } else {
-        // No keys available
-        data->state = LV_INDEV_STATE_RELEASED;
-    }
-}
-
-// ============================================================================
-// SET KEYBOARD GROUP
-// ============================================================================
-void activateKeyboardGroupForScreen(lv_obj_t *screen);
-void addInputElementsRecursive(lv_obj_t *obj, lv_group_t *group);
-
-void switchToScreen(lv_obj_t *screen) {
-  lv_scr_load(screen);
-  activateKeyboardGroupForScreen(screen);
-}
-
-void activateKeyboardGroupForScreen(lv_obj_t *screen) {
-    // Create or get the keyboard group (create once, reuse)
-    static lv_group_t *keyboard_group = nullptr;
-    if (!keyboard_group) {
-        keyboard_group = lv_group_create();
-        lv_group_set_default(keyboard_group);
-    }
-    
-    // Clear existing objects from the group
-    lv_group_remove_all_objs(keyboard_group);
-    
-    // Recursively add all input elements to the group
-    addInputElementsRecursive(screen, keyboard_group);
-    
-    // Assign the group to the keyboard input device
-    lv_indev_set_group(g_keyboard_indev, keyboard_group);
-}
-
-void addInputElementsRecursive(lv_obj_t *obj, lv_group_t *group) {
-    if (!obj) return;
-    
-    // Check if this object is an input element using LVGL's class checking
-    if (lv_obj_check_type(obj, &lv_textarea_class) || 
-        lv_obj_check_type(obj, &lv_dropdown_class) ||
-        lv_obj_check_type(obj, &lv_spinbox_class) ||
-        lv_obj_check_type(obj, &lv_slider_class) ||
-        lv_obj_check_type(obj, &lv_checkbox_class) ||
-        lv_obj_check_type(obj, &lv_switch_class) ||
-        lv_obj_check_type(obj, &lv_btnmatrix_class) ||
-        lv_obj_check_type(obj, &lv_roller_class)) {
-        
-        lv_group_add_obj(group, obj);
-        Serial.printf("Added input element to keyboard group\n");
-    }
-    
-    // Recursively check all children using LVGL's public API
-    uint32_t child_count = lv_obj_get_child_cnt(obj);
-    for (uint32_t i = 0; i < child_count; i++) {
-        lv_obj_t *child = lv_obj_get_child(obj, i);
-        addInputElementsRecursive(child, group);
-    }
-}
-
 // ============================================================================
 // MAIN SETUP FUNCTION
 // ============================================================================
@@ -321,22 +182,37 @@ void setup() {
   // Initialize TFT display
   tft.begin();
   tft.setRotation(3); // Landscape orientation
+  // Fastest SPI clock the panel link passes readback tests at
+  spiClockBegin(tft);
+
+  // UI images are read in place from the asset partition
+  assetsBegin();
 
   // Initialize LVGL graphics library
-  initLVGL();
+  initLVGL(lcdTransport, LCD_RENDER_MODE, LCD_DRAW_BUF_CONFIG);
 
   // Monitor memory before UI initialization
   dumpHeap("Before UI init");
 
-  // Initialize SquareLine Studio generated UI
-  ui_init();
+  // SquareLine Studio generated UI, each screen built on first use
+  screenSetBuiltHook(&ui_Main, dictionaryViewInit);
+  screenManagerInit();
 
-  gt911.begin(TS_IRQ, TFT_BOX_3_RESET);
+  // The driver resets and configures the controller; from then on touch is
+  // read by its own task on the INT line, through touchBus
+  gt911.begin(TOUCH_INT_PIN, TFT_BOX_3_RESET, TOUCH_I2C_ADDR, TOUCH_I2C_FAST_HZ);
+  touchBus.begin();
+  touchBegin(touchBus, TOUCH_INT_PIN, lvglWake);
 
+  hidTraceBegin();
   bleKeyboardHost.setNotifyCB(notifyCB);
   bleKeyboardHost.begin();
 
-  switchToScreen(ui_WIFI_Settings);
+  switchToScreen(&ui_WIFI_Settings);
+  dumpHeap("After UI init");
+
+  // From here on LVGL belongs to its own task; use UiBridge.h to update the UI
+  startLvglTask();
 
   Serial.println("Setup() completed successfully");
 }
@@ -346,23 +222,19 @@ void setup() {
 // ============================================================================
 
 void loop() {
-  // Handle LVGL tasks (drawing, animations, events)
-  lv_timer_handler();
-
-  // No need to check touchDetected anymore - LVGL handles touch via callback
-
-  // Increment LVGL tick for timing
-  lv_tick_inc(5);
-
+  // LVGL runs in its own task (see startLvglTask()); this loop only services
+  // the BLE connection state machine and diagnostics.
   bleKeyboardHost.tick();
 
   // Print debug info every 10 seconds
   static unsigned long lastPrint = 0;
   if (millis() - lastPrint >= 10000) {
     Serial.printf("Loop running, free heap: %u bytes\n", ESP.getFreeHeap());
+    touchBus.printStats();
+    printDisplayStats();
+    printFontStats();
     lastPrint = millis();
   }
 
-  // Small delay to prevent watchdog issues
-  delay(5);
+  delay(10);
 }
@@ -0,0 +1,437 @@
+// Frame-time and flush-throughput benchmark for the SquareLine screens
+// (native environment, [env:native_bench]).
+//
+// Every screen is loaded through switchToScreen() and then redrawn N times in
+// three scenarios:
+//   full     - the whole screen is invalidated
+//   partial  - one representative widget is invalidated (dirty rect)
+//   children - every direct child of the screen is invalidated, which leaves
+//              LVGL with many small, often overlapping areas
+// For each (screen, scenario) one JSON object is printed per line with frame
+// time percentiles and flush statistics, so runs can be diffed or plotted.
+// windows_per_frame counts address windows, each costing setup_us of SPI
+// command overhead on top of the pixel data. render_cycles_per_px is the CPU
+// time LVGL spent per pixel sent (Util/CycleCounter.h).
+//
+// Every screen also reports first_frame: the time from loading it to its
+// first frame on the wire, including building the screen (ScreenManager.h,
+// prebuilding is off) and image decoding.
+//
+// The boot line gives the time from setting up the UI to the splash screen
+// on the wire and the LVGL heap it then uses; the screens line at the end
+// the builds and destroys of the run and the LVGL heap high-water mark.
+// --eager builds every screen up front with ui_init() for comparison.
+//
+// image lines give the flash size of each UI image (RLE encoded against the
+// raw SquareLine export with alpha) and the time to decode one draw buffer
+// band of it through the LVGL decoder (Display/RleImage.h).
+//
+// With --assets, the pack file (tools/asset_pack.py) is mapped first and
+// every entry looked up by name; images are decoded through the pack
+// decoder and compared with the images built into the program. One assets
+// line reports the result and the lookup time; any mismatch exits with
+// status 1.
+//
+// With a pack that has the dictionary fonts (assets/fonts.txt), ui_Main
+// shows a sample entry with IPA in them, and a font_cache line reports the
+// glyph cache (Assets/AssetFont.h) over the whole run; --font-cache sets
+// its budget in bytes.
+//
+// Before that, byte_order lines give the CPU cycles per pixel of each way
+// to get LVGL's pixels into panel byte order: render (LV_COLOR_16_SWAP, what
+// LvglPort does), transport (one software pass, as TFT_eSPI's
+// setSwapBytes(true)) and double (both). That the colors arrive right is
+// checked in test/test_color_order.
+//
+// Usage: program [-n iterations] [--spi-hz hz] [--mode banded|full|coalesced]
+//                [--buf-rows rows] [--buf-count 1|2|3] [--assets pack.bin]
+//                [--font-cache bytes] [--eager]
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "Assets/AssetFont.h"
+#include "Assets/AssetStore.h"
+#include "DictionaryView.h"
+#include "Display/FramebufferTransport.h"
+#include "LvglPort.h"
+#include "ScreenManager.h"
+#include "Util/CycleCounter.h"
+#include "ui/ui.h"
+
+GT911 gt911;
+BleKeyboardHost bleKeyboardHost;
+
+struct Sample {
+  uint32_t frameUs;  // invalidate -> last pixel on the (simulated) wire
+  uint32_t renderUs; // CPU time spent in LVGL (frame minus bus stalls)
+  uint32_t stallUs;  // time rendering was blocked on the bus
+  uint32_t flushes;
+  uint32_t windows;
+  uint64_t pixels;
+  uint32_t cycles; // CPU cycles of the whole frame
+};
+
+static FramebufferTransport *framebuffer = nullptr;
+
+static void settle(uint32_t ms) {
+  uint32_t start = millis();
+  do {
+    lv_timer_handler();
+    framebuffer->poll();
+  } while (millis() - start < ms);
+  framebuffer->waitIdle();
+}
+
+static void invalidateChildren(lv_obj_t *parent) {
+  uint32_t n = lv_obj_get_child_cnt(parent);
+  for (uint32_t i = 0; i < n; i++)
+    lv_obj_invalidate(lv_obj_get_child(parent, i));
+}
+
+static Sample redraw(lv_obj_t *target, bool children = false) {
+  framebuffer->resetStats();
+  uint32_t startCycles = cpuCycles();
+  uint32_t start = micros();
+  if (children)
+    invalidateChildren(target);
+  else
+    lv_obj_invalidate(target);
+  lv_refr_now(NULL);
+  framebuffer->waitIdle();
+  uint32_t cycles = cpuCycles() - startCycles;
+
+  const FlushTransport::Stats &st = framebuffer->stats();
+  Sample s;
+  s.cycles = cycles;
+  s.frameUs = micros() - start;
+  s.stallUs = (uint32_t)st.waitUs;
+  s.renderUs = s.frameUs > s.stallUs ? s.frameUs - s.stallUs : 0;
+  s.flushes = st.transfers;
+  s.windows = st.windows;
+  s.pixels = st.pixels;
+  return s;
+}
+
+static uint32_t percentile(std::vector<uint32_t> v, uint32_t pct) {
+  std::sort(v.begin(), v.end());
+  size_t idx = (v.size() * pct + 99) / 100;
+  return v[idx ? idx - 1 : 0];
+}
+
+static const char *const MODE_NAMES[] = {"banded", "full", "coalesced"};
+
+static void report(const char *screen, const char *scenario,
+                   const std::vector<Sample> &samples, uint32_t spiHz) {
+  std::vector<uint32_t> frame, render, stall, cyclesPerPx;
+  uint64_t flushes = 0, windows = 0, pixels = 0;
+  for (const Sample &s : samples) {
+    frame.push_back(s.frameUs);
+    render.push_back(s.renderUs);
+    stall.push_back(s.stallUs);
+    // The rendering share of the frame's cycles, per pixel sent
+    uint64_t renderCycles =
+        s.frameUs ? (uint64_t)s.cycles * s.renderUs / s.frameUs : 0;
+    cyclesPerPx.push_back(
+        s.pixels ? (uint32_t)(renderCycles / s.pixels) : 0);
+    flushes += s.flushes;
+    windows += s.windows;
+    pixels += s.pixels;
+  }
+  size_t n = samples.size();
+
+  const DrawBufConfig &db = drawBufConfig();
+  printf("{\"screen\":\"%s\",\"scenario\":\"%s\",\"mode\":\"%s\","
+         "\"buf_rows\":%u,\"buf_count\":%u,\"iterations\":%zu,"
+         "\"spi_hz\":%u,\"frame_us_p50\":%u,\"frame_us_p99\":%u,"
+         "\"render_us_p50\":%u,\"render_us_p99\":%u,"
+         "\"stall_us_p50\":%u,\"stall_us_p99\":%u,\"flushes_per_frame\":%.2f,"
+         "\"windows_per_frame\":%.2f,\"setup_us_per_frame\":%.1f,"
+         "\"render_cycles_per_px\":%u,"
+         "\"pixels_per_frame\":%llu,\"bytes_per_frame\":%llu}\n",
+         screen, scenario, MODE_NAMES[renderMode()], db.rows, db.count, n,
+         spiHz,
+         percentile(frame, 50), percentile(frame, 99), percentile(render, 50),
+         percentile(render, 99), percentile(stall, 50), percentile(stall, 99),
+         (double)flushes / n, (double)windows / n,
+         (double)windows * framebuffer->setupUs() / n,
+         percentile(cyclesPerPx, 50),
+         (unsigned long long)(pixels / n),
+         (unsigned long long)(pixels / n * sizeof(lv_color_t)));
+}
+
+static void swapPass(uint16_t *px, size_t n) {
+  for (size_t i = 0; i < n; i++)
+    px[i] = (uint16_t)(px[i] << 8 | px[i] >> 8);
+}
+
+static void reportByteOrder(uint32_t iterations) {
+  static uint16_t band[LCD_H_RES * 40];
+  const size_t n = sizeof(band) / sizeof(band[0]);
+  for (size_t i = 0; i < n; i++)
+    band[i] = (uint16_t)(i * 2654435761u);
+
+  static const struct {
+    const char *mode;
+    uint8_t passes;
+  } modes[] = {{"render", 0}, {"transport", 1}, {"double", 2}};
+  for (const auto &m : modes) {
+    std::vector<uint32_t> perPx;
+    for (uint32_t it = 0; it < iterations; it++) {
+      uint32_t start = cpuCycles();
+      for (uint8_t p = 0; p < m.passes; p++)
+        swapPass(band, n);
+      // Keep the passes from being merged or dropped
+      __asm__ volatile("" : : "r"(band) : "memory");
+      perPx.push_back((cpuCycles() - start) * 100 / n);
+    }
+    printf("{\"check\":\"byte_order\",\"mode\":\"%s\",\"passes\":%u,"
+           "\"cycles_per_px\":%.2f}\n",
+           m.mode, m.passes, percentile(perPx, 50) / 100.0);
+  }
+}
+
+static void reportImage(const char *name, const lv_img_dsc_t *img,
+                        uint32_t iterations) {
+  lv_img_decoder_dsc_t dsc;
+  if (lv_img_decoder_open(&dsc, img, lv_color_white(), 0) != LV_RES_OK) {
+    printf("{\"image\":\"%s\",\"error\":\"no decoder\"}\n", name);
+    return;
+  }
+  uint32_t w = dsc.header.w;
+  uint32_t h = dsc.header.h;
+  uint32_t bpp = dsc.header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? 3 : 2;
+  uint32_t rows = drawBufConfig().rows;
+  std::vector<uint8_t> line(w * 3);
+
+  // Average over the iterations for each band, then across bands
+  std::vector<uint32_t> bandNs;
+  for (uint32_t y0 = 0; y0 < h; y0 += rows) {
+    uint32_t y1 = std::min(y0 + rows, h);
+    uint64_t start = hostMicros64();
+    for (uint32_t it = 0; it < iterations; it++) {
+      for (uint32_t y = y0; y < y1; y++)
+        lv_img_decoder_read_line(&dsc, 0, y, w, line.data());
+    }
+    bandNs.push_back((uint32_t)((hostMicros64() - start) * 1000 / iterations));
+  }
+  lv_img_decoder_close(&dsc);
+
+  printf("{\"image\":\"%s\",\"width\":%u,\"height\":%u,"
+         "\"raw_alpha_bytes\":%u,\"encoded_bytes\":%u,\"decoded_bpp\":%u,"
+         "\"band_rows\":%u,\"decode_us_per_band_p50\":%.1f,"
+         "\"decode_us_per_band_p99\":%.1f}\n",
+         name, w, h, w * h * 3, img->data_size, bpp, rows,
+         percentile(bandNs, 50) / 1000.0, percentile(bandNs, 99) / 1000.0);
+}
+
+// Decode every line of an image; false if the decoder rejects any of them
+static bool decodeImage(const void *src, std::vector<uint8_t> &pixels) {
+  lv_img_decoder_dsc_t dsc;
+  if (lv_img_decoder_open(&dsc, src, lv_color_white(), 0) != LV_RES_OK)
+    return false;
+  uint32_t w = dsc.header.w;
+  uint32_t h = dsc.header.h;
+  uint32_t bpp = dsc.header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? 3 : 2;
+  pixels.resize(w * h * bpp);
+  bool ok = true;
+  for (uint32_t y = 0; y < h && ok; y++) {
+    uint8_t *line = pixels.data() + y * w * bpp;
+    if (dsc.img_data)
+      memcpy(line, dsc.img_data + y * w * bpp, w * bpp);
+    else
+      ok = lv_img_decoder_read_line(&dsc, 0, y, w, line) == LV_RES_OK;
+  }
+  lv_img_decoder_close(&dsc);
+  return ok;
+}
+
+static bool reportAssets(const char *path, uint32_t iterations) {
+  if (!assetsBeginFile(path)) {
+    printf("{\"assets\":\"%s\",\"error\":\"cannot map\"}\n", path);
+    return false;
+  }
+  const AssetPack &pack = assets();
+  // Built-in counterparts of the pack images
+  struct {
+    const char *name;
+    const lv_img_dsc_t *img;
+  } builtIn[] = {
+      {"ui_img_splash_clean_png", &ui_img_splash_clean_png},
+  };
+
+  uint32_t failures = 0;
+  uint32_t compared = 0;
+  for (uint16_t i = 0; i < pack.count(); i++) {
+    AssetInfo info = {};
+    const char *name = pack.name(i);
+    if (!pack.find(name, info) || info.index != i) {
+      failures++;
+      continue;
+    }
+    if (info.type != ASSET_IMAGE)
+      continue;
+
+    lv_img_dsc_t stub = {};
+    stub.header.w = info.width;
+    stub.header.h = info.height;
+    stub.header.cf = LV_IMG_CF_USER_ENCODED_1;
+    stub.data_size = strlen(name) + 1;
+    stub.data = (const uint8_t *)name;
+    std::vector<uint8_t> fromPack, expected;
+    if (!decodeImage(&stub, fromPack)) {
+      failures++;
+      continue;
+    }
+    for (const auto &b : builtIn) {
+      if (strcmp(b.name, name))
+        continue;
+      compared++;
+      if (!decodeImage(b.img, expected) || expected != fromPack)
+        failures++;
+    }
+  }
+  AssetInfo missing = {};
+  if (pack.find("no such asset", missing))
+    failures++;
+
+  // Average lookup time over every name
+  uint64_t start = hostMicros64();
+  uint32_t lookups = 0;
+  for (uint32_t it = 0; it < iterations; it++) {
+    for (uint16_t i = 0; i < pack.count(); i++) {
+      AssetInfo info = {};
+      lookups += pack.find(pack.name(i), info);
+    }
+  }
+  double lookupNs =
+      lookups ? (hostMicros64() - start) * 1000.0 / lookups : 0.0;
+
+  printf("{\"assets\":\"%s\",\"entries\":%u,\"bytes\":%u,"
+         "\"images_compared\":%u,\"failures\":%u,\"lookup_ns\":%.1f}\n",
+         path, pack.count(), pack.size(), compared, failures, lookupNs);
+  return failures == 0;
+}
+
+int main(int argc, char **argv) {
+  uint32_t iterations = 50;
+  uint32_t spiHz = 27000000;
+  RenderMode mode = RENDER_BANDED;
+  DrawBufConfig bufConfig = DRAW_BUF_DEFAULT_CONFIG;
+  const char *assetPath = nullptr;
+  bool eager = false;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-n") && i + 1 < argc)
+      iterations = strtoul(argv[++i], NULL, 10);
+    else if (!strcmp(argv[i], "--spi-hz") && i + 1 < argc)
+      spiHz = strtoul(argv[++i], NULL, 10);
+    else if (!strcmp(argv[i], "--buf-rows") && i + 1 < argc)
+      bufConfig.rows = strtoul(argv[++i], NULL, 10);
+    else if (!strcmp(argv[i], "--buf-count") && i + 1 < argc)
+      bufConfig.count = strtoul(argv[++i], NULL, 10);
+    else if (!strcmp(argv[i], "--assets") && i + 1 < argc)
+      assetPath = argv[++i];
+    else if (!strcmp(argv[i], "--eager"))
+      eager = true;
+    else if (!strcmp(argv[i], "--font-cache") && i + 1 < argc)
+      fontCacheConfig(strtoul(argv[++i], NULL, 10));
+    else if (!strcmp(argv[i], "--mode") && i + 1 < argc) {
+      const char *name = argv[++i];
+      for (uint8_t m = 0; m < sizeof(MODE_NAMES) / sizeof(MODE_NAMES[0]); m++)
+        if (!strcmp(name, MODE_NAMES[m]))
+          mode = (RenderMode)m;
+    }
+  }
+  if (iterations == 0)
+    iterations = 1;
+
+  static FramebufferTransport fb(LCD_H_RES, LCD_V_RES, spiHz);
+  framebuffer = &fb;
+
+  initLVGL(fb, mode, bufConfig);
+  if (assetPath && !reportAssets(assetPath, iterations))
+    return 1;
+  reportByteOrder(iterations);
+  reportImage("splash", &ui_img_splash_clean_png, iterations);
+
+  uint32_t heapBefore = screenStats().heapUsed;
+  framebuffer->resetStats();
+  uint32_t bootStart = micros();
+  screenSetBuiltHook(&ui_Main, dictionaryViewInit);
+  if (eager) {
+    ui_init();
+    dictionaryViewInit();
+  } else {
+    screenManagerInit(SCREEN_HEAP_BUDGET, false);
+  }
+  lv_refr_now(NULL);
+  framebuffer->waitIdle();
+  printf("{\"boot\":\"%s\",\"first_frame_us\":%lu,\"lvgl_heap\":%u,"
+         "\"lvgl_heap_before\":%u}\n",
+         eager ? "eager" : "lazy", micros() - bootStart,
+         (unsigned)(screenStats().heapUsed - heapBefore), (unsigned)heapBefore);
+
+  dictionaryViewShow("phonetic",
+                     "/f\u0259\u02c8n\u025bt\u026ak/ adj. relating to the "
+                     "sounds of speech; n. phonetics, the study of them. "
+                     "\u02c8f\u0254n\u0259\u02ccm\u025bt\u0281");
+
+  struct {
+    const char *name;
+    lv_obj_t **screen;
+    lv_obj_t **dirty; // widget invalidated in the partial scenario
+  } screens[] = {
+      {"splash", &ui_Splash, &ui_LoadingBar},
+      {"main", &ui_Main, &ui_TxtWord},
+      {"wifi_settings", &ui_WIFI_Settings, &ui_InputPassword},
+      {"keyboard_settings", &ui_Keyboard_Settings, &ui_InputBLEs},
+  };
+
+  for (const auto &s : screens) {
+    framebuffer->resetStats();
+    uint32_t start = micros();
+    switchToScreen(s.screen);
+    lv_refr_now(NULL);
+    framebuffer->waitIdle();
+    printf("{\"screen\":\"%s\",\"scenario\":\"first_frame\","
+           "\"mode\":\"%s\",\"frame_us\":%lu,\"pixels\":%llu}\n",
+           s.name, MODE_NAMES[renderMode()], micros() - start,
+           (unsigned long long)framebuffer->stats().pixels);
+    settle(100);
+
+    std::vector<Sample> full, partial, children;
+    for (uint32_t i = 0; i < iterations; i++)
+      full.push_back(redraw(*s.screen));
+    for (uint32_t i = 0; i < iterations; i++)
+      partial.push_back(redraw(*s.dirty));
+    for (uint32_t i = 0; i < iterations; i++)
+      children.push_back(redraw(*s.screen, true));
+
+    report(s.name, "full", full, spiHz);
+    report(s.name, "partial", partial, spiHz);
+    report(s.name, "children", children, spiHz);
+  }
+
+  const ScreenStats &ss = screenStats();
+  printf("{\"screens\":\"%s\",\"builds\":%u,\"destroys\":%u,"
+         "\"lvgl_heap\":%u,\"lvgl_heap_peak\":%u,\"budget\":%u}\n",
+         eager ? "eager" : "lazy", ss.builds, ss.destroys,
+         (unsigned)ss.heapUsed, (unsigned)ss.heapPeak,
+         (unsigned)SCREEN_HEAP_BUDGET);
+
+  const GlyphCache::Stats &fc = fontCacheStats();
+  if (fc.slots) {
+    uint32_t lookups = fc.hits + fc.misses;
+    printf("{\"font_cache_bytes\":%u,\"slots\":%u,\"slot_bytes\":%u,"
+           "\"used\":%u,\"hits\":%u,\"misses\":%u,\"evictions\":%u,"
+           "\"hit_rate\":%.3f}\n",
+           (unsigned)fc.bytes, fc.slots, fc.slotBytes, fc.used, fc.hits,
+           fc.misses, fc.evictions, lookups ? (double)fc.hits / lookups : 0.0);
+  }
+  return 0;
+}
@@ -0,0 +1,69 @@
+// Headless entry point for the native (Linux) environment.
+//
+// Runs the SquareLine UI and the display/input glue from LvglPort against an
+// in-memory 320x240 RGB565 framebuffer and writes one PPM per screen.
+//
+// Usage: program [output-dir]
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#include "Display/FramebufferTransport.h"
+#include "LvglPort.h"
+#include "ScreenManager.h"
+#include "Touch/TouchInput.h"
+#include "ui/ui.h"
+
+GT911 gt911;
+BleKeyboardHost bleKeyboardHost;
+
+static FramebufferTransport framebuffer(LCD_H_RES, LCD_V_RES);
+
+// Let LVGL timers and animations run for a while
+static void runFor(uint32_t ms) {
+  uint32_t start = millis();
+  do {
+    lv_timer_handler();
+    framebuffer.poll();
+    delay(1);
+  } while (millis() - start < ms);
+  framebuffer.waitIdle();
+}
+
+int main(int argc, char **argv) {
+  const char *outDir = argc > 1 ? argv[1] : ".";
+
+  initLVGL(framebuffer);
+  touchBegin(gt911, -1, nullptr);
+  screenManagerInit();
+
+  struct {
+    const char *name;
+    lv_obj_t **screen;
+  } screens[] = {
+      {"splash", &ui_Splash},
+      {"main", &ui_Main},
+      {"wifi_settings", &ui_WIFI_Settings},
+      {"keyboard_settings", &ui_Keyboard_Settings},
+  };
+
+  for (const auto &s : screens) {
+    switchToScreen(s.screen);
+    runFor(50);
+
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.ppm", outDir, s.name);
+    if (!framebuffer.writePPM(path)) {
+      Serial.printf("Failed to write %s\n", path);
+      return 1;
+    }
+    Serial.printf("Wrote %s\n", path);
+  }
+
+  const FlushTransport::Stats &st = framebuffer.stats();
+  Serial.printf("Flushes: %u, pixels: %llu, bus busy: %llu us, "
+                "render stalled on bus: %llu us\n",
+                st.transfers, (unsigned long long)st.pixels,
+                (unsigned long long)st.busyUs, (unsigned long long)st.waitUs);
+  return 0;
+}
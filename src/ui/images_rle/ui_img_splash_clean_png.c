@@ -0,0 +1,420 @@
+// Generated by tools/rle_images.py from ui_img_splash_clean_png.c, do not edit.
+// 320x240, 9613 bytes (run-length encoded, see src/Display/RleImage.h)
+
+#include "../ui.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_splash_clean_png_data[] = {
+    0x52,0x4C,0x45,0x31,0x40,0x01,0xF0,0x00,0x02,0x00,0x00,0x00,0xCC,0x03,0x00,0x00,0xD5,0x03,0x00,0x00,0xDE,0x03,0x00,0x00,
+    0xE7,0x03,0x00,0x00,0xF0,0x03,0x00,0x00,0xF9,0x03,0x00,0x00,0x02,0x04,0x00,0x00,0x0B,0x04,0x00,0x00,0x14,0x04,0x00,0x00,
+    0x1D,0x04,0x00,0x00,0x26,0x04,0x00,0x00,0x2F,0x04,0x00,0x00,0x38,0x04,0x00,0x00,0x41,0x04,0x00,0x00,0x4A,0x04,0x00,0x00,
+    0x53,0x04,0x00,0x00,0x5C,0x04,0x00,0x00,0x65,0x04,0x00,0x00,0x6E,0x04,0x00,0x00,0x77,0x04,0x00,0x00,0x80,0x04,0x00,0x00,
+    0x89,0x04,0x00,0x00,0x92,0x04,0x00,0x00,0x9B,0x04,0x00,0x00,0xA4,0x04,0x00,0x00,0xAD,0x04,0x00,0x00,0xB6,0x04,0x00,0x00,
+    0xBF,0x04,0x00,0x00,0xC8,0x04,0x00,0x00,0xD1,0x04,0x00,0x00,0xDA,0x04,0x00,0x00,0xE3,0x04,0x00,0x00,0xEC,0x04,0x00,0x00,
+    0xF5,0x04,0x00,0x00,0xFE,0x04,0x00,0x00,0x07,0x05,0x00,0x00,0x10,0x05,0x00,0x00,0x19,0x05,0x00,0x00,0x22,0x05,0x00,0x00,
+    0x2B,0x05,0x00,0x00,0x34,0x05,0x00,0x00,0x3D,0x05,0x00,0x00,0x46,0x05,0x00,0x00,0x4F,0x05,0x00,0x00,0x58,0x05,0x00,0x00,
+    0x61,0x05,0x00,0x00,0x6A,0x05,0x00,0x00,0x73,0x05,0x00,0x00,0x7C,0x05,0x00,0x00,0x85,0x05,0x00,0x00,0x8E,0x05,0x00,0x00,
+    0x97,0x05,0x00,0x00,0xA0,0x05,0x00,0x00,0xA9,0x05,0x00,0x00,0xB2,0x05,0x00,0x00,0xBB,0x05,0x00,0x00,0xC4,0x05,0x00,0x00,
+    0xCD,0x05,0x00,0x00,0xD6,0x05,0x00,0x00,0xDF,0x05,0x00,0x00,0xE8,0x05,0x00,0x00,0xF1,0x05,0x00,0x00,0xFA,0x05,0x00,0x00,
+    0x03,0x06,0x00,0x00,0x0C,0x06,0x00,0x00,0x15,0x06,0x00,0x00,0x1E,0x06,0x00,0x00,0x27,0x06,0x00,0x00,0x30,0x06,0x00,0x00,
+    0x39,0x06,0x00,0x00,0x42,0x06,0x00,0x00,0x4B,0x06,0x00,0x00,0x54,0x06,0x00,0x00,0x5D,0x06,0x00,0x00,0x66,0x06,0x00,0x00,
+    0x6F,0x06,0x00,0x00,0x78,0x06,0x00,0x00,0xDB,0x06,0x00,0x00,0x04,0x07,0x00,0x00,0x25,0x07,0x00,0x00,0x5B,0x07,0x00,0x00,
+    0xEE,0x07,0x00,0x00,0x2F,0x08,0x00,0x00,0x68,0x08,0x00,0x00,0xB3,0x08,0x00,0x00,0xE0,0x08,0x00,0x00,0x08,0x09,0x00,0x00,
+    0x33,0x09,0x00,0x00,0x76,0x09,0x00,0x00,0xB7,0x09,0x00,0x00,0x08,0x0A,0x00,0x00,0x69,0x0A,0x00,0x00,0xBE,0x0A,0x00,0x00,
+    0x11,0x0B,0x00,0x00,0x62,0x0B,0x00,0x00,0xC5,0x0B,0x00,0x00,0x1C,0x0C,0x00,0x00,0x73,0x0C,0x00,0x00,0xC8,0x0C,0x00,0x00,
+    0x1F,0x0D,0x00,0x00,0x72,0x0D,0x00,0x00,0xD3,0x0D,0x00,0x00,0x36,0x0E,0x00,0x00,0x91,0x0E,0x00,0x00,0xEC,0x0E,0x00,0x00,
+    0x4D,0x0F,0x00,0x00,0xAC,0x0F,0x00,0x00,0x0B,0x10,0x00,0x00,0x6C,0x10,0x00,0x00,0xCF,0x10,0x00,0x00,0x36,0x11,0x00,0x00,
+    0x9D,0x11,0x00,0x00,0x08,0x12,0x00,0x00,0x71,0x12,0x00,0x00,0xD6,0x12,0x00,0x00,0x3D,0x13,0x00,0x00,0xA6,0x13,0x00,0x00,
+    0xFD,0x13,0x00,0x00,0x5A,0x14,0x00,0x00,0xBB,0x14,0x00,0x00,0x16,0x15,0x00,0x00,0x86,0x15,0x00,0x00,0xF3,0x15,0x00,0x00,
+    0x59,0x16,0x00,0x00,0xC1,0x16,0x00,0x00,0x2C,0x17,0x00,0x00,0x96,0x17,0x00,0x00,0xE5,0x17,0x00,0x00,0x32,0x18,0x00,0x00,
+    0x85,0x18,0x00,0x00,0xDA,0x18,0x00,0x00,0x2F,0x19,0x00,0x00,0x88,0x19,0x00,0x00,0xDF,0x19,0x00,0x00,0x38,0x1A,0x00,0x00,
+    0x8F,0x1A,0x00,0x00,0xE5,0x1A,0x00,0x00,0x40,0x1B,0x00,0x00,0xA3,0x1B,0x00,0x00,0x00,0x1C,0x00,0x00,0x43,0x1C,0x00,0x00,
+    0x86,0x1C,0x00,0x00,0xC7,0x1C,0x00,0x00,0x08,0x1D,0x00,0x00,0xA7,0x1D,0x00,0x00,0xFE,0x1D,0x00,0x00,0x51,0x1E,0x00,0x00,
+    0x9C,0x1E,0x00,0x00,0x38,0x1F,0x00,0x00,0x7D,0x1F,0x00,0x00,0xB8,0x1F,0x00,0x00,0xE5,0x1F,0x00,0x00,0x12,0x20,0x00,0x00,
+    0xBB,0x20,0x00,0x00,0xDA,0x20,0x00,0x00,0xFB,0x20,0x00,0x00,0x18,0x21,0x00,0x00,0xA7,0x21,0x00,0x00,0xD5,0x21,0x00,0x00,
+    0x03,0x22,0x00,0x00,0x37,0x22,0x00,0x00,0x73,0x22,0x00,0x00,0x97,0x22,0x00,0x00,0xB0,0x22,0x00,0x00,0xC7,0x22,0x00,0x00,
+    0xEA,0x22,0x00,0x00,0xF3,0x22,0x00,0x00,0xFC,0x22,0x00,0x00,0x05,0x23,0x00,0x00,0x0E,0x23,0x00,0x00,0x17,0x23,0x00,0x00,
+    0x20,0x23,0x00,0x00,0x29,0x23,0x00,0x00,0x32,0x23,0x00,0x00,0x3B,0x23,0x00,0x00,0x44,0x23,0x00,0x00,0x4D,0x23,0x00,0x00,
+    0x56,0x23,0x00,0x00,0x5F,0x23,0x00,0x00,0x68,0x23,0x00,0x00,0x71,0x23,0x00,0x00,0x7A,0x23,0x00,0x00,0x83,0x23,0x00,0x00,
+    0x8C,0x23,0x00,0x00,0x95,0x23,0x00,0x00,0x9E,0x23,0x00,0x00,0xA7,0x23,0x00,0x00,0xB0,0x23,0x00,0x00,0xB9,0x23,0x00,0x00,
+    0xC2,0x23,0x00,0x00,0xCB,0x23,0x00,0x00,0xD4,0x23,0x00,0x00,0xDD,0x23,0x00,0x00,0xE6,0x23,0x00,0x00,0xEF,0x23,0x00,0x00,
+    0xF8,0x23,0x00,0x00,0x01,0x24,0x00,0x00,0x0A,0x24,0x00,0x00,0x13,0x24,0x00,0x00,0x1C,0x24,0x00,0x00,0x25,0x24,0x00,0x00,
+    0x2E,0x24,0x00,0x00,0x37,0x24,0x00,0x00,0x40,0x24,0x00,0x00,0x49,0x24,0x00,0x00,0x52,0x24,0x00,0x00,0x5B,0x24,0x00,0x00,
+    0x64,0x24,0x00,0x00,0x6D,0x24,0x00,0x00,0x76,0x24,0x00,0x00,0x7F,0x24,0x00,0x00,0x88,0x24,0x00,0x00,0x91,0x24,0x00,0x00,
+    0x9A,0x24,0x00,0x00,0xA3,0x24,0x00,0x00,0xAC,0x24,0x00,0x00,0xB5,0x24,0x00,0x00,0xBE,0x24,0x00,0x00,0xC7,0x24,0x00,0x00,
+    0xD0,0x24,0x00,0x00,0xD9,0x24,0x00,0x00,0xE2,0x24,0x00,0x00,0xEB,0x24,0x00,0x00,0xF4,0x24,0x00,0x00,0xFD,0x24,0x00,0x00,
+    0x06,0x25,0x00,0x00,0x0F,0x25,0x00,0x00,0x18,0x25,0x00,0x00,0x21,0x25,0x00,0x00,0x2A,0x25,0x00,0x00,0x33,0x25,0x00,0x00,
+    0x3C,0x25,0x00,0x00,0x45,0x25,0x00,0x00,0x4E,0x25,0x00,0x00,0x57,0x25,0x00,0x00,0x60,0x25,0x00,0x00,0x69,0x25,0x00,0x00,
+    0x72,0x25,0x00,0x00,0x7B,0x25,0x00,0x00,0x84,0x25,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,
+    0xF0,0xFF,0xFF,0x01,0xE7,0x3C,0x29,0x45,0x82,0x00,0x20,0x82,0x00,0x00,0x83,0x00,0x20,0x81,0x00,0x00,0x01,0x00,0x20,0x00,
+    0x00,0x84,0x00,0x20,0x00,0x00,0x00,0x81,0x00,0x20,0x83,0x00,0x21,0x05,0x00,0x41,0x08,0x82,0x39,0xC7,0x84,0x31,0xCE,0x7A,
+    0xEF,0x5D,0x95,0xFF,0xFF,0x04,0xEF,0x7D,0xBE,0x18,0x6B,0x6E,0x29,0x45,0x00,0x41,0x81,0x00,0x20,0x84,0x00,0x00,0x81,0x00,
+    0x20,0x83,0x00,0x00,0x83,0x00,0x20,0x83,0x00,0x00,0x00,0x00,0x20,0x81,0x00,0x21,0x82,0x00,0x20,0x01,0x08,0x41,0x94,0xB3,
+    0xF4,0xFF,0xFF,0xEF,0xFF,0xFF,0x01,0xFF,0xDF,0x31,0xA7,0x9F,0x00,0x00,0x04,0x00,0x20,0x10,0x82,0x31,0x86,0xBD,0xF8,0xFF,
+    0xDF,0x8E,0xFF,0xFF,0x02,0xF7,0xBE,0x73,0xCF,0x18,0xC3,0xA1,0x00,0x00,0x00,0xCE,0x7A,0xF3,0xFF,0xFF,0xEF,0xFF,0xFF,0x00,
+    0xD6,0x9A,0xA4,0x00,0x00,0x01,0x10,0xC3,0x7B,0xCF,0x8B,0xFF,0xFF,0x02,0xE7,0x3C,0x52,0xAA,0x08,0x61,0xA3,0x00,0x00,0x00,
+    0x6B,0x6D,0xF3,0xFF,0xFF,0xEF,0xFF,0xFF,0x00,0xD6,0x9A,0xA6,0x00,0x00,0x01,0x31,0x86,0xD6,0x9A,0x87,0xFF,0xFF,0x02,0xF7,
+    0xBE,0x7C,0x10,0x18,0xC3,0x89,0x00,0x00,0x01,0x00,0x20,0x08,0x41,0x82,0x08,0x61,0x02,0x08,0x41,0x00,0x41,0x00,0x21,0x85,
+    0x00,0x20,0x8D,0x00,0x00,0x00,0x63,0x0C,0xF3,0xFF,0xFF,0xEF,0xFF,0xFF,0x00,0xD6,0x9A,0x83,0x00,0x00,0x81,0xB5,0xB6,0x00,
+    0xB5,0x96,0x81,0xB5,0xB6,0x81,0xBD,0xD7,0x01,0xB5,0xD7,0xB5,0xB6,0x81,0xB5,0x96,0x01,0xB5,0xB6,0xB5,0xD7,0x81,0xBD,0xD7,
+    0x81,0xB5,0xB6,0x81,0xB5,0x96,0x0A,0xB5,0xB6,0xB5,0xB7,0xA5,0x55,0x9D,0x14,0x8C,0x92,0x73,0xCF,0x5A,0xEB,0x52,0xCB,0x4A,
+    0x8A,0x21,0x24,0x00,0x20,0x85,0x00,0x00,0x02,0x00,0x20,0x9D,0x14,0xFF,0xDF,0x84,0xFF,0xFF,0x01,0xDE,0xDB,0x39,0xC7,0x86,
+    0x00,0x00,0x07,0x10,0xA2,0x39,0xE8,0x5A,0xCB,0x94,0xD3,0xBD,0xF8,0xD6,0xBA,0xDE,0xDB,0xE7,0x1C,0x82,0xE7,0x3C,0x02,0xDE,
+    0xFB,0xD6,0xDB,0xD6,0x9A,0x81,0xCE,0x7A,0x81,0xC6,0x59,0x02,0xCE,0x79,0xBD,0xF7,0xBD,0xD7,0x83,0xB5,0xB6,0x82,0xBD,0xD7,
+    0x01,0xB5,0xB7,0x21,0x04,0x82,0x00,0x00,0x00,0x63,0x0C,0xF3,0xFF,0xFF,0xEF,0xFF,0xFF,0x00,0xD6,0x9A,0x83,0x00,0x00,0x00,
+    0xFF,0xDF,0x9B,0xFF,0xFF,0x02,0xEF,0x7D,0x6B,0x6E,0x08,0x62,0x85,0x00,0x00,0x01,0x52,0xCB,0xF7,0xBE,0x82,0xFF,0xFF,0x01,
+    0xD6,0xDB,0x08,0x62,0x84,0x00,0x00,0x03,0x00,0x20,0x3A,0x08,0xC6,0x39,0xF7,0xBF,0x9B,0xFF,0xFF,0x00,0x39,0xE8,0x82,0x00,
+    0x00,0x00,0x63,0x2C,0xF3,0xFF,0xFF,0xEF,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x01,0x00,0x20,0xFF,0xDF,0x9E,0xFF,0xFF,
+    0x01,0xAD,0x76,0x10,0xA2,0x84,0x00,0x00,0x03,0x21,0x25,0xE7,0x5D,0xFF,0xFF,0xE7,0x1C,0x85,0x00,0x00,0x01,0x29,0x66,0xEF,
+    0x5D,0x9E,0xFF,0xFF,0x00,0x42,0x28,0x82,0x00,0x00,0x00,0x63,0x2C,0xF3,0xFF,0xFF,0xE9,0xFF,0xFF,0x00,0xEF,0x7E,0x81,0x94,
+    0xB3,0x03,0x94,0xD3,0x94,0xD4,0x94,0xB3,0x73,0xCF,0x82,0x00,0x00,0x01,0x00,0x21,0xFF,0xDF,0xA0,0xFF,0xFF,0x00,0xA5,0x34,
+    0x84,0x00,0x00,0x01,0x18,0xE3,0xE7,0x3C,0x84,0x00,0x00,0x01,0x08,0x61,0xBD,0xF8,0xA0,0xFF,0xFF,0x00,0x42,0x28,0x82,0x00,
+    0x00,0x06,0x31,0x86,0x8C,0x92,0x94,0xD4,0x94,0xB3,0x8C,0xB3,0x9C,0xF4,0xD6,0x9A,0xED,0xFF,0xFF,0xE8,0xFF,0xFF,0x01,0xC6,
+    0x39,0x00,0x41,0x89,0x00,0x00,0x00,0xFF,0xDF,0xA1,0xFF,0xFF,0x01,0xEF,0x7D,0x08,0x82,0x88,0x00,0x00,0x01,0x42,0x49,0xF7,
+    0x9E,0xA1,0xFF,0xFF,0x00,0x42,0x08,0x89,0x00,0x00,0x00,0x5B,0x0C,0xEC,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x63,0x0C,0x8A,0x00,
+    0x00,0x00,0xFF,0xDF,0xA2,0xFF,0xFF,0x01,0xE7,0x3C,0x10,0x82,0x86,0x00,0x00,0x01,0x63,0x0C,0xF7,0xBE,0xA2,0xFF,0xFF,0x00,
+    0x39,0xE7,0x8A,0x00,0x00,0xEC,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x6A,0x89,0x00,0x00,0x00,0x00,0x20,0xA4,0xFF,0xFF,0x01,
+    0xBD,0xF7,0x08,0x61,0x84,0x00,0x00,0x01,0x4A,0x8A,0xF7,0xBE,0xA3,0xFF,0xFF,0x00,0x39,0xC7,0x8A,0x00,0x00,0x00,0xFF,0xDF,
+    0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0x21,0x04,0x81,0x21,0x24,0x00,0x18,0xE3,0x82,0x00,0x00,
+    0x00,0x00,0x21,0xA5,0xFF,0xFF,0x01,0x7B,0xF0,0x00,0x20,0x82,0x00,0x00,0x01,0x18,0xE4,0xF7,0xBE,0xA4,0xFF,0xFF,0x00,0x39,
+    0xC7,0x82,0x00,0x00,0x00,0x08,0x61,0x81,0x21,0x24,0x00,0x21,0x04,0x83,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,
+    0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0xEF,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x79,0x82,0x00,0x00,0x00,0x00,0x41,0xA6,0xFF,
+    0xFF,0x00,0x42,0x29,0x82,0x00,0x00,0x00,0xE7,0x3C,0xA5,0xFF,0xFF,0x00,0x3A,0x08,0x82,0x00,0x00,0x00,0x5B,0x0C,0x81,0xFF,
+    0xFF,0x01,0xF7,0xDF,0x18,0xE4,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x6A,0x82,0x00,0x00,
+    0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x79,0x82,0x00,0x00,0x01,0x00,0x41,0xFF,0xDF,0xA5,0xFF,0xFF,0x00,0x4A,0x8A,0x82,
+    0x00,0x00,0x00,0xF7,0x9E,0x8A,0xFF,0xFF,0x04,0xFF,0xDF,0xF7,0x9E,0xEF,0x7D,0xF7,0x9E,0xFF,0xDF,0x95,0xFF,0xFF,0x00,0x42,
+    0x29,0x82,0x00,0x00,0x00,0x63,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x04,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,
+    0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0xEF,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x79,0x82,0x00,0x00,0x01,0x00,0x21,
+    0xFF,0xDF,0xA5,0xFF,0xFF,0x00,0x4A,0x6A,0x81,0x00,0x00,0x01,0x00,0x20,0xF7,0xBE,0x85,0xFF,0xFF,0x04,0xFF,0xDF,0xA5,0x55,
+    0x52,0xAB,0x10,0xA2,0x00,0x20,0x84,0x00,0x00,0x04,0x00,0x20,0x08,0x82,0x4A,0x6A,0x8C,0x92,0xF7,0xBE,0x90,0xFF,0xFF,0x00,
+    0x4A,0x49,0x82,0x00,0x00,0x00,0x63,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x04,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,
+    0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0xEF,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x79,0x82,0x00,0x00,0x01,0x00,
+    0x21,0xFF,0xDF,0xA5,0xFF,0xFF,0x03,0x4A,0x69,0x00,0x00,0x42,0x29,0xF7,0xBE,0x84,0xFF,0xFF,0x01,0xA5,0x34,0x18,0xC3,0x8E,
+    0x00,0x00,0x02,0x10,0x82,0x84,0x10,0xF7,0xBE,0x8D,0xFF,0xFF,0x00,0x4A,0x69,0x82,0x00,0x00,0x00,0x63,0x2C,0x81,0xFF,0xFF,
+    0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,
+    0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x7A,0x82,0x00,0x00,0x01,0x00,0x21,0xFF,0xDF,0xA5,0xFF,0xFF,0x01,0x63,0x2D,0xB5,0xD7,
+    0x83,0xFF,0xFF,0x02,0xF7,0xBE,0x6B,0x6E,0x08,0x61,0x92,0x00,0x00,0x02,0x08,0x41,0x4A,0x69,0xE7,0x3C,0x8B,0xFF,0xFF,0x00,
+    0x42,0x49,0x82,0x00,0x00,0x00,0x63,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,
+    0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x8A,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,
+    0x21,0xA6,0xFF,0xFF,0x00,0xF7,0xBE,0x83,0xFF,0xFF,0x01,0x9C,0xD3,0x18,0xC3,0x89,0x00,0x00,0x83,0x00,0x20,0x88,0x00,0x00,
+    0x01,0x08,0x61,0x7B,0xF0,0x8A,0xFF,0xFF,0x00,0x42,0x08,0x82,0x00,0x00,0x00,0x63,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,
+    0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x8A,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,
+    0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,0x20,0xA9,0xFF,0xFF,0x01,0xF7,0xBF,0x5A,0xEB,0x86,0x00,0x00,0x0C,0x08,0x41,
+    0x39,0xE8,0x63,0x2D,0x9C,0xF3,0xBE,0x18,0xCE,0x9A,0xDE,0xFC,0xDE,0xFB,0xCE,0x79,0xB5,0xB6,0x94,0xB2,0x5A,0xEC,0x29,0x65,
+    0x86,0x00,0x00,0x01,0x4A,0x8A,0xF7,0x9E,0x88,0xFF,0xFF,0x00,0x42,0x08,0x82,0x00,0x00,0x00,0x63,0x0C,0x81,0xFF,0xFF,0x01,
+    0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0xF7,
+    0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,0x21,0xA8,0xFF,0xFF,0x01,0xEF,0x9E,0x29,0x66,0x85,0x00,0x00,
+    0x02,0x18,0xE4,0x73,0xCF,0xE7,0x1C,0x8B,0xFF,0xFF,0x01,0xAD,0x96,0x31,0xA6,0x85,0x00,0x00,0x01,0x18,0xE3,0xEF,0x7D,0x87,
+    0xFF,0xFF,0x00,0x42,0x28,0x82,0x00,0x00,0x00,0x63,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,
+    0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x9A,0x82,0x00,
+    0x00,0x01,0x00,0x20,0xFF,0xDF,0xA6,0xFF,0xFF,0x01,0xEF,0x7D,0x19,0x04,0x84,0x00,0x00,0x01,0x08,0x61,0x8C,0x71,0x90,0xFF,
+    0xFF,0x01,0xBD,0xF7,0x18,0xE3,0x84,0x00,0x00,0x01,0x10,0x82,0xEF,0x7D,0x86,0xFF,0xFF,0x00,0x4A,0x49,0x82,0x00,0x00,0x00,
+    0x63,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,
+    0x69,0x82,0x00,0x00,0x00,0xEF,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x79,0x82,0x00,0x00,0x01,0x00,0x21,0xFF,0xDF,0xA5,0xFF,0xFF,
+    0x01,0xE7,0x5D,0x18,0xE4,0x84,0x00,0x00,0x01,0x7B,0xEF,0xFF,0xDF,0x93,0xFF,0xFF,0x00,0x94,0xB2,0x84,0x00,0x00,0x01,0x10,
+    0x82,0xE7,0x3C,0x85,0xFF,0xFF,0x00,0x4A,0x8A,0x82,0x00,0x00,0x00,0x63,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,
+    0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0xEF,0x9E,0x81,0xFF,0xFF,0x00,
+    0xCE,0x79,0x82,0x00,0x00,0x01,0x00,0x21,0xFF,0xDF,0xA4,0xFF,0xFF,0x01,0xF7,0xBE,0x21,0x24,0x83,0x00,0x00,0x01,0x10,0xC3,
+    0xE7,0x3C,0x96,0xFF,0xFF,0x01,0xEF,0x5D,0x19,0x04,0x83,0x00,0x00,0x01,0x19,0x04,0xEF,0x7D,0x84,0xFF,0xFF,0x00,0x52,0x8A,
+    0x82,0x00,0x00,0x00,0x63,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,
+    0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x7A,0x82,0x00,0x00,0x01,0x00,0x21,0xFF,
+    0xDF,0xA4,0xFF,0xFF,0x00,0x39,0xE8,0x83,0x00,0x00,0x01,0x39,0xE7,0xFF,0xDF,0x98,0xFF,0xFF,0x01,0xF7,0xBF,0x29,0x65,0x83,
+    0x00,0x00,0x00,0x31,0xA6,0x84,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0x5B,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,
+    0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,
+    0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,0x41,0xA4,0xFF,0xFF,0x00,0x73,0xCF,0x83,0x00,0x00,0x01,0x21,0x24,0xF7,0xBE,
+    0x8A,0xFF,0xFF,0x00,0xA5,0x35,0x81,0x21,0x04,0x02,0x21,0x25,0x42,0x29,0xE7,0x5D,0x89,0xFF,0xFF,0x01,0xF7,0xBE,0x21,0x24,
+    0x83,0x00,0x00,0x00,0x5A,0xEC,0x83,0xFF,0xFF,0x00,0x4A,0x49,0x82,0x00,0x00,0x00,0x5A,0xEC,0x81,0xFF,0xFF,0x01,0xFF,0xDF,
+    0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x8A,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,
+    0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,0x20,0xA3,0xFF,0xFF,0x01,0xF7,0x9E,0x00,0x41,0x82,0x00,0x00,0x01,0x00,
+    0x20,0xDE,0xFB,0x8A,0xFF,0xFF,0x01,0xEF,0x7D,0x18,0xC3,0x83,0x00,0x00,0x00,0x8C,0x72,0x8A,0xFF,0xFF,0x01,0xE7,0x5D,0x08,
+    0x41,0x82,0x00,0x00,0x01,0x00,0x20,0xDE,0xDB,0x82,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0x5B,0x0C,0x81,0xFF,0xFF,
+    0x01,0xFF,0xDF,0x21,0x24,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,
+    0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,0x20,0xA3,0xFF,0xFF,0x00,0x5A,0xEC,0x83,0x00,0x00,0x00,
+    0x84,0x31,0x8B,0xFF,0xFF,0x00,0xB5,0x96,0x84,0x00,0x00,0x01,0x29,0x65,0xF7,0xBE,0x8A,0xFF,0xFF,0x00,0xA5,0x35,0x83,0x00,
+    0x00,0x00,0x31,0xA7,0x82,0xFF,0xFF,0x00,0x4A,0x49,0x82,0x00,0x00,0x00,0x5B,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x24,
+    0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,
+    0x00,0xCE,0x9A,0x82,0x00,0x00,0x01,0x00,0x20,0xFF,0xDF,0xA1,0xFF,0xFF,0x00,0xFF,0xDF,0x83,0x00,0x00,0x00,0x29,0x45,0x8C,
+    0xFF,0xFF,0x00,0x4A,0x69,0x85,0x00,0x00,0x00,0xB5,0x96,0x8B,0xFF,0xFF,0x00,0x42,0x08,0x83,0x00,0x00,0x00,0xE7,0x3C,0x81,
+    0xFF,0xFF,0x00,0x5B,0x0C,0x82,0x00,0x00,0x00,0x5A,0xEC,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,
+    0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x7A,0x82,0x00,
+    0x00,0x01,0x00,0x20,0xFF,0xDF,0xA1,0xFF,0xFF,0x00,0x8C,0x92,0x82,0x00,0x00,0x01,0x00,0x20,0xCE,0x79,0x8B,0xFF,0xFF,0x01,
+    0xDE,0xDB,0x00,0x41,0x85,0x00,0x00,0x00,0x63,0x4D,0x8B,0xFF,0xFF,0x01,0xEF,0x5D,0x10,0x82,0x82,0x00,0x00,0x00,0x39,0xE8,
+    0x81,0xFF,0xFF,0x00,0x9C,0xF4,0x82,0x00,0x00,0x00,0x5A,0xEC,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,
+    0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x79,0x82,
+    0x00,0x00,0x01,0x00,0x20,0xFF,0xDF,0xA0,0xFF,0xFF,0x01,0xFF,0xDF,0x10,0x82,0x82,0x00,0x00,0x00,0x5A,0xEC,0x8C,0xFF,0xFF,
+    0x00,0x7B,0xF0,0x86,0x00,0x00,0x01,0x10,0x82,0xF7,0xBE,0x8B,0xFF,0xFF,0x00,0x73,0xAF,0x83,0x00,0x00,0x03,0xF7,0x9E,0xFF,
+    0xFF,0xFF,0xDF,0x21,0x45,0x81,0x00,0x00,0x00,0x5A,0xEC,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,
+    0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x79,0x82,0x00,
+    0x00,0x01,0x00,0x21,0xFF,0xDF,0xA0,0xFF,0xFF,0x00,0xE7,0x3C,0x83,0x00,0x00,0x00,0xCE,0x7A,0x8B,0xFF,0xFF,0x01,0xFF,0xDF,
+    0x21,0x04,0x87,0x00,0x00,0x00,0x73,0xCF,0x8B,0xFF,0xFF,0x01,0xE7,0x5D,0x08,0x82,0x82,0x00,0x00,0x00,0xB5,0x96,0x81,0xFF,
+    0xFF,0x00,0x7B,0xCF,0x81,0x00,0x00,0x00,0x5A,0xEC,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,
+    0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,
+    0x00,0x00,0x20,0xA1,0xFF,0xFF,0x00,0x9D,0x14,0x82,0x00,0x00,0x01,0x3A,0x08,0xFF,0xDF,0x8B,0xFF,0xFF,0x00,0xB5,0xD7,0x83,
+    0x00,0x00,0x00,0x84,0x31,0x83,0x00,0x00,0x00,0x21,0x45,0x8C,0xFF,0xFF,0x00,0x73,0xAF,0x82,0x00,0x00,0x00,0x31,0xA6,0x81,
+    0xFF,0xFF,0x00,0xC6,0x38,0x81,0x00,0x00,0x00,0x5A,0xEB,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,
+    0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,
+    0x00,0x00,0x00,0x21,0xA1,0xFF,0xFF,0x00,0x29,0x66,0x82,0x00,0x00,0x00,0x9C,0xF3,0x8C,0xFF,0xFF,0x00,0x3A,0x08,0x83,0x00,
+    0x00,0x01,0xEF,0x9E,0x5A,0xCB,0x82,0x00,0x00,0x01,0x00,0x20,0xE7,0x3D,0x8B,0xFF,0xFF,0x00,0xC6,0x38,0x82,0x00,0x00,0x06,
+    0x00,0x41,0xFF,0xDF,0xFF,0xFF,0xE7,0x3C,0x00,0x21,0x00,0x00,0x5A,0xEB,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x04,0x82,0x00,
+    0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x69,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,
+    0x9A,0x82,0x00,0x00,0x00,0x00,0x21,0xA0,0xFF,0xFF,0x01,0xFF,0xDF,0x08,0x62,0x82,0x00,0x00,0x00,0xCE,0x79,0x8B,0xFF,0xFF,
+    0x01,0xF7,0xDF,0x08,0x82,0x82,0x00,0x00,0x02,0x18,0xC3,0xFF,0xFF,0xDE,0xDB,0x83,0x00,0x00,0x00,0x63,0x4D,0x8B,0xFF,0xFF,
+    0x01,0xEF,0x5D,0x08,0x82,0x82,0x00,0x00,0x05,0xF7,0x9E,0xFF,0xFF,0xFF,0xDF,0x29,0x65,0x00,0x00,0x5A,0xEB,0x81,0xFF,0xFF,
+    0x01,0xFF,0xDF,0x21,0x24,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,
+    0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,0x20,0xA0,0xFF,0xFF,0x00,0xEF,0x5D,0x82,0x00,0x00,0x01,
+    0x00,0x20,0xEF,0x7E,0x8B,0xFF,0xFF,0x00,0xB5,0xD7,0x83,0x00,0x00,0x00,0x9C,0xF4,0x81,0xFF,0xFF,0x00,0x10,0xA3,0x82,0x00,
+    0x00,0x00,0x10,0x82,0x8B,0xFF,0xFF,0x01,0xFF,0xDF,0x29,0x45,0x82,0x00,0x00,0x00,0xDE,0xFB,0x81,0xFF,0xFF,0x02,0x63,0x4D,
+    0x00,0x00,0x5A,0xEB,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,
+    0x00,0x42,0x29,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x7A,0x82,0x00,0x00,0x01,0x00,0x20,0xFF,0xDF,0x9F,
+    0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x01,0x10,0xC3,0xF7,0xDF,0x8B,0xFF,0xFF,0x00,0x29,0x45,0x82,0x00,0x00,0x01,0x08,
+    0x41,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0x73,0xAF,0x82,0x00,0x00,0x01,0x00,0x20,0xE7,0x3C,0x8B,0xFF,0xFF,0x00,0x63,0x4D,0x82,
+    0x00,0x00,0x00,0xBD,0xF7,0x81,0xFF,0xFF,0x02,0x8C,0x72,0x00,0x00,0x5A,0xEB,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,
+    0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0xEF,0x9E,0x81,0xFF,0xFF,0x00,
+    0xCE,0x79,0x82,0x00,0x00,0x01,0x00,0x20,0xFF,0xDF,0x9F,0xFF,0xFF,0x00,0xBD,0xF7,0x82,0x00,0x00,0x00,0x4A,0x8A,0x8B,0xFF,
+    0xFF,0x01,0xFF,0xDF,0x00,0x20,0x82,0x00,0x00,0x00,0x39,0xE7,0x82,0xFF,0xFF,0x01,0xEF,0x5D,0x00,0x20,0x82,0x00,0x00,0x00,
+    0x4A,0x6A,0x8B,0xFF,0xFF,0x00,0x8C,0x72,0x82,0x00,0x00,0x00,0x9C,0xF3,0x81,0xFF,0xFF,0x02,0x94,0xB2,0x00,0x00,0x5A,0xEB,
+    0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,
+    0x00,0x00,0x00,0xEF,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x9A,0x82,0x00,0x00,0x01,0x00,0x20,0xFF,0xDF,0x9F,0xFF,0xFF,0x00,0xBD,
+    0xD7,0x82,0x00,0x00,0x00,0x7C,0x10,0x8B,0xFF,0xFF,0x00,0x8C,0x92,0x83,0x00,0x00,0x00,0xB5,0xB6,0x83,0xFF,0xFF,0x00,0x42,
+    0x28,0x82,0x00,0x00,0x00,0x00,0x20,0x8B,0xFF,0xFF,0x00,0x94,0xD3,0x82,0x00,0x00,0x00,0x8C,0x71,0x81,0xFF,0xFF,0x02,0x9C,
+    0xF4,0x00,0x00,0x5A,0xEB,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x24,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,
+    0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x9A,0x82,0x00,0x00,0x01,0x00,0x20,0xFF,0xDF,
+    0x9F,0xFF,0xFF,0x00,0xBE,0x18,0x82,0x00,0x00,0x00,0x8C,0x72,0x8B,0xFF,0xFF,0x00,0x08,0x61,0x82,0x00,0x00,0x01,0x18,0xC3,
+    0xF7,0xBE,0x83,0xFF,0xFF,0x00,0x94,0xB3,0x83,0x00,0x00,0x00,0xC6,0x39,0x8A,0xFF,0xFF,0x00,0x9C,0xF3,0x82,0x00,0x00,0x00,
+    0x84,0x51,0x81,0xFF,0xFF,0x02,0x9C,0xF4,0x00,0x00,0x5A,0xEB,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x24,0x82,0x00,0x00,0x00,
+    0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,
+    0x00,0x00,0x00,0x00,0x21,0xA0,0xFF,0xFF,0x00,0xCE,0x59,0x82,0x00,0x00,0x00,0x84,0x51,0x8A,0xFF,0xFF,0x00,0xE7,0x5D,0x83,
+    0x00,0x00,0x02,0x18,0xE4,0x84,0x10,0x84,0x51,0x81,0x8C,0x51,0x01,0x84,0x31,0x63,0x4D,0x83,0x00,0x00,0x00,0x31,0xA6,0x8A,
+    0xFF,0xFF,0x00,0x94,0xD3,0x82,0x00,0x00,0x00,0x94,0xB3,0x81,0xFF,0xFF,0x02,0xA5,0x14,0x00,0x00,0x5A,0xCB,0x81,0xFF,0xFF,
+    0x01,0xFF,0xDF,0x21,0x04,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,
+    0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,0x21,0xA0,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,
+    0x52,0x8A,0x8A,0xFF,0xFF,0x00,0x73,0xCF,0x8F,0x00,0x00,0x00,0xF7,0xDF,0x89,0xFF,0xFF,0x00,0x5A,0xEC,0x82,0x00,0x00,0x00,
+    0xAD,0x75,0x81,0xFF,0xFF,0x02,0x94,0xD3,0x00,0x00,0x5A,0xEB,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x04,0x82,0x00,0x00,0x00,
+    0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x69,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,
+    0x00,0x00,0x00,0x00,0x21,0xA0,0xFF,0xFF,0x00,0xDE,0xFB,0x82,0x00,0x00,0x01,0x10,0xA2,0xFF,0xDF,0x88,0xFF,0xFF,0x01,0xFF,
+    0xDF,0x08,0x41,0x8F,0x00,0x00,0x00,0xAD,0x76,0x88,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x04,0x82,0x00,0x00,0x00,0xC6,0x39,0x81,
+    0xFF,0xFF,0x02,0x73,0xAF,0x00,0x00,0x5A,0xEB,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x24,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,
+    0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x9A,0x82,0x00,0x00,0x01,
+    0x00,0x20,0xFF,0xDF,0x9F,0xFF,0xFF,0x01,0xEF,0x7D,0x00,0x20,0x81,0x00,0x00,0x01,0x00,0x20,0xEF,0x7D,0x88,0xFF,0xFF,0x00,
+    0xD6,0x9A,0x90,0x00,0x00,0x01,0x21,0x45,0xFF,0xDF,0x87,0xFF,0xFF,0x01,0xEF,0x5D,0x08,0x61,0x82,0x00,0x00,0x00,0xDE,0xDB,
+    0x81,0xFF,0xFF,0x02,0x31,0x86,0x00,0x00,0x5A,0xEB,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,
+    0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x7A,0x82,0x00,0x00,
+    0x01,0x00,0x20,0xFF,0xDF,0x9F,0xFF,0xFF,0x01,0xFF,0xDF,0x08,0x61,0x82,0x00,0x00,0x00,0xB5,0xB6,0x88,0xFF,0xFF,0x00,0x52,
+    0xCB,0x91,0x00,0x00,0x00,0xD6,0xBA,0x87,0xFF,0xFF,0x00,0xBD,0xF8,0x83,0x00,0x00,0x05,0xF7,0x9E,0xFF,0xFF,0xEF,0x5D,0x08,
+    0x61,0x00,0x00,0x5B,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,
+    0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x7A,0x82,0x00,0x00,0x01,0x00,0x20,0xFF,0xDF,
+    0xA0,0xFF,0xFF,0x00,0x63,0x2D,0x82,0x00,0x00,0x00,0x73,0x8E,0x87,0xFF,0xFF,0x00,0xDE,0xDB,0x83,0x00,0x00,0x03,0x29,0xA6,
+    0xEF,0x7D,0xF7,0x9E,0xF7,0xBE,0x82,0xF7,0x9E,0x82,0xF7,0xBE,0x00,0xCE,0x59,0x83,0x00,0x00,0x00,0x73,0xAF,0x87,0xFF,0xFF,
+    0x00,0x7B,0xCF,0x82,0x00,0x00,0x00,0x29,0x45,0x81,0xFF,0xFF,0x00,0xCE,0x59,0x81,0x00,0x00,0x00,0x5A,0xEC,0x81,0xFF,0xFF,
+    0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,
+    0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x01,0x00,0x20,0xFF,0xDF,0xA0,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,
+    0x00,0x01,0x08,0x62,0xE7,0x3C,0x86,0xFF,0xFF,0x00,0x8C,0x92,0x83,0x00,0x00,0x00,0xB5,0xB6,0x89,0xFF,0xFF,0x00,0x29,0x66,
+    0x82,0x00,0x00,0x01,0x10,0x82,0xEF,0x5D,0x85,0xFF,0xFF,0x01,0xF7,0x9E,0x10,0xA2,0x82,0x00,0x00,0x00,0xB5,0x96,0x81,0xFF,
+    0xFF,0x00,0x84,0x30,0x81,0x00,0x00,0x00,0x5A,0xEC,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,
+    0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x83,0x00,0x00,
+    0xA1,0xFF,0xFF,0x01,0xFF,0xDF,0x00,0x20,0x82,0x00,0x00,0x00,0x84,0x10,0x85,0xFF,0xFF,0x01,0xF7,0xBE,0x29,0x66,0x83,0x00,
+    0x00,0x00,0xF7,0x9E,0x89,0xFF,0xFF,0x00,0xB5,0xB7,0x83,0x00,0x00,0x00,0xA5,0x34,0x85,0xFF,0xFF,0x00,0x94,0xB3,0x83,0x00,
+    0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0x42,0x49,0x81,0x00,0x00,0x00,0x5A,0xEB,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x24,
+    0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,
+    0x00,0xD6,0x9A,0x83,0x00,0x00,0xA2,0xFF,0xFF,0x00,0x31,0xA7,0x82,0x00,0x00,0x01,0x21,0x04,0xEF,0x7D,0x84,0xFF,0xFF,0x00,
+    0xB5,0xB6,0x83,0x00,0x00,0x00,0x52,0xAA,0x8A,0xFF,0xFF,0x00,0xFF,0xDF,0x83,0x00,0x00,0x00,0x4A,0x6A,0x84,0xFF,0xFF,0x01,
+    0xF7,0xBE,0x21,0x25,0x82,0x00,0x00,0x00,0x21,0x04,0x81,0xFF,0xFF,0x01,0xDE,0xDB,0x08,0x61,0x81,0x00,0x00,0x00,0x5A,0xEB,
+    0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x24,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,
+    0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,0x20,0xA2,0xFF,0xFF,0x00,0xD6,0xBA,0x83,
+    0x00,0x00,0x00,0x6B,0x6E,0x84,0xFF,0xFF,0x00,0x63,0x2C,0x82,0x00,0x00,0x01,0x08,0x61,0xDF,0x1C,0x8B,0xFF,0xFF,0x05,0x73,
+    0x8E,0x08,0x61,0x08,0x41,0x00,0x21,0x10,0xA2,0xE7,0x5D,0x83,0xFF,0xFF,0x00,0x6B,0x6D,0x83,0x00,0x00,0x00,0xAD,0x96,0x81,
+    0xFF,0xFF,0x00,0x84,0x30,0x82,0x00,0x00,0x00,0x5A,0xEC,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x24,0x82,0x00,0x00,0x00,0xFF,
+    0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x29,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x83,0x00,
+    0x00,0x00,0xFF,0xDF,0xA2,0xFF,0xFF,0x00,0x10,0xA2,0x82,0x00,0x00,0x01,0x08,0x41,0xCE,0x7A,0x83,0xFF,0xFF,0x00,0xD6,0xBB,
+    0x81,0xB5,0xB7,0x01,0xC6,0x59,0xEF,0x7E,0x8D,0xFF,0xFF,0x01,0xF7,0xBE,0xE7,0x3D,0x81,0xE7,0x1C,0x83,0xFF,0xFF,0x01,0xD6,
+    0x9A,0x08,0x41,0x82,0x00,0x00,0x00,0x10,0xA2,0x82,0xFF,0xFF,0x00,0x4A,0x49,0x82,0x00,0x00,0x00,0x5A,0xEC,0x81,0xFF,0xFF,
+    0x01,0xFF,0xDF,0x21,0x24,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x08,0x82,0x00,0x00,0x00,
+    0xEF,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x9A,0x83,0x00,0x00,0x00,0xFF,0xDF,0xA2,0xFF,0xFF,0x00,0xCE,0x9A,0x83,0x00,0x00,0x00,
+    0x10,0x82,0x9D,0xFF,0xFF,0x01,0xFF,0xDF,0x10,0x82,0x83,0x00,0x00,0x00,0xBD,0xF7,0x82,0xFF,0xFF,0x00,0x4A,0x8A,0x82,0x00,
+    0x00,0x00,0x5B,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,
+    0x00,0x42,0x08,0x82,0x00,0x00,0x00,0xEF,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x9A,0x83,0x00,0x00,0x00,0xFF,0xDF,0xA3,0xFF,0xFF,
+    0x00,0x52,0xAA,0x83,0x00,0x00,0x00,0x29,0x65,0x9C,0xFF,0xFF,0x00,0x19,0x04,0x83,0x00,0x00,0x00,0x5B,0x0C,0x83,0xFF,0xFF,
+    0x00,0x52,0x8A,0x82,0x00,0x00,0x00,0x63,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,
+    0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x28,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x9A,0x82,0x00,0x00,0x01,
+    0x00,0x20,0xFF,0xDF,0xA3,0xFF,0xFF,0x01,0xFF,0xDF,0x29,0x86,0x83,0x00,0x00,0x00,0x52,0xAB,0x99,0xFF,0xFF,0x01,0xF7,0xBF,
+    0x31,0xA6,0x83,0x00,0x00,0x00,0x42,0x28,0x84,0xFF,0xFF,0x00,0x4A,0x8A,0x82,0x00,0x00,0x00,0x5B,0x0C,0x81,0xFF,0xFF,0x01,
+    0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x29,0x82,0x00,0x00,0x00,0xF7,
+    0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,0x20,0xA5,0xFF,0xFF,0x01,0xDE,0xFB,0x19,0x04,0x83,0x00,0x00,
+    0x01,0x63,0x2D,0xFF,0xDF,0x96,0xFF,0xFF,0x01,0xE7,0x1C,0x29,0x86,0x83,0x00,0x00,0x01,0x39,0xE7,0xEF,0x7D,0x84,0xFF,0xFF,
+    0x00,0x4A,0x49,0x82,0x00,0x00,0x00,0x5B,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,
+    0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x29,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,
+    0x00,0x20,0xA6,0xFF,0xFF,0x01,0xBE,0x18,0x08,0x61,0x83,0x00,0x00,0x01,0x52,0xAA,0xE7,0x1C,0x94,0xFF,0xFF,0x01,0xAD,0x55,
+    0x21,0x24,0x83,0x00,0x00,0x01,0x4A,0x49,0xE7,0x5D,0x85,0xFF,0xFF,0x00,0x42,0x28,0x82,0x00,0x00,0x00,0x63,0x0C,0x81,0xFF,
+    0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x29,0x82,0x00,0x00,
+    0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,0x21,0xA7,0xFF,0xFF,0x01,0xAD,0x96,0x00,0x41,0x83,
+    0x00,0x00,0x02,0x19,0x04,0x9C,0xF4,0xF7,0xBE,0x90,0xFF,0xFF,0x02,0xE7,0x1C,0x6B,0x6E,0x00,0x20,0x84,0x00,0x00,0x01,0x7C,
+    0x10,0xFF,0xDF,0x85,0xFF,0xFF,0x00,0x42,0x29,0x82,0x00,0x00,0x00,0x63,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,
+    0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x29,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,
+    0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,0x21,0xA8,0xFF,0xFF,0x01,0xB5,0x96,0x00,0x41,0x84,0x00,0x00,0x02,0x29,0x65,0xBE,0x18,
+    0xF7,0xBE,0x8C,0xFF,0xFF,0x02,0xEF,0x5D,0x9C,0xD3,0x08,0x41,0x87,0x00,0x00,0x00,0x84,0x51,0x85,0xFF,0xFF,0x00,0x52,0xCB,
+    0x82,0x00,0x00,0x00,0x5B,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,
+    0xFF,0xFF,0x00,0x42,0x28,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x9A,0x82,0x00,0x00,0x01,0x00,0x20,0xFF,
+    0xDF,0xA8,0xFF,0xFF,0x01,0xD6,0xBB,0x08,0x41,0x85,0x00,0x00,0x02,0x08,0x62,0x6B,0x8E,0xE7,0x1C,0x88,0xFF,0xFF,0x02,0xDE,
+    0xFB,0x52,0xAB,0x00,0x20,0x8A,0x00,0x00,0x00,0x84,0x51,0x84,0xFF,0xFF,0x00,0x84,0x31,0x82,0x00,0x00,0x00,0x63,0x0C,0x81,
+    0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x28,0x82,0x00,
+    0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x7A,0x82,0x00,0x00,0x01,0x00,0x21,0xFF,0xDF,0xA9,0xFF,0xFF,0x01,0xFF,0xDF,
+    0x39,0xE7,0x88,0x00,0x00,0x06,0x10,0x82,0x31,0xA7,0x4A,0x6A,0x4A,0x8A,0x4A,0x6A,0x31,0xC7,0x10,0xA3,0x8F,0x00,0x00,0x00,
+    0x9C,0xF4,0x84,0xFF,0xFF,0x00,0x84,0x30,0x81,0x00,0x00,0x00,0x63,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,
+    0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x28,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,
+    0x9A,0x82,0x00,0x00,0x01,0x00,0x21,0xFF,0xDF,0xA5,0xFF,0xFF,0x01,0x63,0x2D,0xD6,0xBA,0x83,0xFF,0xFF,0x01,0xD6,0xBA,0x29,
+    0x86,0x94,0x00,0x00,0x01,0x42,0x28,0x5A,0xCB,0x87,0x00,0x00,0x81,0x08,0x41,0x00,0xBE,0x18,0x82,0xFF,0xFF,0x02,0x9C,0xF4,
+    0x00,0x00,0x63,0x0C,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,
+    0x00,0x42,0x29,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x01,0x00,0x21,0xFF,0xDF,0xA5,
+    0xFF,0xFF,0x02,0x52,0x8A,0x00,0x20,0x8C,0x71,0x84,0xFF,0xFF,0x01,0xDE,0xFC,0x5A,0xEC,0x90,0x00,0x00,0x04,0x5A,0xEB,0xDF,
+    0x1C,0xFF,0xFF,0xF7,0xBE,0x29,0x45,0x88,0x00,0x00,0x01,0x00,0x20,0xC6,0x18,0x82,0xFF,0xFF,0x01,0x8C,0x72,0x5A,0xEB,0x81,
+    0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x29,0x82,0x00,
+    0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,0x21,0xA6,0xFF,0xFF,0x00,0x4A,0x6A,0x81,0x00,
+    0x00,0x00,0x4A,0x49,0x85,0xFF,0xFF,0x03,0xE7,0x3C,0xA5,0x35,0x5B,0x0C,0x18,0xC3,0x88,0x00,0x00,0x03,0x18,0xE3,0x5A,0xCB,
+    0x9D,0x14,0xE7,0x1C,0x83,0xFF,0xFF,0x01,0xEF,0x7D,0x08,0x62,0x88,0x00,0x00,0x01,0x08,0x61,0xC6,0x39,0x82,0xFF,0xFF,0x00,
+    0xB5,0xB7,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,
+    0x49,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,0x9A,0x82,0x00,0x00,0x00,0x00,0x21,0xA6,0xFF,0xFF,0x00,0x52,
+    0x8A,0x82,0x00,0x00,0x00,0xF7,0xBE,0x87,0xFF,0xFF,0x0A,0xF7,0x9E,0xCE,0x79,0xBD,0xD7,0xA5,0x34,0x94,0xB3,0x84,0x51,0x94,
+    0xB3,0x9D,0x14,0xBD,0xF7,0xD6,0x9A,0xF7,0x9E,0x87,0xFF,0xFF,0x00,0xC6,0x38,0x89,0x00,0x00,0x01,0x21,0x24,0xD6,0x9A,0x84,
+    0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x49,0x82,0x00,
+    0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xCE,0x9A,0x82,0x00,0x00,0x00,0x00,0x21,0xA6,0xFF,0xFF,0x00,0x52,0x8A,0x82,0x00,
+    0x00,0x00,0xF7,0xBE,0x9B,0xFF,0xFF,0x00,0x84,0x31,0x89,0x00,0x00,0x01,0x29,0x66,0xEF,0x5D,0x83,0xFF,0xFF,0x01,0xFF,0xDF,
+    0x21,0x25,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x29,0x82,0x00,0x00,0x00,0xF7,0x9E,0x81,
+    0xFF,0xFF,0x00,0xCE,0x9A,0x83,0x00,0x00,0x00,0xFF,0xDF,0xA5,0xFF,0xFF,0x00,0x52,0x8A,0x82,0x00,0x00,0x00,0xF7,0x9E,0x9B,
+    0xFF,0xFF,0x00,0xB5,0xD7,0x8A,0x00,0x00,0x01,0x29,0x86,0xF7,0xDF,0x82,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x82,0x00,0x00,
+    0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x3A,0x08,0x82,0x00,0x00,0x00,0xEF,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x79,
+    0x83,0x00,0x00,0x00,0xFF,0xDF,0xA5,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0xF7,0x9E,0x9B,0xFF,0xFF,0x00,0x5A,0xEC,
+    0x8B,0x00,0x00,0x00,0x31,0xC7,0x82,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x45,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,
+    0xFF,0xFF,0x00,0x42,0x08,0x82,0x00,0x00,0x00,0xEF,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x79,0x83,0x00,0x00,0x00,0xFF,0xDF,0xA5,
+    0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0xF7,0x9E,0x9B,0xFF,0xFF,0x01,0xEF,0x7E,0x00,0x20,0x8B,0x00,0x00,0x00,0x31,
+    0xC7,0x82,0xFF,0xFF,0x00,0x9C,0xF4,0x82,0x00,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x28,0x82,0x00,
+    0x00,0x00,0xF7,0x9E,0x81,0xFF,0xFF,0x00,0xCE,0x9A,0x83,0x00,0x00,0x01,0x08,0x61,0x08,0x41,0x81,0x00,0x20,0x00,0x08,0x61,
+    0x81,0x10,0x82,0x01,0x08,0x61,0x08,0x41,0x81,0x00,0x20,0x04,0x08,0x41,0x08,0x61,0x10,0x82,0x08,0x82,0x08,0x61,0x81,0x00,
+    0x20,0x01,0x08,0x41,0x08,0x61,0x81,0x10,0x82,0x06,0x08,0x82,0x10,0xA3,0x18,0xE3,0x31,0xA6,0x6B,0x6E,0x9D,0x14,0xDF,0x1C,
+    0x89,0xFF,0xFF,0x00,0x4A,0x6A,0x82,0x00,0x00,0x00,0xF7,0x9E,0x88,0xFF,0xFF,0x0A,0xE7,0x3D,0xA5,0x35,0x6B,0xAF,0x39,0xE7,
+    0x31,0xA6,0x21,0x24,0x10,0xA2,0x08,0x41,0x00,0x20,0x08,0x41,0x08,0x61,0x81,0x10,0x82,0x03,0x08,0x61,0x08,0x41,0x00,0x20,
+    0x39,0xC7,0x82,0xFF,0xFF,0x01,0xBE,0x18,0x00,0x21,0x8B,0x00,0x00,0x00,0x63,0x6E,0x82,0xFF,0xFF,0x00,0xA5,0x55,0x81,0x00,
+    0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x29,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x00,0xD6,
+    0x9A,0x9F,0x00,0x00,0x04,0x00,0x21,0x18,0xC3,0x31,0xC7,0x8C,0x92,0xEF,0x7D,0x85,0xFF,0xFF,0x00,0x52,0x8A,0x82,0x00,0x00,
+    0x00,0xF7,0xBE,0x85,0xFF,0xFF,0x03,0xCE,0x7A,0x5A,0xEC,0x18,0xC3,0x00,0x20,0x8F,0x00,0x00,0x00,0x73,0xCF,0x82,0xFF,0xFF,
+    0x00,0x84,0x30,0x8C,0x00,0x00,0x00,0x8C,0x92,0x82,0xFF,0xFF,0x02,0xA5,0x55,0x00,0x00,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,
+    0xFF,0x00,0x42,0x29,0x82,0x00,0x00,0x00,0xF7,0xBE,0x81,0xFF,0xFF,0x01,0xEF,0x7D,0x18,0xE4,0xA2,0x00,0x00,0x02,0x10,0xA3,
+    0x63,0x2D,0xDE,0xFC,0x83,0xFF,0xFF,0x00,0x52,0x8A,0x82,0x00,0x00,0x00,0xF7,0xBE,0x82,0xFF,0xFF,0x02,0xFF,0xDF,0xBD,0xF8,
+    0x4A,0x49,0x93,0x00,0x00,0x01,0x00,0x20,0xCE,0x7A,0x82,0xFF,0xFF,0x00,0x63,0x2D,0x8C,0x00,0x00,0x00,0xA5,0x55,0x82,0xFF,
+    0xFF,0x01,0x6B,0x6D,0xFF,0xDF,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x29,0x82,0x00,0x00,0x00,0xF7,0xBE,0x82,0xFF,0xFF,
+    0x01,0xA5,0x34,0x08,0x41,0xA3,0x00,0x00,0x01,0x08,0x61,0x9C,0xF3,0x82,0xFF,0xFF,0x00,0x52,0x8A,0x82,0x00,0x00,0x00,0xF7,
+    0xBE,0x81,0xFF,0xFF,0x01,0xD6,0x9A,0x52,0xAB,0x96,0x00,0x00,0x01,0x10,0x82,0xF7,0xBE,0x81,0xFF,0xFF,0x01,0xF7,0xBE,0x4A,
+    0x49,0x8B,0x00,0x00,0x01,0x00,0x20,0xB5,0x96,0xEF,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x28,0x82,0x00,0x00,0x00,0xF7,0x9E,
+    0x83,0xFF,0xFF,0x00,0xDF,0x1C,0x84,0xAD,0x96,0x02,0xB5,0x96,0xB5,0xB7,0xB5,0xD7,0x81,0xBD,0xD7,0x02,0xB5,0xD7,0xB5,0xB6,
+    0xB5,0xB7,0x81,0xBD,0xD7,0x81,0xBD,0xF7,0x00,0xBD,0xD7,0x81,0xB5,0xD7,0x0A,0xBD,0xD7,0xBD,0xF8,0xC6,0x18,0xBE,0x18,0xBD,
+    0xF8,0xB5,0xB7,0xA5,0x14,0x7C,0x10,0x4A,0x49,0x21,0x45,0x08,0x61,0x86,0x00,0x00,0x03,0x4A,0x8A,0xF7,0xBE,0xFF,0xFF,0x4A,
+    0x8A,0x82,0x00,0x00,0x03,0xF7,0x9E,0xFF,0xDF,0x8C,0x72,0x00,0x20,0x85,0x00,0x00,0x05,0x00,0x20,0x08,0x41,0x31,0x86,0x6B,
+    0x8E,0x9C,0xF3,0xAD,0x96,0x81,0xB5,0xB7,0x01,0xB5,0xB6,0xB5,0xD7,0x83,0xBD,0xF7,0x02,0xB5,0xD7,0xB5,0xB7,0xB5,0xD7,0x81,
+    0xBD,0xF7,0x00,0xE7,0x5D,0x82,0xFF,0xFF,0x01,0xE7,0x5D,0x21,0x24,0x8B,0x00,0x00,0x01,0x08,0x61,0xC6,0x59,0xEE,0xFF,0xFF,
+    0xE8,0xFF,0xFF,0x00,0x42,0x08,0x82,0x00,0x00,0x00,0xEF,0x9E,0xA2,0xFF,0xFF,0x02,0xFF,0xDF,0xAD,0x96,0x21,0x45,0x85,0x00,
+    0x00,0x02,0x08,0x82,0xDF,0x1C,0x4A,0x69,0x82,0x00,0x00,0x01,0xEF,0x7D,0x39,0xE8,0x85,0x00,0x00,0x02,0x10,0xA2,0x84,0x31,
+    0xEF,0x9E,0x96,0xFF,0xFF,0x01,0xE7,0x1C,0x00,0x20,0x8B,0x00,0x00,0x01,0x08,0x61,0xD6,0xDB,0xED,0xFF,0xFF,0xE8,0xFF,0xFF,
+    0x00,0x3A,0x08,0x82,0x00,0x00,0x00,0xEF,0x9E,0xA5,0xFF,0xFF,0x01,0xF7,0x9E,0x63,0x2D,0x84,0x00,0x00,0x01,0x00,0x20,0x00,
+    0x21,0x82,0x00,0x00,0x00,0x08,0x82,0x84,0x00,0x00,0x01,0x18,0xE3,0xDE,0xFC,0x9A,0xFF,0xFF,0x00,0xDE,0xFC,0x8C,0x00,0x00,
+    0x01,0x08,0x41,0xDE,0xFB,0xEC,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x3A,0x08,0x82,0x00,0x00,0x00,0xF7,0x9E,0xA7,0xFF,0xFF,0x01,
+    0xE7,0x3C,0x18,0xE3,0x8B,0x00,0x00,0x01,0x00,0x41,0x94,0xD3,0x9D,0xFF,0xFF,0x00,0xB5,0xB7,0x8C,0x00,0x00,0x01,0x00,0x20,
+    0xEF,0x7E,0xEB,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x28,0x82,0x00,0x00,0x00,0xF7,0x9E,0xA8,0xFF,0xFF,0x01,0xF7,0x9E,0x10,
+    0xC3,0x89,0x00,0x00,0x01,0x10,0xA3,0xCE,0x9A,0x9F,0xFF,0xFF,0x00,0x63,0x4D,0x8C,0x00,0x00,0x01,0x10,0xC3,0xF7,0x9E,0xEA,
+    0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x42,0x29,0x82,0x00,0x00,0x01,0x39,0xE8,0x42,0x08,0x82,0x39,0xE8,0x00,0x42,0x28,0x81,0x42,
+    0x29,0x00,0x42,0x28,0x82,0x42,0x08,0x00,0x42,0x28,0x81,0x42,0x29,0x01,0x42,0x28,0x42,0x08,0x81,0x3A,0x08,0x00,0x42,0x08,
+    0x82,0x42,0x28,0x00,0x42,0x08,0x81,0x3A,0x08,0x01,0x42,0x08,0x42,0x28,0x81,0x42,0x29,0x00,0x42,0x28,0x83,0x42,0x08,0x04,
+    0x42,0x28,0x42,0x08,0x31,0xA6,0x31,0x86,0x29,0x65,0x81,0x29,0x45,0x01,0x29,0x65,0x00,0x20,0x89,0x00,0x00,0x03,0x08,0x61,
+    0x29,0x65,0x31,0x86,0x42,0x08,0x81,0x4A,0x49,0x82,0x42,0x29,0x01,0x4A,0x49,0x4A,0x69,0x81,0x4A,0x6A,0x00,0x4A,0x49,0x82,
+    0x42,0x29,0x05,0x4A,0x49,0x4A,0x69,0x4A,0x49,0x42,0x49,0x42,0x08,0x3A,0x08,0x81,0x39,0xE8,0x81,0x31,0xA6,0x04,0x31,0x86,
+    0x29,0x86,0x29,0x65,0x29,0x66,0x9C,0xF4,0x81,0xFF,0xFF,0x01,0xFF,0xDF,0x29,0x86,0x8C,0x00,0x00,0x01,0x39,0xC7,0xF7,0xBE,
+    0xE9,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x4A,0x69,0xD7,0x00,0x00,0x01,0x10,0x82,0xDF,0x1C,0x81,0xFF,0xFF,0x01,0xE7,0x3C,0x18,
+    0xE4,0x8C,0x00,0x00,0x00,0xA5,0x35,0xE9,0xFF,0xFF,0xE8,0xFF,0xFF,0x00,0x7B,0xEF,0xD8,0x00,0x00,0x01,0x21,0x24,0xFF,0xDF,
+    0x81,0xFF,0xFF,0x01,0xCE,0x59,0x10,0x82,0x8B,0x00,0x00,0x01,0x21,0x04,0xFF,0xDF,0xE8,0xFF,0xFF,0xE8,0xFF,0xFF,0x01,0xCE,
+    0x9A,0x00,0x20,0xD8,0x00,0x00,0x00,0x39,0xC7,0x82,0xFF,0xFF,0x00,0xAD,0x75,0x8C,0x00,0x00,0x00,0xDE,0xDB,0xE8,0xFF,0xFF,
+    0xE9,0xFF,0xFF,0x01,0xE7,0x5D,0x63,0x4D,0x88,0x39,0xC7,0x03,0x42,0x28,0x42,0x4A,0x4A,0xAB,0x5B,0x0D,0x81,0x63,0x4E,0x81,
+    0x63,0x6E,0x00,0x6B,0x8E,0x81,0x6B,0x8F,0x89,0x6B,0xAF,0x83,0x6B,0x8F,0x01,0x63,0x8F,0x63,0x8E,0x81,0x63,0x6E,0x00,0x31,
+    0xA7,0x82,0x00,0x00,0x05,0x00,0x20,0x42,0x29,0x5B,0x2D,0x5B,0x0C,0x4A,0x8A,0x39,0xE8,0x87,0x39,0xC7,0x01,0x31,0xC7,0x10,
+    0xC3,0x84,0x00,0x00,0x81,0x00,0x20,0x06,0x00,0x21,0x10,0x82,0x18,0xE4,0x21,0x04,0x21,0x45,0x31,0xA6,0x31,0xC7,0x81,0x39,
+    0xC7,0x04,0x42,0x29,0x5B,0x0D,0x63,0x4E,0x63,0x6E,0x6B,0x8F,0x81,0x6B,0xAF,0x81,0x6B,0x8F,0x81,0x63,0x6E,0x04,0x63,0x4E,
+    0x5B,0x4E,0x5B,0x2D,0x5B,0x0D,0x94,0xF3,0x82,0xFF,0xFF,0x00,0xAD,0x76,0x8B,0x00,0x00,0x00,0xC6,0x59,0xE8,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0x91,0xFF,0xFF,0x00,0xC6,0x39,0x82,0x00,0x00,0x01,0x08,0x62,0xFF,0xDF,0x8C,0xFF,0xFF,0x00,0x52,0xAB,0x82,0x00,
+    0x00,0x00,0x73,0xAF,0x9F,0xFF,0xFF,0x00,0x9C,0xD3,0x89,0x00,0x00,0x01,0x08,0x61,0xEF,0x7D,0xE8,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0x91,0xFF,0xFF,0x01,0xF7,0xBE,0x08,0x61,0x82,0x00,0x00,0x00,0x84,0x51,0x8B,0xFF,0xFF,0x01,0xD6,0x9A,0x00,0x20,0x82,0x00,
+    0x00,0x00,0xC6,0x59,0xA0,0xFF,0xFF,0x00,0x63,0x2D,0x88,0x00,0x00,0x00,0x52,0xAA,0xE9,0xFF,0xFF,0xFF,0xFF,0xFF,0x92,0xFF,
+    0xFF,0x00,0x21,0x24,0x83,0x00,0x00,0x01,0x84,0x51,0xFF,0xDF,0x88,0xFF,0xFF,0x01,0xAD,0x55,0x21,0x24,0x82,0x00,0x00,0x01,
+    0x08,0x41,0xF7,0xBE,0xA0,0xFF,0xFF,0x01,0xFF,0xDF,0x21,0x25,0x86,0x00,0x00,0x01,0x08,0x41,0xEF,0x7D,0xE9,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0x92,0xFF,0xFF,0x00,0x9D,0x14,0x84,0x00,0x00,0x0A,0x18,0xE3,0x21,0x24,0x29,0x86,0x29,0x66,0x29,0x45,0x29,0x65,
+    0x29,0x45,0x21,0x45,0x21,0x24,0x18,0xE3,0x00,0x20,0x83,0x00,0x00,0x00,0x7C,0x10,0xA2,0xFF,0xFF,0x01,0xEF,0x7D,0x31,0x86,
+    0x84,0x00,0x00,0x01,0x08,0x82,0xC6,0x38,0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0x93,0xFF,0xFF,0x00,0x4A,0x8A,0x91,0x00,0x00,0x01,
+    0x21,0x24,0xFF,0xDF,0xA4,0xFF,0xFF,0x05,0xA5,0x34,0x3A,0x08,0x31,0x86,0x39,0xE7,0x6B,0x6E,0xEF,0x7D,0xEB,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0x93,0xFF,0xFF,0x01,0xF7,0xDF,0x52,0xAB,0x8F,0x00,0x00,0x01,0x10,0xA2,0xF7,0xBE,0xFF,0xFF,0xFF,0x97,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0x95,0xFF,0xFF,0x01,0xBD,0xF7,0x10,0x82,0x8C,0x00,0x00,0x00,0x6B,0x8E,0xFF,0xFF,0xFF,0x99,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0x97,0xFF,0xFF,0x02,0xFF,0xDF,0xBD,0xF7,0x94,0xD3,0x82,0x94,0xB3,0x05,0x94,0xB2,0x94,0x92,0x94,0xB2,0x9C,0xD3,
+    0xAD,0x76,0xEF,0x7D,0xFF,0xFF,0xFF,0x9B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,
+};
+const lv_img_dsc_t ui_img_splash_clean_png = {
+    .header.always_zero = 0,
+    .header.w = 320,
+    .header.h = 240,
+    .data_size = sizeof(ui_img_splash_clean_png_data),
+    .header.cf = LV_IMG_CF_USER_ENCODED_0,
+    .data = ui_img_splash_clean_png_data
+};
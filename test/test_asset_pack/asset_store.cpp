@@ -0,0 +1,3 @@
+// assetsBeginFile() and the pack it maps: test_build_src is off for
+// [env:native]
+#include "Assets/AssetStore.cpp"
@@ -0,0 +1,215 @@
+// Asset pack index (Assets/AssetPack.h) read through the file mapping of
+// the native build (Assets/AssetStore.h).
+//
+// Packs are laid out as tools/asset_pack.py writes them, written to a
+// temporary file and mapped with assetsBeginFile(). Every entry must be
+// found with its fields and its blob in place, names not in the index must
+// miss, and a pack with a bad magic, a bad index checksum, a size larger
+// than the file or a misaligned blob must be rejected, leaving no pack.
+//
+//   pio test -e native -f test_asset_pack
+
+#include <unity.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "Assets/AssetStore.h"
+
+struct Entry {
+  const char *name;
+  AssetType type;
+  uint8_t format;
+  uint16_t width;
+  uint16_t height;
+  std::vector<uint8_t> data;
+};
+
+// Deliberately not in name order; the writer sorts them
+static const Entry ENTRIES[] = {
+    {"logo", ASSET_RAW, 0, 0, 0, {0xCD, 0xCE, 0xCF}},
+    {"icon", ASSET_IMAGE, ASSET_IMG_RGB565, 2, 1, {0xAB, 0x01, 0x02, 0x03}},
+    {"a", ASSET_RAW, 0, 0, 0, {0x61}},
+    {"icons", ASSET_IMAGE, ASSET_IMG_RGB565_ALPHA, 1, 2,
+     {0x10, 0x11, 0x12, 0x13, 0x14, 0x15}},
+    {"ui_img_splash_clean_png", ASSET_IMAGE, ASSET_IMG_RLE, 320, 240,
+     std::vector<uint8_t>(40, 0x5A)},
+    {"z", ASSET_FONT, 0, 0, 0, std::vector<uint8_t>(ASSET_ALIGN + 1, 0x7A)},
+};
+static const size_t ENTRY_COUNT = sizeof(ENTRIES) / sizeof(ENTRIES[0]);
+
+static void put16(uint8_t *p, uint32_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v) {
+  for (int i = 0; i < 4; i++)
+    p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static size_t align(size_t n) {
+  return (n + ASSET_ALIGN - 1) / ASSET_ALIGN * ASSET_ALIGN;
+}
+
+static const Entry *sortedEntry(size_t i) {
+  std::vector<const Entry *> sorted;
+  for (const Entry &e : ENTRIES)
+    sorted.push_back(&e);
+  std::sort(sorted.begin(), sorted.end(), [](const Entry *a, const Entry *b) {
+    return strcmp(a->name, b->name) < 0;
+  });
+  return sorted[i];
+}
+
+static size_t indexEnd() {
+  return ASSET_HEADER_SIZE + ENTRY_COUNT * ASSET_ENTRY_SIZE;
+}
+
+static uint8_t *entryAt(std::vector<uint8_t> &pack, size_t i) {
+  return pack.data() + ASSET_HEADER_SIZE + i * ASSET_ENTRY_SIZE;
+}
+
+// Index checksum in the header, after the index was changed
+static void seal(std::vector<uint8_t> &pack) {
+  put32(pack.data() + 12, assetFnv1a(pack.data() + ASSET_HEADER_SIZE,
+                                     indexEnd() - ASSET_HEADER_SIZE));
+}
+
+// As build_pack() in tools/asset_pack.py
+static std::vector<uint8_t> buildPack() {
+  size_t offset = align(indexEnd());
+  std::vector<uint8_t> pack(offset);
+  memcpy(pack.data(), "APK1", 4);
+  put32(pack.data() + 4, ENTRY_COUNT);
+
+  for (size_t i = 0; i < ENTRY_COUNT; i++) {
+    const Entry *e = sortedEntry(i);
+    uint8_t *p = entryAt(pack, i);
+    memcpy(p, e->name, strlen(e->name));
+    put32(p + 32, pack.size());
+    put32(p + 36, e->data.size());
+    p[40] = e->type;
+    p[41] = e->format;
+    put16(p + 42, e->width);
+    put16(p + 44, e->height);
+    pack.insert(pack.end(), e->data.begin(), e->data.end());
+    pack.resize(align(pack.size()));
+  }
+  put32(pack.data() + 8, pack.size());
+  seal(pack);
+  return pack;
+}
+
+// Write size bytes of pack to a temporary file and map it
+static bool mapPack(const std::vector<uint8_t> &pack, size_t size) {
+  char path[] = "/tmp/test_asset_pack_XXXXXX";
+  int fd = mkstemp(path);
+  TEST_ASSERT_TRUE(fd >= 0);
+  TEST_ASSERT_EQUAL_UINT32(size, (uint32_t)write(fd, pack.data(), size));
+  close(fd);
+  bool ok = assetsBeginFile(path);
+  unlink(path);
+  return ok;
+}
+
+static bool mapPack(const std::vector<uint8_t> &pack) {
+  return mapPack(pack, pack.size());
+}
+
+static void assertRejected(const std::vector<uint8_t> &pack, size_t size) {
+  // Start from a good pack so a rejection has something to clear
+  TEST_ASSERT_TRUE(mapPack(buildPack()));
+  TEST_ASSERT_FALSE(mapPack(pack, size));
+  TEST_ASSERT_FALSE(assets().isOpen());
+  TEST_ASSERT_EQUAL_UINT32(0, assets().count());
+  AssetInfo info = {};
+  TEST_ASSERT_FALSE(assets().find("icon", info));
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void test_every_entry_found() {
+  std::vector<uint8_t> pack = buildPack();
+  TEST_ASSERT_TRUE(mapPack(pack));
+  const AssetPack &a = assets();
+  TEST_ASSERT_TRUE(a.isOpen());
+  TEST_ASSERT_EQUAL_UINT32(ENTRY_COUNT, a.count());
+  TEST_ASSERT_EQUAL_UINT32(pack.size(), a.size());
+
+  for (size_t i = 0; i < ENTRY_COUNT; i++) {
+    const Entry *e = sortedEntry(i);
+    TEST_ASSERT_EQUAL_STRING(e->name, a.name(i));
+
+    AssetInfo info = {};
+    TEST_ASSERT_TRUE(a.find(e->name, info));
+    TEST_ASSERT_EQUAL_UINT32(i, info.index);
+    TEST_ASSERT_EQUAL_UINT32(e->type, info.type);
+    TEST_ASSERT_EQUAL_UINT32(e->format, info.format);
+    TEST_ASSERT_EQUAL_UINT32(e->width, info.width);
+    TEST_ASSERT_EQUAL_UINT32(e->height, info.height);
+    TEST_ASSERT_EQUAL_UINT32(e->data.size(), info.size);
+    // Blobs are read in place from the page-aligned mapping
+    TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)info.data % ASSET_ALIGN);
+    TEST_ASSERT_EQUAL_MEMORY(e->data.data(), info.data, info.size);
+    TEST_ASSERT_TRUE(info.data == a.at(i).data);
+  }
+}
+
+static void test_missing_names_not_found() {
+  TEST_ASSERT_TRUE(mapPack(buildPack()));
+  // Before the first, prefixes, extensions, between and after the last
+  static const char *const MISSES[] = {"",     "0",  "ico",   "iconz",
+                                       "icon ", "b",  "ICON",  "logos",
+                                       "ui_img", "zz", "\x7f"};
+  for (const char *name : MISSES) {
+    AssetInfo info = {};
+    TEST_ASSERT_FALSE_MESSAGE(assets().find(name, info), name);
+  }
+}
+
+static void test_bad_magic_rejected() {
+  std::vector<uint8_t> pack = buildPack();
+  pack[3] = '2';
+  assertRejected(pack, pack.size());
+}
+
+static void test_bad_checksum_rejected() {
+  // Only the reserved field changes, so nothing but the checksum is off
+  std::vector<uint8_t> pack = buildPack();
+  entryAt(pack, 1)[46] = 1;
+  assertRejected(pack, pack.size());
+}
+
+static void test_truncated_file_rejected() {
+  // The header promises more than the file holds
+  std::vector<uint8_t> pack = buildPack();
+  assertRejected(pack, pack.size() - 1);
+  assertRejected(pack, indexEnd());
+  assertRejected(pack, ASSET_HEADER_SIZE - 1);
+}
+
+static void test_misaligned_offset_rejected() {
+  // Otherwise consistent: the checksum covers the moved offset
+  std::vector<uint8_t> pack = buildPack();
+  uint8_t *e = entryAt(pack, 2);
+  put32(e + 32, assetRead32(e + 32) + 2);
+  seal(pack);
+  assertRejected(pack, pack.size());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_every_entry_found);
+  RUN_TEST(test_missing_names_not_found);
+  RUN_TEST(test_bad_magic_rejected);
+  RUN_TEST(test_bad_checksum_rejected);
+  RUN_TEST(test_truncated_file_rejected);
+  RUN_TEST(test_misaligned_offset_rejected);
+  return UNITY_END();
+}
@@ -0,0 +1 @@
+#include "BLE/ClientCallbacks.cpp"
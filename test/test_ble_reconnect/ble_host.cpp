@@ -0,0 +1,5 @@
+// The BLE sources under test: test_build_src is off for [env:native], and
+// each of them keeps its own static LOG_TAG, hence one file per source.
+#include "BLE/BleKeyboardHost.cpp"
+#include "BLE/ConnParamPolicy.cpp"
+#include "BLE/HidKeymap.cpp"
@@ -0,0 +1,168 @@
+// Cached reconnect of BLE/BleKeyboardHost against the fake peer in
+// native/include/NimBLEDevice.h: a directed connect to the cached address
+// that rewrites the CCCDs, and the fallback to scanning when the bond or a
+// CCCD write fails.
+//
+//   pio test -e native -f test_ble_reconnect
+
+#include <unity.h>
+
+#include <lvgl.h>
+
+#include "BLE/BleKeyboardHost.h"
+
+static const uint8_t ADDRESS[6] = {0x66, 0x55, 0x44, 0x33, 0x22, 0x11};
+static const uint8_t ADDRESS_TYPE = 1; // random
+// Value / CCCD handles of the two cached input reports
+static const uint16_t KEYS_HANDLE = 0x20;
+static const uint16_t KEYS_CCCD = 0x21;
+static const uint16_t EXTRA_HANDLE = 0x30;
+static const uint16_t EXTRA_CCCD = 0x31;
+
+static BleKeyboardHost *s_host = nullptr;
+
+static BondedKeyboard cachedKeyboard() {
+  BondedKeyboard rec;
+  rec.clear();
+  rec.version = BOND_CACHE_VERSION;
+  rec.setAddress(NimBLEAddress(ADDRESS, ADDRESS_TYPE));
+  rec.addReport({KEYS_HANDLE, KEYS_CCCD, 0x0001, 0, false});
+  rec.addReport({EXTRA_HANDLE, EXTRA_CCCD, 0x0001, 0, false});
+  rec.reportMap = hidBootKeyboardMap();
+  return rec;
+}
+
+static void routeReport(uint16_t connHandle, uint16_t handle, uint8_t *data,
+                        size_t length, bool) {
+  s_host->parseHIDReport(connHandle, handle, data, length);
+}
+
+static bool cacheStored() {
+  BondedKeyboard rec;
+  return bondCacheLoad(0, rec);
+}
+
+void setUp() {
+  // Bonded, in range and cached in slot 0, on a fresh host stack
+  NativeBle::Peer &p = NativeBle::peer();
+  memcpy(p.address, ADDRESS, sizeof(ADDRESS));
+  p.addressType = ADDRESS_TYPE;
+  p.inRange = true;
+  p.bonded = true;
+  p.lostKeys = false;
+  p.failCccd = false;
+  p.connected = false;
+  p.cccdWrites = 0;
+  NativeBle::scan() = {0, 0};
+  NativeBle::listeners() = nullptr;
+  for (uint8_t slot = 0; slot < HID_MAX_PEERS; slot++)
+    bondCacheClear(slot);
+  TEST_ASSERT_TRUE(bondCacheSave(0, cachedKeyboard()));
+
+  s_host = new BleKeyboardHost();
+  s_host->setNotifyCB(routeReport);
+}
+
+void tearDown() {
+  // The client's callbacks point at the host: disconnect while it exists
+  NimBLEClient *pClient =
+      NimBLEDevice::getClientByPeerAddress(NimBLEAddress(ADDRESS, ADDRESS_TYPE));
+  if (pClient) {
+    pClient->disconnect();
+    NimBLEDevice::deleteClient(pClient);
+  }
+  delete s_host;
+  s_host = nullptr;
+}
+
+static void assertFellBackToScan() {
+  TEST_ASSERT_EQUAL_UINT8(0, s_host->connectedCount());
+  TEST_ASSERT_FALSE(NativeBle::peer().connected);
+  TEST_ASSERT_FALSE(cacheStored());
+  TEST_ASSERT_EQUAL_UINT16(1, NativeBle::scan().starts);
+  TEST_ASSERT_EQUAL_UINT16(SCAN_IDLE_INTERVAL_MS, NativeBle::scan().interval);
+}
+
+static void test_directed_connect_restores_subscriptions() {
+  s_host->begin();
+  s_host->tick();
+
+  TEST_ASSERT_EQUAL_UINT8(1, s_host->connectedCount());
+  TEST_ASSERT_TRUE(s_host->isConnectedTo(NimBLEAddress(ADDRESS, ADDRESS_TYPE)));
+  TEST_ASSERT_TRUE(NativeBle::peer().connected);
+  // Both CCCDs rewritten from the cache, no discovery
+  TEST_ASSERT_EQUAL_UINT16(2, NativeBle::peer().cccdWrites);
+  TEST_ASSERT_TRUE(cacheStored());
+  // Still looking for further peers, at the connected duty cycle
+  TEST_ASSERT_EQUAL_UINT16(1, NativeBle::scan().starts);
+  TEST_ASSERT_EQUAL_UINT16(SCAN_CONNECTED_INTERVAL_MS,
+                           NativeBle::scan().interval);
+}
+
+static void test_cached_reports_are_routed() {
+  s_host->begin();
+  s_host->tick();
+  TEST_ASSERT_EQUAL_UINT8(1, s_host->connectedCount());
+
+  // Boot keyboard report with 'a' down, on a handle known only from the cache
+  uint8_t report[8] = {0, 0, 0x04, 0, 0, 0, 0, 0};
+  NativeBle::notify(KEYS_HANDLE, report, sizeof(report));
+  TEST_ASSERT_TRUE(s_host->hasKey());
+  KeyEvent key = s_host->getKey();
+  TEST_ASSERT_EQUAL_UINT32('a', key.keycode);
+  TEST_ASSERT_TRUE(key.pressed);
+
+  // Not one of the cached reports
+  report[2] = 0x05;
+  NativeBle::notify(0x40, report, sizeof(report));
+  TEST_ASSERT_FALSE(s_host->hasKey());
+}
+
+static void test_bond_gone_before_boot_scans() {
+  NativeBle::peer().bonded = false;
+  s_host->begin();
+  s_host->tick();
+
+  assertFellBackToScan();
+  TEST_ASSERT_EQUAL_UINT16(0, NativeBle::peer().cccdWrites);
+}
+
+static void test_lost_keys_falls_back_to_scan() {
+  NativeBle::peer().lostKeys = true;
+  s_host->begin();
+  s_host->tick();
+
+  assertFellBackToScan();
+  TEST_ASSERT_EQUAL_UINT16(0, NativeBle::peer().cccdWrites);
+}
+
+static void test_failed_cccd_write_falls_back_to_scan() {
+  NativeBle::peer().failCccd = true;
+  s_host->begin();
+  s_host->tick();
+
+  assertFellBackToScan();
+}
+
+static void test_out_of_range_keeps_cache() {
+  NativeBle::peer().inRange = false;
+  s_host->begin();
+  s_host->tick();
+
+  TEST_ASSERT_EQUAL_UINT8(0, s_host->connectedCount());
+  // Tried again after the next disconnect or reboot
+  TEST_ASSERT_TRUE(cacheStored());
+  TEST_ASSERT_EQUAL_UINT16(1, NativeBle::scan().starts);
+  TEST_ASSERT_EQUAL_UINT16(SCAN_IDLE_INTERVAL_MS, NativeBle::scan().interval);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_directed_connect_restores_subscriptions);
+  RUN_TEST(test_cached_reports_are_routed);
+  RUN_TEST(test_bond_gone_before_boot_scans);
+  RUN_TEST(test_lost_keys_falls_back_to_scan);
+  RUN_TEST(test_failed_cccd_write_falls_back_to_scan);
+  RUN_TEST(test_out_of_range_keeps_cache);
+  return UNITY_END();
+}
@@ -0,0 +1,5 @@
+// The flush path under test: test_build_src is off for [env:native]
+#include "Display/BandedFlush.cpp"
+#include "Display/FlushTransport.cpp"
+#include "Display/FramebufferTransport.cpp"
+#include "Display/SimulatedFlushTransport.cpp"
@@ -0,0 +1,110 @@
+// Pixel order from LVGL to the panel: solid colors rendered by LVGL
+// (LV_COLOR_16_SWAP, include/lv_conf.h) and sent through the banded flush
+// (Display/BandedFlush.h) must arrive in the framebuffer
+// (Display/FramebufferTransport.h), which stores them like the panel's
+// GRAM, as the expected RGB565 in every band.
+//
+//   pio test -e native -f test_color_order
+
+#include <unity.h>
+
+#include <lvgl.h>
+
+#include "Display/BandedFlush.h"
+#include "Display/FramebufferTransport.h"
+
+static constexpr uint16_t WIDTH = 320;
+static constexpr uint16_t HEIGHT = 240;
+static constexpr uint16_t ROWS = 40; // per band
+static constexpr uint16_t BANDS = HEIGHT / ROWS;
+
+static lv_color_t s_mem[2][WIDTH * ROWS];
+static lv_color_t *s_bufs[2] = {s_mem[0], s_mem[1]};
+static lv_disp_draw_buf_t s_drawBuf;
+static lv_disp_drv_t s_drv;
+static FramebufferTransport *s_fb = nullptr;
+
+static constexpr uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
+  // Truncating, like lv_color_make()
+  return (uint16_t)((r >> 3) << 11 | (g >> 2) << 5 | (b >> 3));
+}
+
+// As LvglPort's wait_cb
+static void waitCb(lv_disp_drv_t *) { s_fb->poll(true); }
+
+static void redraw() {
+  lv_obj_invalidate(lv_scr_act());
+  lv_refr_now(NULL);
+  s_fb->waitIdle();
+}
+
+static void setUpDisplay() {
+  lv_init();
+  s_fb = new FramebufferTransport(WIDTH, HEIGHT);
+  lv_disp_draw_buf_init(&s_drawBuf, s_bufs[0], s_bufs[1], WIDTH * ROWS);
+  lv_disp_drv_init(&s_drv);
+  s_drv.hor_res = WIDTH;
+  s_drv.ver_res = HEIGHT;
+  s_drv.draw_buf = &s_drawBuf;
+  s_drv.wait_cb = waitCb;
+  bandedFlushInit(&s_drv, *s_fb, s_bufs, 2);
+  lv_disp_drv_register(&s_drv);
+}
+
+void setUp() {
+  lv_obj_t *screen = lv_obj_create(NULL);
+  lv_obj_remove_style_all(screen);
+  lv_obj_set_style_bg_opa(screen, LV_OPA_COVER, 0);
+  lv_scr_load(screen);
+}
+
+void tearDown() {}
+
+static const uint8_t COLORS[][3] = {
+    {0xFF, 0, 0},       {0, 0xFF, 0},       {0, 0, 0xFF},
+    {0x12, 0x34, 0x56}, {0xFF, 0xFF, 0xFF}, {0, 0, 0},
+};
+static const size_t COLOR_COUNT = sizeof(COLORS) / sizeof(COLORS[0]);
+
+static void test_solid_colors() {
+  lv_obj_t *screen = lv_scr_act();
+  for (const auto &c : COLORS) {
+    lv_obj_set_style_bg_color(screen, lv_color_make(c[0], c[1], c[2]), 0);
+    redraw();
+    uint16_t want = rgb565(c[0], c[1], c[2]);
+    TEST_ASSERT_EQUAL_HEX16(want, s_fb->pixelAt(WIDTH / 2, HEIGHT / 2));
+    TEST_ASSERT_EQUAL_HEX16(want, s_fb->pixelAt(0, 0));
+    TEST_ASSERT_EQUAL_HEX16(want, s_fb->pixelAt(WIDTH - 1, HEIGHT - 1));
+  }
+}
+
+static void test_every_band() {
+  // One stripe per band, each its own color
+  lv_obj_t *screen = lv_scr_act();
+  for (uint16_t b = 0; b < BANDS; b++) {
+    const uint8_t *c = COLORS[b % COLOR_COUNT];
+    lv_obj_t *stripe = lv_obj_create(screen);
+    lv_obj_remove_style_all(stripe);
+    lv_obj_set_style_bg_opa(stripe, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(stripe, lv_color_make(c[0], c[1], c[2]), 0);
+    lv_obj_set_pos(stripe, 0, b * ROWS);
+    lv_obj_set_size(stripe, WIDTH, ROWS);
+  }
+  redraw();
+
+  for (uint16_t b = 0; b < BANDS; b++) {
+    const uint8_t *c = COLORS[b % COLOR_COUNT];
+    uint16_t want = rgb565(c[0], c[1], c[2]);
+    TEST_ASSERT_EQUAL_HEX16(want, s_fb->pixelAt(0, b * ROWS));
+    TEST_ASSERT_EQUAL_HEX16(want, s_fb->pixelAt(WIDTH / 2, b * ROWS + ROWS / 2));
+    TEST_ASSERT_EQUAL_HEX16(want, s_fb->pixelAt(WIDTH - 1, b * ROWS + ROWS - 1));
+  }
+}
+
+int main(int argc, char **argv) {
+  setUpDisplay();
+  UNITY_BEGIN();
+  RUN_TEST(test_solid_colors);
+  RUN_TEST(test_every_band);
+  return UNITY_END();
+}
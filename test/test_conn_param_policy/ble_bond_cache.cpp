@@ -0,0 +1 @@
+#include "BLE/BondCache.cpp"
@@ -0,0 +1 @@
+#include "BLE/ScanCallbacks.cpp"
@@ -0,0 +1,287 @@
+// BLE connection parameters chosen by BLE/ConnParamPolicy: the policy on
+// its own against a fake clock stepped through the hold, idle and rate
+// limit boundaries, and applied by BleKeyboardHost::tick() to the fake peer
+// in native/include/NimBLEDevice.h (clock stepped with hostAdvanceMs()).
+//
+//   pio test -e native -f test_conn_param_policy
+
+#include <unity.h>
+
+#include <lvgl.h>
+
+#include "BLE/BleKeyboardHost.h"
+
+static const uint8_t ADDRESS[6] = {0x66, 0x55, 0x44, 0x33, 0x22, 0x11};
+static const uint8_t ADDRESS_TYPE = 1; // random
+static const uint16_t KEYS_HANDLE = 0x20;
+static const uint16_t KEYS_CCCD = 0x21;
+// loop() ticks the host every 10 ms
+static const uint32_t TICK_MS = 10;
+
+static const uint32_t NO_INPUT = 0u - CONN_TYPING_HOLD_MS;
+
+static BleKeyboardHost *s_host = nullptr;
+
+// Policy under a fake clock
+static ConnParamPolicy s_policy;
+static uint32_t s_now = 0;
+static uint32_t s_lastInput = NO_INPUT;
+static uint32_t s_updates = 0;
+
+// Advance the clock by ms and feed the policy; true if it asked for an update
+static bool step(uint32_t ms = 1) {
+  s_now += ms;
+  bool changed = s_policy.update(s_now, s_lastInput);
+  if (changed)
+    s_updates++;
+  return changed;
+}
+
+// Step 1 ms at a time until the mode changes or until has passed; returns
+// the time of the change (until if none)
+static uint32_t stepUntilChange(uint32_t until) {
+  while (s_now < until) {
+    if (step())
+      return s_now;
+  }
+  return until;
+}
+
+static void routeReport(uint16_t connHandle, uint16_t handle, uint8_t *data,
+                        size_t length, bool) {
+  s_host->parseHIDReport(connHandle, handle, data, length);
+}
+
+// Run loop() for ms
+static void runFor(uint32_t ms) {
+  for (uint32_t t = 0; t < ms; t += TICK_MS) {
+    hostAdvanceMs(TICK_MS);
+    s_host->tick();
+    while (s_host->hasKey())
+      s_host->getKey();
+  }
+}
+
+static void pressKey(uint8_t usage) {
+  uint8_t report[8] = {0, 0, usage, 0, 0, 0, 0, 0};
+  NativeBle::notify(KEYS_HANDLE, report, sizeof(report));
+  report[2] = 0;
+  NativeBle::notify(KEYS_HANDLE, report, sizeof(report));
+}
+
+void setUp() {
+  s_policy = ConnParamPolicy();
+  s_now = 0;
+  s_lastInput = NO_INPUT;
+  s_updates = 0;
+}
+
+void tearDown() {
+  if (!s_host)
+    return;
+  NimBLEClient *pClient =
+      NimBLEDevice::getClientByPeerAddress(NimBLEAddress(ADDRESS, ADDRESS_TYPE));
+  if (pClient) {
+    pClient->disconnect();
+    NimBLEDevice::deleteClient(pClient);
+  }
+  delete s_host;
+  s_host = nullptr;
+}
+
+static void connectKeyboard() {
+  // A bonded boot keyboard in range, reconnected from the cache
+  NativeBle::Peer &p = NativeBle::peer();
+  memcpy(p.address, ADDRESS, sizeof(ADDRESS));
+  p.addressType = ADDRESS_TYPE;
+  p.inRange = true;
+  p.bonded = true;
+  p.lostKeys = false;
+  p.failCccd = false;
+  p.connected = false;
+  p.cccdWrites = 0;
+  NativeBle::scan() = {0, 0};
+  NativeBle::listeners() = nullptr;
+  for (uint8_t slot = 0; slot < HID_MAX_PEERS; slot++)
+    bondCacheClear(slot);
+  BondedKeyboard rec;
+  rec.clear();
+  rec.version = BOND_CACHE_VERSION;
+  rec.setAddress(NimBLEAddress(ADDRESS, ADDRESS_TYPE));
+  rec.addReport({KEYS_HANDLE, KEYS_CCCD, 0x0001, 0, false});
+  rec.reportMap = hidBootKeyboardMap();
+  TEST_ASSERT_TRUE(bondCacheSave(0, rec));
+
+  s_host = new BleKeyboardHost();
+  s_host->setNotifyCB(routeReport);
+  s_host->begin();
+  s_host->tick();
+  TEST_ASSERT_EQUAL_UINT8(1, s_host->connectedCount());
+  p.connUpdates = 0;
+  p.latency = 0;
+}
+
+static void test_boot_is_active() {
+  TEST_ASSERT_FALSE(step());
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_ACTIVE, s_policy.mode());
+  TEST_ASSERT_EQUAL_UINT16(CONN_PARAMS[CONN_MODE_ACTIVE].minInterval,
+                           s_policy.params().minInterval);
+}
+
+static void test_typing_hold_boundary() {
+  step(100);
+  s_lastInput = s_now;
+  TEST_ASSERT_TRUE(step(0));
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_TYPING, s_policy.mode());
+
+  // Held for exactly CONN_TYPING_HOLD_MS after the input
+  TEST_ASSERT_EQUAL_UINT32(s_lastInput + CONN_TYPING_HOLD_MS,
+                           stepUntilChange(s_lastInput + 60000));
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_ACTIVE, s_policy.mode());
+  TEST_ASSERT_EQUAL_UINT32(2, s_updates);
+}
+
+static void test_input_extends_hold() {
+  s_lastInput = s_now;
+  TEST_ASSERT_TRUE(step());
+  // A key every second keeps TYPING without further requests
+  for (int i = 0; i < 10; i++) {
+    TEST_ASSERT_EQUAL_UINT32(s_now + 1000, stepUntilChange(s_now + 1000));
+    s_lastInput = s_now;
+  }
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_TYPING, s_policy.mode());
+  TEST_ASSERT_EQUAL_UINT32(1, s_updates);
+  TEST_ASSERT_EQUAL_UINT32(s_lastInput + CONN_TYPING_HOLD_MS,
+                           stepUntilChange(s_lastInput + 60000));
+}
+
+static void test_idle_boundary() {
+  s_lastInput = s_now;
+  step();
+  uint32_t active = stepUntilChange(60000);
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_ACTIVE, s_policy.mode());
+
+  // Idle counts from the last step that still saw the input
+  TEST_ASSERT_EQUAL_UINT32(active - 1 + CONN_IDLE_AFTER_MS,
+                           stepUntilChange(active + 60000));
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_IDLE, s_policy.mode());
+  TEST_ASSERT_EQUAL_UINT8(CONN_PARAMS[CONN_MODE_IDLE].latency,
+                          s_policy.params().latency);
+
+  // Stays idle without further requests
+  TEST_ASSERT_EQUAL_UINT32(s_now + 600000, stepUntilChange(s_now + 600000));
+  TEST_ASSERT_EQUAL_UINT32(3, s_updates);
+}
+
+static void test_idle_without_input_since_boot() {
+  // Nothing since boot: idle after CONN_IDLE_AFTER_MS of the first update
+  TEST_ASSERT_EQUAL_UINT32(CONN_IDLE_AFTER_MS,
+                           stepUntilChange(CONN_IDLE_AFTER_MS + 1000));
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_IDLE, s_policy.mode());
+}
+
+static void test_speed_up_is_immediate() {
+  stepUntilChange(60000);
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_IDLE, s_policy.mode());
+  // Right after the idle request, inside the rate limit gap
+  s_lastInput = s_now;
+  TEST_ASSERT_TRUE(step());
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_TYPING, s_policy.mode());
+}
+
+static void test_slow_down_rate_limit_boundary() {
+  // The loop stalled (a connect): the input is first seen just before its
+  // hold runs out, so the hold ends right after the TYPING request
+  s_lastInput = s_now + 1;
+  TEST_ASSERT_TRUE(step(CONN_TYPING_HOLD_MS));
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_TYPING, s_policy.mode());
+  uint32_t typing = s_now;
+
+  // ACTIVE waits for CONN_MIN_UPDATE_GAP_MS since that request
+  TEST_ASSERT_EQUAL_UINT32(typing + CONN_MIN_UPDATE_GAP_MS,
+                           stepUntilChange(typing + 60000));
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_ACTIVE, s_policy.mode());
+  TEST_ASSERT_EQUAL_UINT32(2, s_updates);
+}
+
+// Input as a user would produce it, with the mode expected after each step
+// and whether an update is requested
+struct Step {
+  uint32_t t;
+  uint32_t lastInput;
+  ConnMode mode;
+  bool changed;
+};
+
+static const Step SESSION[] = {
+    {0, NO_INPUT, CONN_MODE_ACTIVE, false}, // boot
+    {100, 100, CONN_MODE_TYPING, true},     // text area clicked
+    {2099, 100, CONN_MODE_TYPING, false},   // still within hold
+    {2100, 100, CONN_MODE_ACTIVE, true},    // focused, but nobody types
+    {5000, 4900, CONN_MODE_TYPING, true},   // typing
+    {6899, 4900, CONN_MODE_TYPING, false},  // hold
+    {6900, 4900, CONN_MODE_ACTIVE, true},   // hold expired
+    {21898, 4900, CONN_MODE_ACTIVE, false}, // just under idle time
+    {21899, 4900, CONN_MODE_IDLE, true},    // idle
+    {60000, 4900, CONN_MODE_IDLE, false},   // stays idle
+    {60001, 60001, CONN_MODE_TYPING, true}, // key: immediate
+};
+
+static void test_session() {
+  for (const Step &st : SESSION) {
+    s_now = st.t;
+    s_lastInput = st.lastInput;
+    TEST_ASSERT_EQUAL(st.changed, step(0));
+    TEST_ASSERT_EQUAL_UINT8(st.mode, s_policy.mode());
+  }
+}
+
+// ui_Main keeps ui_InputWord focused the whole time it is shown: one click
+// into it, then nobody types. The link must still fall back to idle.
+static void test_main_screen_idle() {
+  connectKeyboard();
+  s_host->noteTextInput();
+  runFor(TICK_MS);
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_TYPING, s_host->connMode());
+
+  runFor(CONN_TYPING_HOLD_MS);
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_ACTIVE, s_host->connMode());
+
+  runFor(CONN_IDLE_AFTER_MS);
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_IDLE, s_host->connMode());
+  TEST_ASSERT_EQUAL_UINT16(CONN_PARAMS[CONN_MODE_IDLE].latency,
+                           NativeBle::peer().latency);
+
+  // And stays there, without further requests
+  uint16_t updates = NativeBle::peer().connUpdates;
+  runFor(60000);
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_IDLE, s_host->connMode());
+  TEST_ASSERT_EQUAL_UINT16(updates, NativeBle::peer().connUpdates);
+}
+
+static void test_key_wakes_idle_link() {
+  connectKeyboard();
+  runFor(CONN_IDLE_AFTER_MS + TICK_MS);
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_IDLE, s_host->connMode());
+
+  pressKey(0x04);
+  runFor(TICK_MS);
+  TEST_ASSERT_EQUAL_UINT8(CONN_MODE_TYPING, s_host->connMode());
+  TEST_ASSERT_EQUAL_UINT16(CONN_PARAMS[CONN_MODE_TYPING].latency,
+                           NativeBle::peer().latency);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_boot_is_active);
+  RUN_TEST(test_typing_hold_boundary);
+  RUN_TEST(test_input_extends_hold);
+  RUN_TEST(test_idle_boundary);
+  RUN_TEST(test_idle_without_input_since_boot);
+  RUN_TEST(test_speed_up_is_immediate);
+  RUN_TEST(test_slow_down_rate_limit_boundary);
+  RUN_TEST(test_session);
+  RUN_TEST(test_main_screen_idle);
+  RUN_TEST(test_key_wakes_idle_link);
+  return UNITY_END();
+}
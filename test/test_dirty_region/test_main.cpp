@@ -0,0 +1,206 @@
+// Display/DirtyRegion: coalescing of invalidated areas in 320x240 panel
+// coordinates. Hand-made layouts check each merge rule and the cost
+// boundary of a gap; pseudo-random sets check that the result covers every
+// area, never costs more than sending the areas as they are, and leaves no
+// pair that would still be cheaper merged.
+//
+//   pio test -e native -f test_dirty_region
+
+#include <unity.h>
+
+#include "Display/DirtyRegion.h"
+
+static const uint32_t OVERHEAD = 64;
+
+template <size_t N>
+static DirtyRegion coalesced(const DirtyRect (&rects)[N], uint32_t overhead) {
+  DirtyRegion r;
+  for (size_t i = 0; i < N; i++)
+    r.add(rects[i]);
+  r.coalesce(overhead);
+  return r;
+}
+
+static uint64_t cost(const DirtyRegion &r, uint32_t overhead) {
+  return r.pixels() + (uint64_t)r.count() * overhead;
+}
+
+static bool contains(const DirtyRect &outer, const DirtyRect &inner) {
+  return outer.x1 <= inner.x1 && outer.y1 <= inner.y1 &&
+         outer.x2 >= inner.x2 && outer.y2 >= inner.y2;
+}
+
+static bool covered(const DirtyRegion &r, const DirtyRect &area) {
+  for (uint8_t i = 0; i < r.count(); i++) {
+    if (contains(r.rect(i), area))
+      return true;
+  }
+  return false;
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void test_contained_area_disappears() {
+  // A label and its text cursor: one transfer, the label's pixels
+  const DirtyRect rects[] = {{10, 10, 109, 29}, {100, 12, 101, 27}};
+  DirtyRegion r = coalesced(rects, OVERHEAD);
+  TEST_ASSERT_EQUAL_UINT32(1, r.count());
+  TEST_ASSERT_EQUAL_UINT32(100 * 20, r.pixels());
+}
+
+static void test_small_gap_merged() {
+  // Two widgets on one row, two columns apart: the gap is cheaper than a
+  // second address window, but never worth sending without one
+  const DirtyRect rects[] = {{10, 100, 59, 109}, {62, 100, 111, 109}};
+  DirtyRegion r = coalesced(rects, OVERHEAD);
+  TEST_ASSERT_EQUAL_UINT32(1, r.count());
+  TEST_ASSERT_EQUAL_INT(10, r.rect(0).x1);
+  TEST_ASSERT_EQUAL_INT(111, r.rect(0).x2);
+  TEST_ASSERT_EQUAL_UINT32(2, coalesced(rects, 0).count());
+}
+
+static void test_gap_cost_boundary() {
+  // 50x10 areas g columns apart: merging sends 10 * g extra pixels to save
+  // one overhead, so it pays only while 10 * g < overhead
+  for (int16_t g = 1; g <= 12; g++) {
+    const DirtyRect rects[] = {{0, 0, 49, 9},
+                               {(int16_t)(50 + g), 0, (int16_t)(99 + g), 9}};
+    uint8_t want = 10u * g < OVERHEAD ? 1 : 2;
+    TEST_ASSERT_EQUAL_UINT32(want, coalesced(rects, OVERHEAD).count());
+  }
+  // No gain at exactly the overhead: stays two transfers
+  const DirtyRect even[] = {{0, 0, 49, 9}, {56, 0, 105, 9}};
+  TEST_ASSERT_EQUAL_UINT32(2, coalesced(even, 60).count());
+  TEST_ASSERT_EQUAL_UINT32(1, coalesced(even, 61).count());
+}
+
+static void test_far_areas_stay_separate() {
+  // Opposite corners: the bounding box would be the whole screen
+  const DirtyRect rects[] = {{0, 0, 19, 19}, {300, 220, 319, 239}};
+  DirtyRegion r = coalesced(rects, OVERHEAD);
+  TEST_ASSERT_EQUAL_UINT32(2, r.count());
+  TEST_ASSERT_EQUAL_UINT32(2 * 400, r.pixels());
+}
+
+static void test_touching_bands_chain() {
+  // The bands of a full-screen change become one rectangle
+  const DirtyRect rects[] = {{0, 0, 319, 39},    {0, 40, 319, 79},
+                             {0, 80, 319, 119},  {0, 120, 319, 159},
+                             {0, 160, 319, 199}, {0, 200, 319, 239}};
+  DirtyRegion r = coalesced(rects, OVERHEAD);
+  TEST_ASSERT_EQUAL_UINT32(1, r.count());
+  TEST_ASSERT_EQUAL_INT(0, r.rect(0).y1);
+  TEST_ASSERT_EQUAL_INT(239, r.rect(0).y2);
+  TEST_ASSERT_EQUAL_UINT32(320 * 240, r.pixels());
+}
+
+static void test_merge_enables_merge() {
+  // a and c alone would stay apart; through b all three become one
+  const DirtyRect rects[] = {{0, 0, 9, 9}, {14, 0, 23, 9}, {28, 0, 37, 9}};
+  DirtyRegion r = coalesced(rects, OVERHEAD);
+  TEST_ASSERT_EQUAL_UINT32(1, r.count());
+  TEST_ASSERT_EQUAL_UINT32(38 * 10, r.pixels());
+}
+
+static void test_single_and_empty_untouched() {
+  DirtyRegion r;
+  r.coalesce(OVERHEAD);
+  TEST_ASSERT_EQUAL_UINT32(0, r.count());
+  r.add({5, 6, 7, 8});
+  r.coalesce(OVERHEAD);
+  TEST_ASSERT_EQUAL_UINT32(1, r.count());
+  TEST_ASSERT_EQUAL_UINT32(9, r.pixels());
+  r.clear();
+  TEST_ASSERT_EQUAL_UINT32(0, r.count());
+  TEST_ASSERT_EQUAL_UINT32(0, r.pixels());
+}
+
+static void test_overflow_grows_closest() {
+  // More areas than slots: the extras grow a rectangle, nothing is dropped
+  DirtyRegion r;
+  DirtyRect added[DIRTY_MAX_RECTS + 4];
+  for (int16_t i = 0; i < DIRTY_MAX_RECTS + 4; i++) {
+    added[i] = {(int16_t)(i * 15), (int16_t)(i * 10), (int16_t)(i * 15 + 4),
+                (int16_t)(i * 10 + 4)};
+    r.add(added[i]);
+  }
+  TEST_ASSERT_EQUAL_UINT32(DIRTY_MAX_RECTS, r.count());
+  for (const DirtyRect &a : added)
+    TEST_ASSERT_TRUE(covered(r, a));
+
+  // The one that needs the fewest extra pixels grows, the others stay
+  r.clear();
+  for (int16_t i = 0; i < DIRTY_MAX_RECTS; i++)
+    r.add(added[i]);
+  r.add({(int16_t)(7 * 15 + 5), 7 * 10, (int16_t)(7 * 15 + 6), 7 * 10 + 4});
+  for (int16_t i = 0; i < DIRTY_MAX_RECTS; i++) {
+    DirtyRect want = added[i];
+    if (i == 7)
+      want.x2 += 2;
+    TEST_ASSERT_EQUAL_INT(want.x1, r.rect(i).x1);
+    TEST_ASSERT_EQUAL_INT(want.x2, r.rect(i).x2);
+    TEST_ASSERT_EQUAL_INT(want.y1, r.rect(i).y1);
+    TEST_ASSERT_EQUAL_INT(want.y2, r.rect(i).y2);
+  }
+}
+
+static uint32_t s_seed = 1;
+
+static uint32_t nextRandom() {
+  s_seed = s_seed * 1664525u + 1013904223u;
+  return s_seed >> 8;
+}
+
+static DirtyRect randomRect() {
+  int16_t x1 = nextRandom() % 320;
+  int16_t y1 = nextRandom() % 240;
+  int16_t w = 1 + nextRandom() % 60;
+  int16_t h = 1 + nextRandom() % 40;
+  return {x1, y1, (int16_t)(x1 + w - 1 < 319 ? x1 + w - 1 : 319),
+          (int16_t)(y1 + h - 1 < 239 ? y1 + h - 1 : 239)};
+}
+
+static void test_random_sets() {
+  static const uint32_t OVERHEADS[] = {0, 16, OVERHEAD, 1000, 20000};
+  for (uint32_t overhead : OVERHEADS) {
+    for (uint32_t run = 0; run < 200; run++) {
+      DirtyRect added[DIRTY_MAX_RECTS];
+      uint8_t n = 1 + nextRandom() % DIRTY_MAX_RECTS;
+      DirtyRegion r;
+      for (uint8_t i = 0; i < n; i++) {
+        added[i] = randomRect();
+        r.add(added[i]);
+      }
+      uint64_t before = cost(r, overhead);
+      r.coalesce(overhead);
+
+      TEST_ASSERT_TRUE(r.count() >= 1 && r.count() <= n);
+      TEST_ASSERT_TRUE(cost(r, overhead) <= before);
+      for (uint8_t i = 0; i < n; i++)
+        TEST_ASSERT_TRUE(covered(r, added[i]));
+      // Stopped only because no merge lowers the cost any more
+      for (uint8_t i = 0; i < r.count(); i++) {
+        for (uint8_t j = i + 1; j < r.count(); j++) {
+          uint64_t separate =
+              (uint64_t)r.rect(i).area() + r.rect(j).area() + overhead;
+          TEST_ASSERT_TRUE(r.rect(i).unite(r.rect(j)).area() >= separate);
+        }
+      }
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_contained_area_disappears);
+  RUN_TEST(test_small_gap_merged);
+  RUN_TEST(test_gap_cost_boundary);
+  RUN_TEST(test_far_areas_stay_separate);
+  RUN_TEST(test_touching_bands_chain);
+  RUN_TEST(test_merge_enables_merge);
+  RUN_TEST(test_single_and_empty_untouched);
+  RUN_TEST(test_overflow_grows_closest);
+  RUN_TEST(test_random_sets);
+  return UNITY_END();
+}
@@ -0,0 +1,4 @@
+// The display sources under test (test_build_src is off for [env:native])
+#include "Display/BandedFlush.cpp"
+#include "Display/FlushTransport.cpp"
+#include "Display/SimulatedFlushTransport.cpp"
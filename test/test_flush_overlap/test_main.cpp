@@ -0,0 +1,181 @@
+// Banded flush (Display/BandedFlush.h) through SimulatedFlushTransport.
+//
+// LVGL's partial refresh (lv_refr.c: wait for a free buffer, render into it,
+// flush, swap) is replayed band by band with a fixed render time, against a
+// bus with a fixed transfer time per band. With two or more buffers the
+// time rendering stalls on the bus must stay below the transfer time: the
+// next band renders while the previous one is on the wire. Every band must
+// be acknowledged exactly once, go out in order, and never be rendered
+// into while it is sent.
+//
+//   pio test -e native -f test_flush_overlap
+
+#include <unity.h>
+
+#include <lvgl.h>
+
+#include "Display/BandedFlush.h"
+#include "Display/SimulatedFlushTransport.h"
+
+static constexpr uint32_t WIDTH = 320;
+static constexpr uint32_t ROWS = 40;
+static constexpr uint32_t BANDS = 240 / ROWS; // per frame
+static constexpr uint32_t FRAMES = 2;
+static constexpr uint32_t RENDER_US = 2000;
+static constexpr uint32_t TRANSFER_US = 5000;
+// 16 bits per pixel, no per-window setup time
+static constexpr uint32_t SPI_HZ =
+  (uint32_t)((uint64_t)WIDTH * ROWS * 16 * 1000000 / TRANSFER_US);
+
+// Checks what goes on the wire. A band's pixels all hold its number.
+class CheckingTransport : public SimulatedFlushTransport {
+public:
+  CheckingTransport() : SimulatedFlushTransport(SPI_HZ, 0) {}
+
+  uint32_t sent = 0;
+  uint32_t outOfOrder = 0;
+  uint32_t overwritten = 0; // buffers rendered into while on the wire
+
+protected:
+  void startTransfer(int32_t x, int32_t y, uint32_t w, uint32_t h,
+                     const uint16_t *pixels, uint32_t count) override {
+    if (pixels[0] != sent)
+      outOfOrder++;
+    m_pixels = pixels;
+    m_count = count;
+    m_band = pixels[0];
+    sent++;
+    SimulatedFlushTransport::startTransfer(x, y, w, h, pixels, count);
+  }
+
+  bool transferDone() override {
+    if (m_pixels[0] != m_band || m_pixels[m_count - 1] != m_band)
+      overwritten++;
+    return SimulatedFlushTransport::transferDone();
+  }
+
+private:
+  const uint16_t *m_pixels = nullptr;
+  uint32_t m_count = 0;
+  uint16_t m_band = 0;
+};
+
+static lv_color_t s_mem[BANDED_FLUSH_MAX_BUFS][WIDTH * ROWS];
+static lv_color_t *s_bufs[BANDED_FLUSH_MAX_BUFS] = {s_mem[0], s_mem[1],
+                                                    s_mem[2]};
+static lv_disp_draw_buf_t s_drawBuf;
+static lv_disp_drv_t s_drv;
+static CheckingTransport *s_transport = nullptr;
+
+// As LvglPort's wait_cb
+static void waitCb(lv_disp_drv_t *) { s_transport->poll(true); }
+
+static void setUpDisplay(uint8_t count) {
+  lv_disp_draw_buf_init(&s_drawBuf, s_bufs[0],
+                        count > 1 ? s_bufs[1] : nullptr, WIDTH * ROWS);
+  lv_disp_drv_init(&s_drv);
+  s_drv.hor_res = WIDTH;
+  s_drv.ver_res = BANDS * ROWS;
+  s_drv.draw_buf = &s_drawBuf;
+  s_drv.wait_cb = waitCb;
+  bandedFlushInit(&s_drv, *s_transport, s_bufs, count);
+}
+
+static void render(lv_color_t *buf, uint16_t band) {
+  uint32_t start = micros();
+  uint16_t *px = (uint16_t *)buf;
+  for (uint32_t i = 0; i < WIDTH * ROWS; i++)
+    px[i] = band;
+  while (micros() - start < RENDER_US) {
+  }
+}
+
+static void waitFlushed() {
+  while (s_drawBuf.flushing)
+    s_drv.wait_cb(&s_drv);
+}
+
+// One refresh of the whole screen, as lv_refr.c does it in partial mode
+static void refresh(uint16_t &band) {
+  for (uint32_t i = 0; i < BANDS; i++, band++) {
+    bool twoBufs = s_drawBuf.buf1 && s_drawBuf.buf2;
+    if (!twoBufs)
+      waitFlushed();
+    lv_color_t *buf = (lv_color_t *)s_drawBuf.buf_act;
+    render(buf, band);
+    if (twoBufs)
+      waitFlushed();
+
+    // Every earlier band has been given back, and only once
+    const BandedFlushStats &st = bandedFlushStats();
+    TEST_ASSERT_EQUAL_UINT32(st.bands, st.acks);
+
+    s_drawBuf.flushing = 1;
+    lv_area_t area = {0, (lv_coord_t)(i * ROWS), (lv_coord_t)(WIDTH - 1),
+                      (lv_coord_t)(i * ROWS + ROWS - 1)};
+    s_drv.flush_cb(&s_drv, &area, buf);
+    if (twoBufs)
+      s_drawBuf.buf_act = s_drawBuf.buf_act == s_drawBuf.buf1 ? s_drawBuf.buf2
+                                                              : s_drawBuf.buf1;
+  }
+}
+
+static void run(uint8_t count) {
+  setUpDisplay(count);
+  uint16_t band = 0;
+  for (uint32_t f = 0; f < FRAMES; f++)
+    refresh(band);
+  s_transport->waitIdle();
+
+  const uint32_t total = BANDS * FRAMES;
+  const BandedFlushStats &st = bandedFlushStats();
+  TEST_ASSERT_EQUAL_UINT32(total, st.bands);
+  TEST_ASSERT_EQUAL_UINT32(total, st.acks);
+  TEST_ASSERT_FALSE(s_drawBuf.flushing);
+  TEST_ASSERT_EQUAL_UINT32(total, s_transport->sent);
+  TEST_ASSERT_EQUAL_UINT32(0, s_transport->outOfOrder);
+  TEST_ASSERT_EQUAL_UINT32(0, s_transport->overwritten);
+  TEST_ASSERT_TRUE(s_transport->stats().busyUs >=
+                   (uint64_t)total * TRANSFER_US);
+}
+
+void setUp() { s_transport = new CheckingTransport(); }
+
+void tearDown() {
+  delete s_transport;
+  s_transport = nullptr;
+}
+
+// Every band but the first renders while the one before it is sent, so
+// the stall is at least that much shorter than the transfer time
+static void assertOverlapped() {
+  const FlushTransport::Stats &st = s_transport->stats();
+  const uint64_t overlapped = (uint64_t)(BANDS * FRAMES - 1) * RENDER_US;
+  TEST_ASSERT_TRUE(st.waitUs < st.busyUs);
+  TEST_ASSERT_TRUE(st.waitUs + overlapped / 2 <= st.busyUs);
+}
+
+static void test_single_buffer_stalls_for_every_transfer() {
+  run(1);
+  // Nothing to render into while the only buffer is on the wire
+  const FlushTransport::Stats &st = s_transport->stats();
+  TEST_ASSERT_TRUE(st.waitUs * 10 >= st.busyUs * 9);
+}
+
+static void test_two_buffers_overlap_render_and_transfer() {
+  run(2);
+  assertOverlapped();
+}
+
+static void test_three_buffers_overlap_render_and_transfer() {
+  run(3);
+  assertOverlapped();
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_single_buffer_stalls_for_every_transfer);
+  RUN_TEST(test_two_buffers_overlap_render_and_transfer);
+  RUN_TEST(test_three_buffers_overlap_render_and_transfer);
+  return UNITY_END();
+}
@@ -0,0 +1,313 @@
+// Touch traces replayed through Touch/GestureRecognizer. A trace is the
+// sample stream the touch reader task (Touch/TouchInput.cpp) produces: one
+// entry per GT911 report, a zero-contact sample when the fingers lift.
+//
+//   pio test -e native -f test_gesture_recognizer
+
+#include <unity.h>
+
+#include "Touch/GestureRecognizer.h"
+
+static TouchSample one(uint32_t t, uint16_t x, uint16_t y) {
+  TouchSample s = {};
+  s.timestamp = t;
+  s.count = 1;
+  s.points[0] = {x, y, 0};
+  return s;
+}
+
+static TouchSample two(uint32_t t, uint16_t x0, uint16_t y0, uint16_t x1,
+                       uint16_t y1) {
+  TouchSample s = one(t, x0, y0);
+  s.count = 2;
+  s.points[1] = {x1, y1, 1};
+  return s;
+}
+
+static TouchSample up(uint32_t t) {
+  TouchSample s = {};
+  s.timestamp = t;
+  return s;
+}
+
+#define REPLAY_MAX 32
+
+struct Replay {
+  Gesture gestures[REPLAY_MAX];
+  int count;
+};
+
+template <size_t N> static Replay replay(const TouchSample (&trace)[N]) {
+  GestureRecognizer r;
+  Replay out = {};
+  for (size_t i = 0; i < N; i++) {
+    Gesture g = r.feed(trace[i]);
+    if (g.type == GESTURE_NONE)
+      continue;
+    TEST_ASSERT_TRUE(out.count < REPLAY_MAX);
+    if (out.count < REPLAY_MAX)
+      out.gestures[out.count++] = g;
+  }
+  return out;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+static void test_flick_left() {
+  // Quick flick to the left, drifting slightly down
+  const TouchSample trace[] = {one(0, 220, 120),  one(16, 200, 121),
+                               one(33, 170, 123), one(50, 140, 124),
+                               one(66, 120, 125), up(80)};
+  Replay r = replay(trace);
+  TEST_ASSERT_EQUAL(1, r.count);
+  TEST_ASSERT_EQUAL(GESTURE_SWIPE, r.gestures[0].type);
+  TEST_ASSERT_EQUAL(GESTURE_DIR_LEFT, r.gestures[0].dir);
+  // From where it started
+  TEST_ASSERT_EQUAL_UINT16(220, r.gestures[0].x);
+  TEST_ASSERT_EQUAL_UINT16(120, r.gestures[0].y);
+}
+
+static void test_flick_up() {
+  const TouchSample trace[] = {one(0, 160, 200), one(20, 162, 150),
+                               one(40, 165, 100), up(60)};
+  Replay r = replay(trace);
+  TEST_ASSERT_EQUAL(1, r.count);
+  TEST_ASSERT_EQUAL(GESTURE_DIR_UP, r.gestures[0].dir);
+}
+
+static void test_slow_drag_is_no_swipe() {
+  // Same distance, but too slow: a drag (scrolling)
+  const TouchSample trace[] = {one(0, 220, 120), one(300, 180, 120),
+                               one(600, 120, 120), up(700)};
+  TEST_ASSERT_EQUAL(0, replay(trace).count);
+}
+
+static void test_diagonal_is_no_swipe() {
+  // Neither axis dominates
+  const TouchSample trace[] = {one(0, 100, 100), one(40, 150, 145), up(60)};
+  TEST_ASSERT_EQUAL(0, replay(trace).count);
+}
+
+static void test_tap_is_nothing() {
+  // Short and within the slop
+  const TouchSample trace[] = {one(0, 50, 50), one(30, 52, 49), up(60)};
+  TEST_ASSERT_EQUAL(0, replay(trace).count);
+}
+
+static void test_long_press() {
+  // Held with a little jitter: exactly one long press, no swipe on release
+  const TouchSample trace[] = {one(0, 100, 100),   one(200, 103, 98),
+                               one(400, 101, 102), one(600, 102, 101),
+                               one(800, 100, 100), up(900)};
+  Replay r = replay(trace);
+  TEST_ASSERT_EQUAL(1, r.count);
+  TEST_ASSERT_EQUAL(GESTURE_LONG_PRESS, r.gestures[0].type);
+  TEST_ASSERT_EQUAL_UINT16(100, r.gestures[0].x);
+  TEST_ASSERT_EQUAL_UINT16(100, r.gestures[0].y);
+}
+
+static void test_long_press_boundary() {
+  // One sample short of the hold time, then exactly at it
+  const TouchSample shortHold[] = {one(0, 100, 100),
+                                   one(GESTURE_LONG_PRESS_MS - 1, 100, 100),
+                                   up(GESTURE_LONG_PRESS_MS + 10)};
+  TEST_ASSERT_EQUAL(0, replay(shortHold).count);
+  const TouchSample hold[] = {one(0, 100, 100),
+                              one(GESTURE_LONG_PRESS_MS, 100, 100),
+                              up(GESTURE_LONG_PRESS_MS + 10)};
+  TEST_ASSERT_EQUAL(1, replay(hold).count);
+}
+
+static void test_moved_hold_is_nothing() {
+  // Moving during the hold cancels it
+  const TouchSample trace[] = {one(0, 100, 100), one(300, 130, 100),
+                               one(700, 131, 100), up(800)};
+  TEST_ASSERT_EQUAL(0, replay(trace).count);
+}
+
+static void test_pinch_out() {
+  // From 100 px to 200 px apart, second finger landing late
+  const TouchSample trace[] = {
+      one(0, 110, 120),
+      two(16, 110, 120, 210, 120),
+      two(33, 100, 120, 220, 120), // 120 px: 1.2
+      two(50, 95, 120, 225, 120),  // 130 px: 1.3, below the next step
+      two(66, 70, 120, 250, 120),  // 180 px
+      two(83, 60, 120, 260, 120),  // 200 px
+      one(100, 60, 120),           // first finger up: still the pinch
+      up(110)};
+  Replay r = replay(trace);
+  // Three updates and the end
+  TEST_ASSERT_EQUAL(4, r.count);
+  // 8.8 scale relative to the start distance
+  TEST_ASSERT_EQUAL_UINT16(307, r.gestures[0].scaleQ8);
+  TEST_ASSERT_EQUAL_UINT16(460, r.gestures[1].scaleQ8);
+  TEST_ASSERT_EQUAL_UINT16(512, r.gestures[2].scaleQ8);
+  // The end carries the final scale and the centre
+  TEST_ASSERT_EQUAL(GESTURE_PINCH, r.gestures[3].type);
+  TEST_ASSERT_EQUAL(GESTURE_PHASE_END, r.gestures[3].phase);
+  TEST_ASSERT_EQUAL_UINT16(512, r.gestures[3].scaleQ8);
+  TEST_ASSERT_EQUAL_UINT16(160, r.gestures[3].x);
+  TEST_ASSERT_EQUAL_UINT16(120, r.gestures[3].y);
+}
+
+static void test_pinch_in() {
+  // Diagonal fingers: 5-12-13 triangles keep the distances exact
+  const TouchSample trace[] = {
+      two(0, 100, 100, 160, 244), // 156 px
+      two(20, 115, 136, 145, 208), // 78 px
+      up(40)};
+  Replay r = replay(trace);
+  TEST_ASSERT_EQUAL(2, r.count);
+  TEST_ASSERT_EQUAL_UINT16(GESTURE_SCALE_ONE / 2, r.gestures[0].scaleQ8);
+}
+
+// The reader task's stream for a pinch out on ui_Panel1: GT911 reports
+// every 9-11 ms with a pixel of jitter, the second finger landing three
+// reports late and lifting last, so the final reports carry its track ID
+// alone at index 0.
+static const TouchSample CADENCE_PINCH[] = {
+    {0, 1, {{152, 131, 0}}},
+    {11, 1, {{152, 132, 0}}},
+    {21, 1, {{151, 130, 0}}},
+    {32, 2, {{151, 131, 0}, {187, 101, 1}}},
+    {42, 2, {{153, 130, 0}, {188, 101, 1}}},
+    {51, 2, {{152, 131, 0}, {188, 101, 1}}},
+    {60, 2, {{149, 133, 0}, {189, 101, 1}}},
+    {70, 2, {{149, 133, 0}, {193, 100, 1}}},
+    {79, 2, {{146, 134, 0}, {193, 97, 1}}},
+    {88, 2, {{145, 136, 0}, {195, 96, 1}}},
+    {97, 2, {{142, 137, 0}, {199, 96, 1}}},
+    {108, 2, {{142, 140, 0}, {201, 93, 1}}},
+    {118, 2, {{138, 141, 0}, {203, 91, 1}}},
+    {127, 2, {{136, 143, 0}, {208, 89, 1}}},
+    {136, 2, {{131, 144, 0}, {211, 87, 1}}},
+    {147, 2, {{129, 148, 0}, {214, 84, 1}}},
+    {157, 2, {{126, 149, 0}, {217, 83, 1}}},
+    {166, 2, {{124, 151, 0}, {219, 80, 1}}},
+    {176, 2, {{119, 153, 0}, {223, 79, 1}}},
+    {187, 2, {{118, 156, 0}, {226, 76, 1}}},
+    {198, 2, {{114, 157, 0}, {231, 72, 1}}},
+    {208, 2, {{111, 160, 0}, {233, 72, 1}}},
+    {218, 2, {{109, 161, 0}, {236, 70, 1}}},
+    {228, 2, {{105, 164, 0}, {240, 67, 1}}},
+    {238, 2, {{103, 167, 0}, {242, 65, 1}}},
+    {248, 2, {{101, 167, 0}, {244, 63, 1}}},
+    {258, 2, {{100, 169, 0}, {247, 62, 1}}},
+    {268, 2, {{97, 171, 0}, {248, 60, 1}}},
+    {278, 2, {{95, 172, 0}, {251, 60, 1}}},
+    {288, 2, {{96, 170, 0}, {252, 60, 1}}},
+    {298, 2, {{94, 171, 0}, {252, 59, 1}}},
+    {308, 2, {{93, 172, 0}, {251, 57, 1}}},
+    {318, 2, {{93, 172, 0}, {251, 56, 1}}},
+    {329, 2, {{93, 172, 0}, {250, 56, 1}}},
+    {339, 2, {{93, 172, 0}, {252, 57, 1}}},
+    {350, 1, {{251, 57, 1}}},
+    {361, 1, {{251, 57, 1}}},
+    {371, 0, {}},
+};
+
+// A swipe right in the same cadence. The last report still has the finger
+// down: the reader synthesizes the release TOUCH_RELEASE_TIMEOUT_MS later.
+static const TouchSample CADENCE_SWIPE[] = {
+    {0, 1, {{69, 149, 0}}},
+    {10, 1, {{90, 151, 0}}},
+    {20, 1, {{107, 150, 0}}},
+    {30, 1, {{124, 151, 0}}},
+    {41, 1, {{144, 152, 0}}},
+    {50, 1, {{159, 152, 0}}},
+    {59, 1, {{176, 152, 0}}},
+    {68, 1, {{190, 153, 0}}},
+    {78, 1, {{204, 153, 0}}},
+    {88, 1, {{217, 153, 0}}},
+    {97, 1, {{228, 154, 0}}},
+    {106, 1, {{238, 154, 0}}},
+    {116, 1, {{246, 154, 0}}},
+    {125, 1, {{253, 155, 0}}},
+    {135, 1, {{255, 155, 0}}},
+    {145, 1, {{259, 156, 0}}},
+    {154, 1, {{260, 157, 0}}},
+    {154 + TOUCH_RELEASE_TIMEOUT_MS, 0, {}},
+};
+
+static void test_reader_cadence_pinch() {
+  Replay r = replay(CADENCE_PINCH);
+  TEST_ASSERT_TRUE(r.count >= 3);
+  const Gesture &end = r.gestures[r.count - 1];
+
+  // Only pinch updates, each at least one step past the one before
+  uint16_t last = GESTURE_SCALE_ONE;
+  for (int i = 0; i < r.count - 1; i++) {
+    const Gesture &g = r.gestures[i];
+    TEST_ASSERT_EQUAL(GESTURE_PINCH, g.type);
+    TEST_ASSERT_EQUAL(GESTURE_PHASE_UPDATE, g.phase);
+    TEST_ASSERT_TRUE(g.scaleQ8 >= last + GESTURE_PINCH_STEP_Q8);
+    last = g.scaleQ8;
+  }
+  // Single-finger tail ignored, then the end with the last update's scale
+  TEST_ASSERT_EQUAL(GESTURE_PINCH, end.type);
+  TEST_ASSERT_EQUAL(GESTURE_PHASE_END, end.phase);
+  TEST_ASSERT_EQUAL_UINT16(last, end.scaleQ8);
+  // 46 px apart when the second finger landed, 196 px at the widest:
+  // the final step is within one step of 196 / 46
+  const uint16_t widest = 196 * GESTURE_SCALE_ONE / 46;
+  TEST_ASSERT_TRUE(end.scaleQ8 <= widest);
+  TEST_ASSERT_TRUE(end.scaleQ8 + GESTURE_PINCH_STEP_Q8 > widest);
+  // Centre between the fingers when the pinch started
+  TEST_ASSERT_EQUAL_UINT16(169, end.x);
+  TEST_ASSERT_EQUAL_UINT16(116, end.y);
+}
+
+static void test_reader_cadence_swipe() {
+  Replay r = replay(CADENCE_SWIPE);
+  TEST_ASSERT_EQUAL(1, r.count);
+  TEST_ASSERT_EQUAL(GESTURE_SWIPE, r.gestures[0].type);
+  TEST_ASSERT_EQUAL(GESTURE_DIR_RIGHT, r.gestures[0].dir);
+  TEST_ASSERT_EQUAL_UINT16(69, r.gestures[0].x);
+  TEST_ASSERT_EQUAL_UINT16(149, r.gestures[0].y);
+}
+
+static void test_reader_cadence_is_sorted() {
+  // As the reader queues them: in time order, never more than the release
+  // timeout apart while touched
+  const TouchSample *traces[] = {CADENCE_PINCH, CADENCE_SWIPE};
+  const size_t lengths[] = {sizeof(CADENCE_PINCH) / sizeof(TouchSample),
+                            sizeof(CADENCE_SWIPE) / sizeof(TouchSample)};
+  for (int t = 0; t < 2; t++) {
+    for (size_t i = 1; i < lengths[t]; i++) {
+      uint32_t gap = traces[t][i].timestamp - traces[t][i - 1].timestamp;
+      TEST_ASSERT_TRUE(gap > 0 && gap <= TOUCH_RELEASE_TIMEOUT_MS);
+    }
+    TEST_ASSERT_EQUAL(0, traces[t][lengths[t] - 1].count);
+  }
+}
+
+static void test_isqrt() {
+  using gesture_detail::isqrt;
+  TEST_ASSERT_EQUAL_UINT32(0, isqrt(0));
+  TEST_ASSERT_EQUAL_UINT32(1, isqrt(1));
+  TEST_ASSERT_EQUAL_UINT32(400, isqrt(160000));
+  TEST_ASSERT_EQUAL_UINT32(400, isqrt(160399));
+  TEST_ASSERT_EQUAL_UINT32(0xFFFF, isqrt(0xFFFFFFFF));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_flick_left);
+  RUN_TEST(test_flick_up);
+  RUN_TEST(test_slow_drag_is_no_swipe);
+  RUN_TEST(test_diagonal_is_no_swipe);
+  RUN_TEST(test_tap_is_nothing);
+  RUN_TEST(test_long_press);
+  RUN_TEST(test_long_press_boundary);
+  RUN_TEST(test_moved_hold_is_nothing);
+  RUN_TEST(test_pinch_out);
+  RUN_TEST(test_pinch_in);
+  RUN_TEST(test_reader_cadence_pinch);
+  RUN_TEST(test_reader_cadence_swipe);
+  RUN_TEST(test_reader_cadence_is_sorted);
+  RUN_TEST(test_isqrt);
+  return UNITY_END();
+}
@@ -0,0 +1 @@
+#include "BLE/HidKeymap.cpp"
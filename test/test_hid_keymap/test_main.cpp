@@ -0,0 +1,381 @@
+// Keyboard layouts of BLE/HidKeymap: every usage from 0x04 (a) to 0x65
+// (Application) at every modifier level (plain, Shift, AltGr, Shift+AltGr)
+// of every layout, against the expected outputs below. Usages not listed
+// must produce nothing.
+//
+//   pio test -e native -f test_hid_keymap
+
+#include <unity.h>
+
+#include <lvgl.h>
+
+#include "BLE/HidKeymap.h"
+
+enum Level { PLAIN, SHIFT, ALTGR, SHIFT_ALTGR, LEVELS };
+
+// Modifier bytes selecting each level, with the left and the right Shift
+static const uint8_t LEVEL_MODIFIERS[LEVELS][2] = {
+    {0, HID_MOD_LEFT_CTRL},
+    {HID_MOD_LEFT_SHIFT, HID_MOD_RIGHT_SHIFT},
+    {HID_MOD_RIGHT_ALT, HID_MOD_RIGHT_ALT | HID_MOD_LEFT_GUI},
+    {HID_MOD_LEFT_SHIFT | HID_MOD_RIGHT_ALT,
+     HID_MOD_RIGHT_SHIFT | HID_MOD_RIGHT_ALT},
+};
+
+// Characters typed, as UTF-8
+struct CharRow {
+  uint8_t usage;
+  const char *text[LEVELS];
+};
+
+// Keys that are the same in every layout
+struct KeyRow {
+  uint8_t usage;
+  uint32_t key[LEVELS];
+};
+
+static const KeyRow KEY_ROWS[] = {
+    {0x28, {LV_KEY_ENTER, LV_KEY_ENTER, LV_KEY_ENTER, LV_KEY_ENTER}},
+    {0x29, {LV_KEY_ESC, LV_KEY_ESC, LV_KEY_ESC, LV_KEY_ESC}},
+    {0x2A, {LV_KEY_BACKSPACE, LV_KEY_BACKSPACE, LV_KEY_BACKSPACE,
+            LV_KEY_BACKSPACE}},
+    {0x2B, {LV_KEY_NEXT, LV_KEY_PREV, LV_KEY_NEXT, LV_KEY_PREV}}, // Tab
+    {0x4A, {LV_KEY_HOME, LV_KEY_HOME, LV_KEY_HOME, LV_KEY_HOME}},
+    {0x4C, {LV_KEY_DEL, LV_KEY_DEL, LV_KEY_DEL, LV_KEY_DEL}},
+    {0x4D, {LV_KEY_END, LV_KEY_END, LV_KEY_END, LV_KEY_END}},
+    {0x4F, {LV_KEY_RIGHT, LV_KEY_RIGHT, LV_KEY_RIGHT, LV_KEY_RIGHT}},
+    {0x50, {LV_KEY_LEFT, LV_KEY_LEFT, LV_KEY_LEFT, LV_KEY_LEFT}},
+    {0x51, {LV_KEY_DOWN, LV_KEY_DOWN, LV_KEY_DOWN, LV_KEY_DOWN}},
+    {0x52, {LV_KEY_UP, LV_KEY_UP, LV_KEY_UP, LV_KEY_UP}},
+    {0x58, {LV_KEY_ENTER, LV_KEY_ENTER, LV_KEY_ENTER, LV_KEY_ENTER}},
+};
+
+// The keypad, Num Lock assumed on, in every layout
+static const CharRow KEYPAD_ROWS[] = {
+    {0x54, {"/", "/", "/", "/"}}, {0x55, {"*", "*", "*", "*"}},
+    {0x56, {"-", "-", "-", "-"}}, {0x57, {"+", "+", "+", "+"}},
+    {0x59, {"1", "1", "1", "1"}}, {0x5A, {"2", "2", "2", "2"}},
+    {0x5B, {"3", "3", "3", "3"}}, {0x5C, {"4", "4", "4", "4"}},
+    {0x5D, {"5", "5", "5", "5"}}, {0x5E, {"6", "6", "6", "6"}},
+    {0x5F, {"7", "7", "7", "7"}}, {0x60, {"8", "8", "8", "8"}},
+    {0x61, {"9", "9", "9", "9"}}, {0x62, {"0", "0", "0", "0"}},
+    {0x63, {".", ".", ".", "."}},
+};
+
+static const CharRow US_ROWS[] = {
+    {0x04, {"a", "A", "a", "A"}},
+    {0x05, {"b", "B", "b", "B"}},
+    {0x06, {"c", "C", "c", "C"}},
+    {0x07, {"d", "D", "d", "D"}},
+    {0x08, {"e", "E", "e", "E"}},
+    {0x09, {"f", "F", "f", "F"}},
+    {0x0A, {"g", "G", "g", "G"}},
+    {0x0B, {"h", "H", "h", "H"}},
+    {0x0C, {"i", "I", "i", "I"}},
+    {0x0D, {"j", "J", "j", "J"}},
+    {0x0E, {"k", "K", "k", "K"}},
+    {0x0F, {"l", "L", "l", "L"}},
+    {0x10, {"m", "M", "m", "M"}},
+    {0x11, {"n", "N", "n", "N"}},
+    {0x12, {"o", "O", "o", "O"}},
+    {0x13, {"p", "P", "p", "P"}},
+    {0x14, {"q", "Q", "q", "Q"}},
+    {0x15, {"r", "R", "r", "R"}},
+    {0x16, {"s", "S", "s", "S"}},
+    {0x17, {"t", "T", "t", "T"}},
+    {0x18, {"u", "U", "u", "U"}},
+    {0x19, {"v", "V", "v", "V"}},
+    {0x1A, {"w", "W", "w", "W"}},
+    {0x1B, {"x", "X", "x", "X"}},
+    {0x1C, {"y", "Y", "y", "Y"}},
+    {0x1D, {"z", "Z", "z", "Z"}},
+    {0x1E, {"1", "!", "1", "!"}},
+    {0x1F, {"2", "@", "2", "@"}},
+    {0x20, {"3", "#", "3", "#"}},
+    {0x21, {"4", "$", "4", "$"}},
+    {0x22, {"5", "%", "5", "%"}},
+    {0x23, {"6", "^", "6", "^"}},
+    {0x24, {"7", "&", "7", "&"}},
+    {0x25, {"8", "*", "8", "*"}},
+    {0x26, {"9", "(", "9", "("}},
+    {0x27, {"0", ")", "0", ")"}},
+    {0x2C, {" ", " ", " ", " "}},
+    {0x2D, {"-", "_", "-", "_"}},
+    {0x2E, {"=", "+", "=", "+"}},
+    {0x2F, {"[", "{", "[", "{"}},
+    {0x30, {"]", "}", "]", "}"}},
+    {0x31, {"\\", "|", "\\", "|"}},
+    {0x32, {"\\", "|", "\\", "|"}},
+    {0x33, {";", ":", ";", ":"}},
+    {0x34, {"'", "\"", "'", "\""}},
+    {0x35, {"`", "~", "`", "~"}},
+    {0x36, {",", "<", ",", "<"}},
+    {0x37, {".", ">", ".", ">"}},
+    {0x38, {"/", "?", "/", "?"}},
+    {0x64, {"\\", "|", "\\", "|"}},
+};
+
+static const CharRow UK_ROWS[] = {
+    {0x04, {"a", "A", "a", "A"}},
+    {0x05, {"b", "B", "b", "B"}},
+    {0x06, {"c", "C", "c", "C"}},
+    {0x07, {"d", "D", "d", "D"}},
+    {0x08, {"e", "E", "e", "E"}},
+    {0x09, {"f", "F", "f", "F"}},
+    {0x0A, {"g", "G", "g", "G"}},
+    {0x0B, {"h", "H", "h", "H"}},
+    {0x0C, {"i", "I", "i", "I"}},
+    {0x0D, {"j", "J", "j", "J"}},
+    {0x0E, {"k", "K", "k", "K"}},
+    {0x0F, {"l", "L", "l", "L"}},
+    {0x10, {"m", "M", "m", "M"}},
+    {0x11, {"n", "N", "n", "N"}},
+    {0x12, {"o", "O", "o", "O"}},
+    {0x13, {"p", "P", "p", "P"}},
+    {0x14, {"q", "Q", "q", "Q"}},
+    {0x15, {"r", "R", "r", "R"}},
+    {0x16, {"s", "S", "s", "S"}},
+    {0x17, {"t", "T", "t", "T"}},
+    {0x18, {"u", "U", "u", "U"}},
+    {0x19, {"v", "V", "v", "V"}},
+    {0x1A, {"w", "W", "w", "W"}},
+    {0x1B, {"x", "X", "x", "X"}},
+    {0x1C, {"y", "Y", "y", "Y"}},
+    {0x1D, {"z", "Z", "z", "Z"}},
+    {0x1E, {"1", "!", "1", "!"}},
+    {0x1F, {"2", "\"", "2", "\""}},
+    {0x20, {"3", "£", "3", "£"}},
+    {0x21, {"4", "$", "€", "$"}},
+    {0x22, {"5", "%", "5", "%"}},
+    {0x23, {"6", "^", "6", "^"}},
+    {0x24, {"7", "&", "7", "&"}},
+    {0x25, {"8", "*", "8", "*"}},
+    {0x26, {"9", "(", "9", "("}},
+    {0x27, {"0", ")", "0", ")"}},
+    {0x2C, {" ", " ", " ", " "}},
+    {0x2D, {"-", "_", "-", "_"}},
+    {0x2E, {"=", "+", "=", "+"}},
+    {0x2F, {"[", "{", "[", "{"}},
+    {0x30, {"]", "}", "]", "}"}},
+    {0x31, {"#", "~", "#", "~"}},
+    {0x32, {"#", "~", "#", "~"}},
+    {0x33, {";", ":", ";", ":"}},
+    {0x34, {"'", "@", "'", "@"}},
+    {0x35, {"`", "¬", "¦", "¬"}},
+    {0x36, {",", "<", ",", "<"}},
+    {0x37, {".", ">", ".", ">"}},
+    {0x38, {"/", "?", "/", "?"}},
+    {0x64, {"\\", "|", "\\", "|"}},
+};
+
+static const CharRow DE_ROWS[] = {
+    {0x04, {"a", "A", "a", "A"}},
+    {0x05, {"b", "B", "b", "B"}},
+    {0x06, {"c", "C", "c", "C"}},
+    {0x07, {"d", "D", "d", "D"}},
+    {0x08, {"e", "E", "€", "E"}},
+    {0x09, {"f", "F", "f", "F"}},
+    {0x0A, {"g", "G", "g", "G"}},
+    {0x0B, {"h", "H", "h", "H"}},
+    {0x0C, {"i", "I", "i", "I"}},
+    {0x0D, {"j", "J", "j", "J"}},
+    {0x0E, {"k", "K", "k", "K"}},
+    {0x0F, {"l", "L", "l", "L"}},
+    {0x10, {"m", "M", "µ", "M"}},
+    {0x11, {"n", "N", "n", "N"}},
+    {0x12, {"o", "O", "o", "O"}},
+    {0x13, {"p", "P", "p", "P"}},
+    {0x14, {"q", "Q", "@", "Q"}},
+    {0x15, {"r", "R", "r", "R"}},
+    {0x16, {"s", "S", "s", "S"}},
+    {0x17, {"t", "T", "t", "T"}},
+    {0x18, {"u", "U", "u", "U"}},
+    {0x19, {"v", "V", "v", "V"}},
+    {0x1A, {"w", "W", "w", "W"}},
+    {0x1B, {"x", "X", "x", "X"}},
+    {0x1C, {"z", "Z", "z", "Z"}},
+    {0x1D, {"y", "Y", "y", "Y"}},
+    {0x1E, {"1", "!", "1", "!"}},
+    {0x1F, {"2", "\"", "²", "\""}},
+    {0x20, {"3", "§", "³", "§"}},
+    {0x21, {"4", "$", "4", "$"}},
+    {0x22, {"5", "%", "5", "%"}},
+    {0x23, {"6", "&", "6", "&"}},
+    {0x24, {"7", "/", "{", "/"}},
+    {0x25, {"8", "(", "[", "("}},
+    {0x26, {"9", ")", "]", ")"}},
+    {0x27, {"0", "=", "}", "="}},
+    {0x2C, {" ", " ", " ", " "}},
+    {0x2D, {"ß", "?", "\\", "?"}},
+    {0x2E, {"´", "`", "´", "`"}},
+    {0x2F, {"ü", "Ü", "ü", "Ü"}},
+    {0x30, {"+", "*", "~", "*"}},
+    {0x31, {"#", "'", "#", "'"}},
+    {0x32, {"#", "'", "#", "'"}},
+    {0x33, {"ö", "Ö", "ö", "Ö"}},
+    {0x34, {"ä", "Ä", "ä", "Ä"}},
+    {0x35, {"^", "°", "^", "°"}},
+    {0x36, {",", ";", ",", ";"}},
+    {0x37, {".", ":", ".", ":"}},
+    {0x38, {"-", "_", "-", "_"}},
+    {0x64, {"<", ">", "|", ">"}},
+};
+
+static const CharRow FR_ROWS[] = {
+    {0x04, {"q", "Q", "q", "Q"}},
+    {0x05, {"b", "B", "b", "B"}},
+    {0x06, {"c", "C", "c", "C"}},
+    {0x07, {"d", "D", "d", "D"}},
+    {0x08, {"e", "E", "€", "E"}},
+    {0x09, {"f", "F", "f", "F"}},
+    {0x0A, {"g", "G", "g", "G"}},
+    {0x0B, {"h", "H", "h", "H"}},
+    {0x0C, {"i", "I", "i", "I"}},
+    {0x0D, {"j", "J", "j", "J"}},
+    {0x0E, {"k", "K", "k", "K"}},
+    {0x0F, {"l", "L", "l", "L"}},
+    {0x10, {",", "?", ",", "?"}},
+    {0x11, {"n", "N", "n", "N"}},
+    {0x12, {"o", "O", "o", "O"}},
+    {0x13, {"p", "P", "p", "P"}},
+    {0x14, {"a", "A", "a", "A"}},
+    {0x15, {"r", "R", "r", "R"}},
+    {0x16, {"s", "S", "s", "S"}},
+    {0x17, {"t", "T", "t", "T"}},
+    {0x18, {"u", "U", "u", "U"}},
+    {0x19, {"v", "V", "v", "V"}},
+    {0x1A, {"z", "Z", "z", "Z"}},
+    {0x1B, {"x", "X", "x", "X"}},
+    {0x1C, {"y", "Y", "y", "Y"}},
+    {0x1D, {"w", "W", "w", "W"}},
+    {0x1E, {"&", "1", "&", "1"}},
+    {0x1F, {"é", "2", "~", "2"}},
+    {0x20, {"\"", "3", "#", "3"}},
+    {0x21, {"'", "4", "{", "4"}},
+    {0x22, {"(", "5", "[", "5"}},
+    {0x23, {"-", "6", "|", "6"}},
+    {0x24, {"è", "7", "`", "7"}},
+    {0x25, {"_", "8", "\\", "8"}},
+    {0x26, {"ç", "9", "^", "9"}},
+    {0x27, {"à", "0", "@", "0"}},
+    {0x2C, {" ", " ", " ", " "}},
+    {0x2D, {")", "°", "]", "°"}},
+    {0x2E, {"=", "+", "}", "+"}},
+    {0x2F, {"^", "¨", "^", "¨"}},
+    {0x30, {"$", "£", "¤", "£"}},
+    {0x31, {"*", "µ", "*", "µ"}},
+    {0x32, {"*", "µ", "*", "µ"}},
+    {0x33, {"m", "M", "m", "M"}},
+    {0x34, {"ù", "%", "ù", "%"}},
+    {0x35, {"²", "²", "²", "²"}},
+    {0x36, {";", ".", ";", "."}},
+    {0x37, {":", "/", ":", "/"}},
+    {0x38, {"!", "§", "!", "§"}},
+    {0x64, {"<", ">", "<", ">"}},
+};
+
+struct Layout {
+  KeyboardLayout layout;
+  const CharRow *rows;
+  size_t count;
+};
+
+#define LAYOUT(id, rows) {id, rows, sizeof(rows) / sizeof(rows[0])}
+
+static const Layout LAYOUTS[] = {
+    LAYOUT(LAYOUT_US, US_ROWS),
+    LAYOUT(LAYOUT_UK, UK_ROWS),
+    LAYOUT(LAYOUT_DE, DE_ROWS),
+    LAYOUT(LAYOUT_FR, FR_ROWS),
+};
+
+// UTF-8 packed little-endian, as lv_textarea_add_char() takes it
+static uint32_t packed(const char *text) {
+  uint32_t key = 0;
+  for (int i = 0; text[i]; i++) {
+    TEST_ASSERT_TRUE(i < 4);
+    key |= (uint32_t)(uint8_t)text[i] << (8 * i);
+  }
+  return key;
+}
+
+static const CharRow *findRow(const CharRow *rows, size_t count,
+                              uint8_t usage) {
+  for (size_t i = 0; i < count; i++) {
+    if (rows[i].usage == usage)
+      return &rows[i];
+  }
+  return nullptr;
+}
+
+// What the usage must produce at level in layout (0: nothing)
+static uint32_t expectedKey(const Layout &l, uint8_t usage, int level) {
+  for (const KeyRow &row : KEY_ROWS) {
+    if (row.usage == usage)
+      return row.key[level];
+  }
+  const CharRow *row = findRow(l.rows, l.count, usage);
+  if (!row)
+    row = findRow(KEYPAD_ROWS, sizeof(KEYPAD_ROWS) / sizeof(KEYPAD_ROWS[0]),
+                  usage);
+  return row ? packed(row->text[level]) : 0;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+static void test_every_usage_every_level() {
+  for (const Layout &l : LAYOUTS) {
+    for (uint8_t usage = 0x04; usage <= 0x65; usage++) {
+      for (int level = 0; level < LEVELS; level++) {
+        uint32_t want = expectedKey(l, usage, level);
+        for (uint8_t modifiers : LEVEL_MODIFIERS[level]) {
+          char msg[48];
+          snprintf(msg, sizeof(msg), "%s usage 0x%02X modifiers 0x%02X",
+                   keyboardLayoutName(l.layout), usage, modifiers);
+          TEST_ASSERT_EQUAL_HEX32_MESSAGE(
+              want, hidUsageToKey(l.layout, usage, modifiers), msg);
+        }
+      }
+    }
+  }
+}
+
+// Every usage the tables list is one a layout can produce
+static void test_tables_have_no_stray_rows() {
+  for (const Layout &l : LAYOUTS) {
+    for (size_t i = 0; i < l.count; i++) {
+      TEST_ASSERT_TRUE(l.rows[i].usage >= 0x04 && l.rows[i].usage <= 0x65);
+      TEST_ASSERT_TRUE(i == 0 || l.rows[i - 1].usage < l.rows[i].usage);
+    }
+  }
+}
+
+static void test_out_of_range() {
+  TEST_ASSERT_EQUAL_UINT32(0, hidUsageToKey(LAYOUT_US, 0x00, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, hidUsageToKey(LAYOUT_US, 0x03, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, hidUsageToKey(LAYOUT_US, HID_KEYMAP_SIZE, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, hidUsageToKey(LAYOUT_US, 0xFF, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, hidUsageToKey(LAYOUT_COUNT, 0x04, 0));
+}
+
+static void test_consumer_keys() {
+  TEST_ASSERT_EQUAL_UINT32(LV_KEY_ENTER, hidConsumerToKey(0x0041));
+  TEST_ASSERT_EQUAL_UINT32(LV_KEY_UP, hidConsumerToKey(0x0042));
+  TEST_ASSERT_EQUAL_UINT32(LV_KEY_DOWN, hidConsumerToKey(0x0043));
+  TEST_ASSERT_EQUAL_UINT32(LV_KEY_LEFT, hidConsumerToKey(0x0044));
+  TEST_ASSERT_EQUAL_UINT32(LV_KEY_RIGHT, hidConsumerToKey(0x0045));
+  TEST_ASSERT_EQUAL_UINT32(LV_KEY_ESC, hidConsumerToKey(0x0046));
+  TEST_ASSERT_EQUAL_UINT32(LV_KEY_ESC, hidConsumerToKey(0x0224));
+  TEST_ASSERT_EQUAL_UINT32(0, hidConsumerToKey(0x00E9)); // Volume Up
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_every_usage_every_level);
+  RUN_TEST(test_tables_have_no_stray_rows);
+  RUN_TEST(test_out_of_range);
+  RUN_TEST(test_consumer_keys);
+  return UNITY_END();
+}
@@ -0,0 +1,470 @@
+// HID Report Map parser and report decoder (BLE/HidReportDescriptor.h).
+//
+// Recorded descriptors (boot keyboard, NKRO bitmap keyboard, consumer
+// control, and a composite keyboard whose reports carry an ID prefix) are
+// parsed and their reports decoded against hand-written expectations. Then
+// the same code is fuzzed at run time:
+//   - random reports, truncated at random, are decoded and compared with a
+//     reference decoder written from the descriptors by hand
+//   - every prefix of every descriptor, and thousands of randomly mutated
+//     and truncated descriptors, are parsed and random reports decoded
+//     against the result
+// Descriptors and reports are copied so they end right at an inaccessible
+// page (GuardedBuffer): reading past their end crashes the test.
+//
+//   pio test -e native -f test_hid_report_descriptor
+
+#include <unity.h>
+
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <random>
+#include <vector>
+
+#include "BLE/HidReportDescriptor.h"
+
+// HID 1.11 Appendix B.1, boot keyboard (no report IDs)
+static const uint8_t BOOT_KEYBOARD[] = {
+    0x05, 0x01, 0x09, 0x06, 0xA1, 0x01, 0x05, 0x07, 0x19, 0xE0, 0x29, 0xE7,
+    0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x08, 0x81, 0x02, 0x95, 0x01,
+    0x75, 0x08, 0x81, 0x01, 0x95, 0x05, 0x75, 0x01, 0x05, 0x08, 0x19, 0x01,
+    0x29, 0x05, 0x91, 0x02, 0x95, 0x01, 0x75, 0x03, 0x91, 0x01, 0x95, 0x06,
+    0x75, 0x08, 0x15, 0x00, 0x25, 0x65, 0x05, 0x07, 0x19, 0x00, 0x29, 0x65,
+    0x81, 0x00, 0xC0};
+
+// NKRO keyboard (no report IDs): modifiers, then usages 0x00..0x77 as bits
+static const uint8_t NKRO_KEYBOARD[] = {
+    0x05, 0x01, 0x09, 0x06, 0xA1, 0x01, 0x05, 0x07, 0x19, 0xE0, 0x29, 0xE7,
+    0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x08, 0x81, 0x02, 0x19, 0x00,
+    0x29, 0x77, 0x95, 0x78, 0x81, 0x02, 0x05, 0x08, 0x19, 0x01, 0x29, 0x05,
+    0x95, 0x05, 0x91, 0x02, 0x95, 0x03, 0x91, 0x01, 0xC0};
+
+// Media remote (no report IDs): two 16-bit consumer usages
+static const uint8_t CONSUMER_CONTROL[] = {
+    0x05, 0x0C, 0x09, 0x01, 0xA1, 0x01, 0x15, 0x00, 0x26, 0xFF, 0x03, 0x19,
+    0x00, 0x2A, 0xFF, 0x03, 0x75, 0x10, 0x95, 0x02, 0x81, 0x00, 0xC0};
+
+// Composite BLE keyboard: 6KRO keyboard (ID 1), 16-bit consumer array
+// (ID 2), NKRO bitmap keyboard (ID 3), media keys as bits (ID 4)
+static const uint8_t COMPOSITE[] = {
+    // ID 1: keyboard
+    0x05, 0x01, 0x09, 0x06, 0xA1, 0x01, 0x85, 0x01, 0x05, 0x07, 0x19, 0xE0,
+    0x29, 0xE7, 0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x08, 0x81, 0x02,
+    0x95, 0x01, 0x75, 0x08, 0x81, 0x01, 0x95, 0x06, 0x75, 0x08, 0x15, 0x00,
+    0x25, 0x65, 0x19, 0x00, 0x29, 0x65, 0x81, 0x00, 0xC0,
+    // ID 2: consumer control, one 16-bit usage
+    0x05, 0x0C, 0x09, 0x01, 0xA1, 0x01, 0x85, 0x02, 0x15, 0x00, 0x26, 0xFF,
+    0x03, 0x19, 0x00, 0x2A, 0xFF, 0x03, 0x75, 0x10, 0x95, 0x01, 0x81, 0x00,
+    0xC0,
+    // ID 3: NKRO, modifiers + usages 0x04..0x70 as bits + 3 bits padding
+    0x05, 0x01, 0x09, 0x06, 0xA1, 0x01, 0x85, 0x03, 0x05, 0x07, 0x19, 0xE0,
+    0x29, 0xE7, 0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x08, 0x81, 0x02,
+    0x19, 0x04, 0x29, 0x70, 0x95, 0x6D, 0x81, 0x02, 0x75, 0x03, 0x95, 0x01,
+    0x81, 0x01, 0xC0,
+    // ID 4: Volume Up, Volume Down, Mute, Play/Pause as bits
+    0x05, 0x0C, 0x09, 0x01, 0xA1, 0x01, 0x85, 0x04, 0x15, 0x00, 0x25, 0x01,
+    0x75, 0x01, 0x95, 0x04, 0x09, 0xE9, 0x09, 0xEA, 0x09, 0xE2, 0x09, 0xCD,
+    0x81, 0x02, 0x95, 0x04, 0x81, 0x01, 0xC0};
+
+struct Descriptor {
+  const uint8_t *data;
+  size_t len;
+};
+
+static const Descriptor DESCRIPTORS[] = {
+    {BOOT_KEYBOARD, sizeof(BOOT_KEYBOARD)},
+    {NKRO_KEYBOARD, sizeof(NKRO_KEYBOARD)},
+    {CONSUMER_CONTROL, sizeof(CONSUMER_CONTROL)},
+    {COMPOSITE, sizeof(COMPOSITE)},
+};
+
+static constexpr int ROUNDS = 20000;
+static constexpr size_t MAX_REPORT = 64;
+
+// Memory whose last readable byte is followed by a PROT_NONE page
+class GuardedBuffer {
+public:
+  GuardedBuffer() {
+    m_page = (size_t)sysconf(_SC_PAGESIZE);
+    m_mem = (uint8_t *)mmap(nullptr, 2 * m_page, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    mprotect(m_mem + m_page, m_page, PROT_NONE);
+  }
+  ~GuardedBuffer() { munmap(m_mem, 2 * m_page); }
+
+  // Copy of src ending at the guard page
+  const uint8_t *place(const uint8_t *src, size_t len) {
+    uint8_t *dst = m_mem + m_page - len;
+    memcpy(dst, src, len);
+    return dst;
+  }
+
+private:
+  uint8_t *m_mem;
+  size_t m_page;
+};
+
+static GuardedBuffer s_descBuf;
+static GuardedBuffer s_reportBuf;
+static std::mt19937 s_rng(0x2A4B);
+
+static HidReportMap parse(const uint8_t *desc, size_t len, bool *ok = nullptr) {
+  HidReportMap map;
+  bool parsed = hidParseReportMap(s_descBuf.place(desc, len), len, map);
+  if (ok)
+    *ok = parsed;
+  return map;
+}
+
+static HidReportMap parse(const Descriptor &d) { return parse(d.data, d.len); }
+
+static bool decode(const HidReportMap &map, int id, const uint8_t *data,
+                   size_t len, HidInputState &out) {
+  return hidDecodeReport(map, id, s_reportBuf.place(data, len), len, out);
+}
+
+static HidInputState decode(const HidReportMap &map, int id,
+                            const uint8_t *data, size_t len) {
+  HidInputState out;
+  decode(map, id, data, len, out);
+  return out;
+}
+
+// Random report bytes, half of them zero so bitmaps stay sparse
+static void randomReport(uint8_t *data, size_t len) {
+  for (size_t i = 0; i < len; i++)
+    data[i] = s_rng() & 1 ? 0 : (uint8_t)s_rng();
+}
+
+// --- Recorded descriptors -------------------------------------------------
+
+static void test_recorded_maps_parse() {
+  bool ok = false;
+  HidReportMap boot = parse(BOOT_KEYBOARD, sizeof(BOOT_KEYBOARD), &ok);
+  TEST_ASSERT_TRUE(ok);
+  TEST_ASSERT_EQUAL(1, boot.count);
+  TEST_ASSERT_FALSE(boot.usesReportIds);
+  const HidReportFormat &b = boot.reports[0];
+  const HidReportFormat &builtIn = hidBootKeyboardMap().reports[0];
+  TEST_ASSERT_EQUAL(builtIn.length, b.length);
+  TEST_ASSERT_EQUAL(builtIn.modifierBit, b.modifierBit);
+  TEST_ASSERT_EQUAL(builtIn.keyArrayBit, b.keyArrayBit);
+  TEST_ASSERT_EQUAL(builtIn.keyArrayCount, b.keyArrayCount);
+  TEST_ASSERT_EQUAL(builtIn.keyArraySize, b.keyArraySize);
+  TEST_ASSERT_EQUAL(builtIn.keyArrayFirst, b.keyArrayFirst);
+
+  HidReportMap nkro = parse(NKRO_KEYBOARD, sizeof(NKRO_KEYBOARD), &ok);
+  TEST_ASSERT_TRUE(ok);
+  TEST_ASSERT_EQUAL(1, nkro.count);
+  TEST_ASSERT_EQUAL(0, nkro.reports[0].modifierBit);
+  TEST_ASSERT_EQUAL(8, nkro.reports[0].keyBitmapBit);
+  TEST_ASSERT_EQUAL(0x00, nkro.reports[0].keyBitmapFirst);
+  TEST_ASSERT_EQUAL(0x78, nkro.reports[0].keyBitmapCount);
+  TEST_ASSERT_EQUAL(16, nkro.reports[0].length);
+
+  HidReportMap consumer = parse(CONSUMER_CONTROL, sizeof(CONSUMER_CONTROL), &ok);
+  TEST_ASSERT_TRUE(ok);
+  TEST_ASSERT_EQUAL(1, consumer.count);
+  TEST_ASSERT_EQUAL(2, consumer.reports[0].consumerArrayCount);
+  TEST_ASSERT_EQUAL(16, consumer.reports[0].consumerArraySize);
+  TEST_ASSERT_EQUAL(4, consumer.reports[0].length);
+
+  HidReportMap composite = parse(COMPOSITE, sizeof(COMPOSITE), &ok);
+  TEST_ASSERT_TRUE(ok);
+  TEST_ASSERT_EQUAL(4, composite.count);
+  TEST_ASSERT_TRUE(composite.usesReportIds);
+  TEST_ASSERT_EQUAL(1, composite.reports[0].reportId);
+  TEST_ASSERT_EQUAL(8, composite.reports[0].length);
+  TEST_ASSERT_EQUAL(1, composite.reports[1].consumerArrayCount);
+  TEST_ASSERT_EQUAL(16, composite.reports[1].consumerArraySize);
+  TEST_ASSERT_EQUAL(2, composite.reports[1].length);
+  TEST_ASSERT_EQUAL(0, composite.reports[2].modifierBit);
+  TEST_ASSERT_EQUAL(8, composite.reports[2].keyBitmapBit);
+  TEST_ASSERT_EQUAL(0x04, composite.reports[2].keyBitmapFirst);
+  TEST_ASSERT_EQUAL(0x6D, composite.reports[2].keyBitmapCount);
+  TEST_ASSERT_EQUAL(15, composite.reports[2].length);
+  TEST_ASSERT_EQUAL(4, composite.reports[3].consumerBitmapCount);
+  TEST_ASSERT_EQUAL(0xE2, composite.reports[3].consumerBitmapUsages[2]);
+  TEST_ASSERT_EQUAL(1, composite.reports[3].length);
+}
+
+static void test_recorded_reports_decode() {
+  HidReportMap boot = parse(DESCRIPTORS[0]);
+  HidReportMap nkro = parse(DESCRIPTORS[1]);
+  HidReportMap consumer = parse(DESCRIPTORS[2]);
+  HidReportMap composite = parse(DESCRIPTORS[3]);
+
+  // Shift + a + b
+  const uint8_t keysAB[] = {0x02, 0x00, 0x04, 0x05, 0, 0, 0, 0};
+  HidInputState s = decode(boot, -1, keysAB, sizeof(keysAB));
+  TEST_ASSERT_EQUAL(0x02, s.modifiers);
+  TEST_ASSERT_EQUAL(2, s.count);
+  TEST_ASSERT_EQUAL(0x04, s.codes[0]);
+  TEST_ASSERT_EQUAL(0x05, s.codes[1]);
+
+  // Same report with the ID prefix, and with the ID from the Report Reference
+  const uint8_t keysABPrefixed[] = {0x01, 0x02, 0x00, 0x04, 0x05, 0, 0, 0, 0};
+  TEST_ASSERT_EQUAL(2, decode(composite, -1, keysABPrefixed,
+                              sizeof(keysABPrefixed)).count);
+  TEST_ASSERT_EQUAL(2, decode(composite, 1, keysAB, sizeof(keysAB)).count);
+  // Unknown IDs are not decoded
+  HidInputState out;
+  TEST_ASSERT_FALSE(decode(composite, 5, keysAB, sizeof(keysAB), out));
+  TEST_ASSERT_FALSE(decode(composite, -1, keysAB, 0, out));
+
+  const uint8_t rollover[] = {0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01};
+  TEST_ASSERT_TRUE(decode(boot, -1, rollover, sizeof(rollover)).rollover);
+
+  // NKRO: Ctrl + 'a' (usage 0x04, bit 8) + 'z' (0x1D, bit 33) + '0' (0x27, bit 43)
+  const uint8_t nkroKeys[15] = {0x01, 0x01, 0x00, 0x00, 0x02, 0x08};
+  s = decode(composite, 3, nkroKeys, sizeof(nkroKeys));
+  TEST_ASSERT_EQUAL(0x01, s.modifiers);
+  TEST_ASSERT_EQUAL(3, s.count);
+  TEST_ASSERT_EQUAL(0x04, s.codes[0]);
+  TEST_ASSERT_EQUAL(0x1D, s.codes[1]);
+  TEST_ASSERT_EQUAL(0x27, s.codes[2]);
+
+  // Same keys on the bitmap starting at usage 0
+  const uint8_t nkroFromZero[16] = {0x01, 0x10, 0x00, 0x00, 0x20, 0x80};
+  s = decode(nkro, -1, nkroFromZero, sizeof(nkroFromZero));
+  TEST_ASSERT_EQUAL(3, s.count);
+  TEST_ASSERT_EQUAL(0x04, s.codes[0]);
+  TEST_ASSERT_EQUAL(0x1D, s.codes[1]);
+  TEST_ASSERT_EQUAL(0x27, s.codes[2]);
+
+  const uint8_t volumeUp[] = {0xE9, 0x00};
+  s = decode(composite, 2, volumeUp, sizeof(volumeUp));
+  TEST_ASSERT_EQUAL(1, s.count);
+  TEST_ASSERT_EQUAL(HID_CONSUMER_FLAG | 0xE9, s.codes[0]);
+  const uint8_t muteBit[] = {0x04};
+  TEST_ASSERT_EQUAL(HID_CONSUMER_FLAG | 0xE2,
+                    decode(composite, 4, muteBit, sizeof(muteBit)).codes[0]);
+  const uint8_t playAndMute[] = {0xCD, 0x00, 0xE2, 0x00};
+  s = decode(consumer, -1, playAndMute, sizeof(playAndMute));
+  TEST_ASSERT_EQUAL(2, s.count);
+  TEST_ASSERT_EQUAL(HID_CONSUMER_FLAG | 0xCD, s.codes[0]);
+  TEST_ASSERT_EQUAL(HID_CONSUMER_FLAG | 0xE2, s.codes[1]);
+
+  // A report shorter than its format decodes only the fields it contains
+  s = decode(boot, -1, keysAB, 1);
+  TEST_ASSERT_TRUE(s.hasModifiers);
+  TEST_ASSERT_EQUAL(0, s.count);
+}
+
+// --- Random reports against a reference decoder ---------------------------
+
+struct Expected {
+  bool rollover;
+  bool hasModifiers;
+  uint8_t modifiers;
+  std::vector<uint16_t> codes;
+};
+
+static bool bitAt(const uint8_t *d, size_t i) { return (d[i / 8] >> (i % 8)) & 1; }
+
+static void addCode(Expected &e, uint16_t code) {
+  if (e.codes.size() < HID_MAX_KEYS_DOWN)
+    e.codes.push_back(code);
+}
+
+// Modifier byte, reserved byte, six key bytes (boot keyboard, composite ID 1)
+static Expected bootReference(const uint8_t *d, size_t len) {
+  Expected e{};
+  if (len >= 1) {
+    e.hasModifiers = true;
+    e.modifiers = d[0];
+  }
+  if (len < 8)
+    return e;
+  for (size_t i = 2; i < 8; i++) {
+    if (d[i] == HID_USAGE_ERROR_ROLLOVER) {
+      e.rollover = true;
+      return e;
+    }
+    if (d[i] >= HID_USAGE_LEFT_CTRL && d[i] <= HID_USAGE_RIGHT_GUI)
+      e.modifiers |= 1 << (d[i] - HID_USAGE_LEFT_CTRL);
+    else if (d[i] >= HID_USAGE_FIRST_KEY && d[i] < HID_USAGE_LEFT_CTRL)
+      addCode(e, d[i]);
+  }
+  return e;
+}
+
+// Modifier byte, then count bits for usages first, first + 1, ...
+static Expected bitmapReference(const uint8_t *d, size_t len, uint8_t first,
+                                uint8_t count) {
+  Expected e{};
+  if (len >= 1) {
+    e.hasModifiers = true;
+    e.modifiers = d[0];
+  }
+  if (len * 8 < 8u + count)
+    return e;
+  for (uint16_t j = 0; j < count; j++) {
+    if (bitAt(d, 8 + j) && first + j >= HID_USAGE_FIRST_KEY)
+      addCode(e, first + j);
+  }
+  return e;
+}
+
+// count 16-bit consumer usages, 0 meaning none
+static Expected consumerArrayReference(const uint8_t *d, size_t len,
+                                       uint8_t count) {
+  Expected e{};
+  if (len < 2u * count)
+    return e;
+  for (uint8_t j = 0; j < count; j++) {
+    uint16_t usage = d[2 * j] | d[2 * j + 1] << 8;
+    if (usage && usage < HID_CONSUMER_FLAG)
+      addCode(e, HID_CONSUMER_FLAG | usage);
+  }
+  return e;
+}
+
+// Composite ID 4: Volume Up, Volume Down, Mute, Play/Pause
+static Expected mediaBitsReference(const uint8_t *d, size_t len) {
+  static const uint16_t usages[] = {0xE9, 0xEA, 0xE2, 0xCD};
+  Expected e{};
+  if (len < 1)
+    return e;
+  for (int j = 0; j < 4; j++) {
+    if (bitAt(d, j))
+      addCode(e, HID_CONSUMER_FLAG | usages[j]);
+  }
+  return e;
+}
+
+static void assertMatches(const Expected &e, const HidInputState &s) {
+  TEST_ASSERT_EQUAL(e.rollover, s.rollover);
+  if (e.rollover)
+    return;
+  TEST_ASSERT_EQUAL(e.hasModifiers, s.hasModifiers);
+  TEST_ASSERT_EQUAL(e.modifiers, s.modifiers);
+  TEST_ASSERT_EQUAL(e.codes.size(), s.count);
+  for (size_t i = 0; i < e.codes.size() && i < s.count; i++)
+    TEST_ASSERT_EQUAL(e.codes[i], s.codes[i]);
+}
+
+static void test_random_reports_match_reference() {
+  HidReportMap boot = parse(DESCRIPTORS[0]);
+  HidReportMap nkro = parse(DESCRIPTORS[1]);
+  HidReportMap consumer = parse(DESCRIPTORS[2]);
+  HidReportMap composite = parse(DESCRIPTORS[3]);
+
+  uint8_t report[MAX_REPORT + 1];
+  for (int r = 0; r < ROUNDS; r++) {
+    // Up to a couple of bytes longer than the format, or truncated
+    size_t len = s_rng() % 19;
+    randomReport(report, len);
+    HidInputState s;
+
+    TEST_ASSERT_TRUE(decode(boot, -1, report, len, s));
+    assertMatches(bootReference(report, len), s);
+    TEST_ASSERT_TRUE(decode(nkro, -1, report, len, s));
+    assertMatches(bitmapReference(report, len, 0x00, 0x78), s);
+    TEST_ASSERT_TRUE(decode(consumer, -1, report, len, s));
+    assertMatches(consumerArrayReference(report, len, 2), s);
+
+    // Composite, report ID from the Report Reference
+    TEST_ASSERT_TRUE(decode(composite, 1, report, len, s));
+    assertMatches(bootReference(report, len), s);
+    TEST_ASSERT_TRUE(decode(composite, 2, report, len, s));
+    assertMatches(consumerArrayReference(report, len, 1), s);
+    TEST_ASSERT_TRUE(decode(composite, 3, report, len, s));
+    assertMatches(bitmapReference(report, len, 0x04, 0x6D), s);
+    TEST_ASSERT_TRUE(decode(composite, 4, report, len, s));
+    assertMatches(mediaBitsReference(report, len), s);
+
+    // Composite, report ID as the first byte
+    uint8_t prefixed[MAX_REPORT + 2];
+    prefixed[0] = 1 + s_rng() % 4;
+    memcpy(prefixed + 1, report, len);
+    TEST_ASSERT_TRUE(decode(composite, -1, prefixed, len + 1, s));
+    TEST_ASSERT_EQUAL(prefixed[0] - 1, s.reportIndex);
+    Expected e = prefixed[0] == 1   ? bootReference(report, len)
+                 : prefixed[0] == 2 ? consumerArrayReference(report, len, 1)
+                 : prefixed[0] == 3 ? bitmapReference(report, len, 0x04, 0x6D)
+                                    : mediaBitsReference(report, len);
+    assertMatches(e, s);
+  }
+}
+
+// --- Malformed descriptors --------------------------------------------------
+
+static void assertSaneMap(const HidReportMap &map) {
+  TEST_ASSERT_TRUE(map.count <= HID_MAX_REPORTS);
+  for (int i = 0; i < map.count; i++) {
+    const HidReportFormat &f = map.reports[i];
+    TEST_ASSERT_TRUE(f.keyBitmapFirst + f.keyBitmapCount <= 0x100);
+    TEST_ASSERT_TRUE(f.consumerBitmapCount <= HID_MAX_CONSUMER_BITS);
+    TEST_ASSERT_TRUE(f.keyArraySize <= 16 && f.consumerArraySize <= 16);
+  }
+}
+
+// Decoded codes are keys or flagged consumer usages, never more than fit
+static void assertSaneState(const HidReportMap &map, const HidInputState &s) {
+  TEST_ASSERT_TRUE(s.count <= HID_MAX_KEYS_DOWN);
+  TEST_ASSERT_TRUE(s.reportIndex < map.count);
+  for (uint8_t i = 0; i < s.count; i++) {
+    uint16_t code = s.codes[i];
+    if (code & HID_CONSUMER_FLAG)
+      TEST_ASSERT_TRUE((code & ~HID_CONSUMER_FLAG) != 0);
+    else
+      TEST_ASSERT_TRUE(code >= HID_USAGE_FIRST_KEY && code < HID_USAGE_LEFT_CTRL);
+  }
+}
+
+// Random reports of every length under every report ID (and none)
+static void decodeRandomReports(const HidReportMap &map, int reports) {
+  uint8_t report[MAX_REPORT];
+  for (int r = 0; r < reports; r++) {
+    size_t len = s_rng() % (MAX_REPORT + 1);
+    randomReport(report, len);
+    for (int id = -1; id <= 5; id++) {
+      HidInputState s;
+      if (decode(map, id, report, len, s))
+        assertSaneState(map, s);
+    }
+  }
+}
+
+static void test_truncated_descriptors() {
+  for (const Descriptor &d : DESCRIPTORS) {
+    for (size_t len = 0; len <= d.len; len++) {
+      HidReportMap map = parse(d.data, len);
+      assertSaneMap(map);
+      decodeRandomReports(map, 20);
+    }
+  }
+}
+
+static void test_mutated_descriptors() {
+  uint8_t desc[sizeof(COMPOSITE)];
+  for (int r = 0; r < ROUNDS; r++) {
+    const Descriptor &d = DESCRIPTORS[s_rng() % 4];
+    memcpy(desc, d.data, d.len);
+    int mutations = 1 + s_rng() % 4;
+    for (int m = 0; m < mutations; m++)
+      desc[s_rng() % d.len] = (uint8_t)s_rng();
+    // A third of them also cut short
+    size_t len = s_rng() % 3 ? d.len : s_rng() % (d.len + 1);
+
+    HidReportMap map = parse(desc, len);
+    assertSaneMap(map);
+    decodeRandomReports(map, 4);
+  }
+}
+
+void setUp() {}
+void tearDown() {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_recorded_maps_parse);
+  RUN_TEST(test_recorded_reports_decode);
+  RUN_TEST(test_random_reports_match_reference);
+  RUN_TEST(test_truncated_descriptors);
+  RUN_TEST(test_mutated_descriptors);
+  return UNITY_END();
+}
@@ -0,0 +1,7 @@
+// The decoder and the flush path it is drawn through: test_build_src is off
+// for [env:native]
+#include "Display/BandedFlush.cpp"
+#include "Display/FlushTransport.cpp"
+#include "Display/FramebufferTransport.cpp"
+#include "Display/RleImage.cpp"
+#include "Display/SimulatedFlushTransport.cpp"
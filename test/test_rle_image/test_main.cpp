@@ -0,0 +1,385 @@
+// Display/RleImage: run-length encoded images decoded line by line.
+//
+// Images are encoded as tools/rle_images.py does it, with runs and literal
+// stretches longer than one token and token edges at a different column on
+// every line. rleDecodeLine() must return every window of a line, and
+// reject ranges outside the image and truncated streams. Through the LVGL
+// decoder the lines at the edges of every draw buffer band must read the
+// same in any order, and an image drawn through the banded flush
+// (Display/BandedFlush.h) must arrive in the framebuffer unchanged on both
+// sides of every band edge.
+//
+//   pio test -e native -f test_rle_image
+
+#include <unity.h>
+
+#include <lvgl.h>
+
+#include <string.h>
+
+#include <vector>
+
+#include "Display/BandedFlush.h"
+#include "Display/FramebufferTransport.h"
+#include "Display/RleImage.h"
+
+static constexpr uint16_t WIDTH = 320;
+static constexpr uint16_t HEIGHT = 240;
+static constexpr uint16_t ROWS = 40; // per band
+static constexpr uint16_t IMG_H = 100;
+static constexpr uint16_t IMG_Y = 20; // band edges at image lines 19|20, 59|60
+static constexpr uint8_t MAX_RUN = 128;
+
+struct Image {
+  uint16_t width;
+  uint16_t height;
+  uint8_t bpp;
+  std::vector<uint8_t> pixels; // as decoded
+  std::vector<uint8_t> stream;
+};
+
+// Segment lengths of a line, alternating run and literal; each line starts
+// further into the list so token edges move from line to line
+static const uint16_t SEGMENTS[] = {200, 150, 1,   2,   129, 1,
+                                    3,   128, 130, 1,   1,   7};
+static const size_t SEGMENT_COUNT = sizeof(SEGMENTS) / sizeof(SEGMENTS[0]);
+
+static uint32_t mix(uint32_t v) {
+  v ^= v >> 16;
+  v *= 0x7feb352d;
+  v ^= v >> 15;
+  return v;
+}
+
+// Host-order RGB565 stored big-endian, as lv_color_t with LV_COLOR_16_SWAP;
+// the alpha byte, if any, after it
+static void putPixel(uint8_t *p, uint8_t bpp, uint32_t value) {
+  p[0] = (uint8_t)(value >> 8);
+  p[1] = (uint8_t)value;
+  if (bpp == 3)
+    p[2] = (uint8_t)(value >> 16);
+}
+
+static void fillLine(uint16_t y, uint16_t width, uint8_t bpp, uint8_t *out) {
+  size_t seg = y % SEGMENT_COUNT;
+  uint16_t x = 0;
+  uint16_t left = SEGMENTS[seg] - (y * 7) % SEGMENTS[seg];
+  while (x < width) {
+    bool run = seg % 2 == 0;
+    for (; left > 0 && x < width; left--, x++) {
+      uint32_t value = run ? mix(seg * 977 + y) : mix(x * 65537 + y);
+      putPixel(out + x * bpp, bpp, value);
+    }
+    seg = (seg + 1) % SEGMENT_COUNT;
+    left = SEGMENTS[seg];
+  }
+}
+
+// As encode_line() in tools/rle_images.py
+static void encodeLine(const uint8_t *line, uint16_t width, uint8_t bpp,
+                       std::vector<uint8_t> &out) {
+  std::vector<const uint8_t *> literal;
+  auto flushLiteral = [&]() {
+    for (size_t i = 0; i < literal.size(); i += MAX_RUN) {
+      size_t n = literal.size() - i < MAX_RUN ? literal.size() - i : MAX_RUN;
+      out.push_back((uint8_t)(n - 1));
+      for (size_t k = 0; k < n; k++)
+        out.insert(out.end(), literal[i + k], literal[i + k] + bpp);
+    }
+    literal.clear();
+  };
+  auto same = [&](uint16_t a, uint16_t b) {
+    return !memcmp(line + a * bpp, line + b * bpp, bpp);
+  };
+
+  uint16_t i = 0;
+  while (i < width) {
+    uint16_t run = 1;
+    while (i + run < width && run < MAX_RUN && same(i + run, i))
+      run++;
+    if (run >= 2) {
+      flushLiteral();
+      out.push_back((uint8_t)(0x80 | (run - 1)));
+      out.insert(out.end(), line + i * bpp, line + i * bpp + bpp);
+    } else {
+      literal.push_back(line + i * bpp);
+    }
+    i += run;
+  }
+  flushLiteral();
+}
+
+static Image makeImage(uint16_t width, uint16_t height, uint8_t bpp) {
+  Image img = {width, height, bpp, {}, {}};
+  img.pixels.resize((size_t)width * height * bpp);
+  for (uint16_t y = 0; y < height; y++)
+    fillLine(y, width, bpp, &img.pixels[(size_t)y * width * bpp]);
+
+  std::vector<uint8_t> &s = img.stream;
+  const uint8_t header[RLE_HEADER_SIZE] = {
+      'R', 'L', 'E', '1', (uint8_t)width, (uint8_t)(width >> 8),
+      (uint8_t)height, (uint8_t)(height >> 8), bpp, 0, 0, 0};
+  s.assign(header, header + RLE_HEADER_SIZE);
+  s.resize(RLE_HEADER_SIZE + (size_t)height * 4);
+  for (uint16_t y = 0; y < height; y++) {
+    uint32_t offset = s.size();
+    for (int b = 0; b < 4; b++)
+      s[RLE_HEADER_SIZE + y * 4 + b] = (uint8_t)(offset >> (8 * b));
+    encodeLine(&img.pixels[(size_t)y * width * bpp], width, bpp, s);
+  }
+  return img;
+}
+
+static const uint8_t *expected(const Image &img, uint16_t x, uint16_t y) {
+  return &img.pixels[((size_t)y * img.width + x) * img.bpp];
+}
+
+static bool decodes(const Image &img, uint16_t y, uint16_t x, uint16_t len,
+                    size_t size) {
+  RleInfo info = {img.width, img.height, img.bpp};
+  std::vector<uint8_t> out((size_t)len * img.bpp + 1, 0xEE);
+  if (!rleDecodeLine(img.stream.data(), size, info, y, x, len, out.data()))
+    return false;
+  // Nothing written past the window
+  TEST_ASSERT_EQUAL_UINT8(0xEE, out[(size_t)len * img.bpp]);
+  return !memcmp(out.data(), expected(img, x, y), (size_t)len * img.bpp);
+}
+
+static bool decodes(const Image &img, uint16_t y, uint16_t x, uint16_t len) {
+  return decodes(img, y, x, len, img.stream.size());
+}
+
+static Image s_opaque;
+static Image s_alpha;
+
+// ============================================================================
+// LINE DECODER
+// ============================================================================
+
+static void test_full_tokens_encoded() {
+  RleInfo info = {};
+  TEST_ASSERT_TRUE(
+      rleParse(s_opaque.stream.data(), s_opaque.stream.size(), info));
+  TEST_ASSERT_EQUAL_UINT32(WIDTH, info.width);
+  TEST_ASSERT_EQUAL_UINT32(IMG_H, info.height);
+  TEST_ASSERT_EQUAL_UINT32(2, info.bpp);
+
+  // Runs and literal stretches longer than MAX_RUN were split, so full-size
+  // tokens of both kinds sit next to the rest of their stretch
+  uint32_t fullRuns = 0, fullLiterals = 0;
+  for (const Image *img : {&s_opaque, &s_alpha}) {
+    const std::vector<uint8_t> &s = img->stream;
+    size_t pos = RLE_HEADER_SIZE + 4u * img->height;
+    while (pos < s.size()) {
+      uint8_t ctrl = s[pos++];
+      fullRuns += ctrl == 0xFF;
+      fullLiterals += ctrl == 0x7F;
+      pos += (ctrl & 0x80 ? 1 : (ctrl & 0x7F) + 1u) * img->bpp;
+    }
+    TEST_ASSERT_EQUAL_UINT32(s.size(), pos);
+  }
+  TEST_ASSERT_TRUE(fullRuns > 0);
+  TEST_ASSERT_TRUE(fullLiterals > 0);
+}
+
+static void test_every_line_whole() {
+  for (const Image *img : {&s_opaque, &s_alpha}) {
+    for (uint16_t y = 0; y < img->height; y++)
+      TEST_ASSERT_TRUE(decodes(*img, y, 0, img->width));
+  }
+}
+
+static void test_every_window() {
+  // Every start and length, on lines whose tokens start at different columns
+  static const uint16_t LINES[] = {0, 1, 5, IMG_H - 1};
+  for (const Image *img : {&s_opaque, &s_alpha}) {
+    for (uint16_t y : LINES) {
+      for (uint16_t x = 0; x < img->width; x++) {
+        for (uint16_t len = 1; x + len <= img->width; len++) {
+          if (!decodes(*img, y, x, len))
+            TEST_FAIL_MESSAGE("window differs");
+        }
+      }
+    }
+  }
+}
+
+static void test_outside_image_rejected() {
+  TEST_ASSERT_FALSE(decodes(s_opaque, IMG_H, 0, 1));
+  TEST_ASSERT_FALSE(decodes(s_opaque, 0, WIDTH - 1, 2));
+  TEST_ASSERT_FALSE(decodes(s_opaque, 0, WIDTH, 1));
+  TEST_ASSERT_FALSE(decodes(s_alpha, IMG_H - 1, 1, WIDTH));
+}
+
+static void test_truncated_stream_rejected() {
+  // The last line loses its last byte: its start still decodes, not its end
+  const Image &img = s_opaque;
+  size_t cut = img.stream.size() - 1;
+  TEST_ASSERT_TRUE(decodes(img, IMG_H - 1, 0, 1, cut));
+  TEST_ASSERT_FALSE(decodes(img, IMG_H - 1, 0, WIDTH, cut));
+
+  // Cut at the start of the last line's last token: whole tokens only
+  size_t pos = rleRead32(&img.stream[RLE_HEADER_SIZE + 4 * (IMG_H - 1)]);
+  size_t lastToken = pos;
+  uint16_t lastX = 0;
+  for (uint16_t px = 0; px < WIDTH;) {
+    lastToken = pos;
+    lastX = px;
+    uint8_t ctrl = img.stream[pos++];
+    uint16_t count = (ctrl & 0x7F) + 1;
+    pos += (ctrl & 0x80 ? 1 : count) * img.bpp;
+    px += count;
+  }
+  TEST_ASSERT_TRUE(lastX > 0);
+  TEST_ASSERT_TRUE(decodes(img, IMG_H - 1, 0, lastX, lastToken));
+  TEST_ASSERT_FALSE(decodes(img, IMG_H - 1, 0, WIDTH, lastToken));
+
+  RleInfo info = {};
+  TEST_ASSERT_FALSE(
+      rleParse(img.stream.data(), RLE_HEADER_SIZE + 4u * IMG_H - 1, info));
+  std::vector<uint8_t> bad = img.stream;
+  bad[8] = 4; // bytes per pixel
+  TEST_ASSERT_FALSE(rleParse(bad.data(), bad.size(), info));
+  // Line 0 starting right at the end is an empty line, past it is not
+  for (uint32_t offset : {(uint32_t)bad.size(), (uint32_t)bad.size() + 1}) {
+    bad = img.stream;
+    for (int b = 0; b < 4; b++)
+      bad[RLE_HEADER_SIZE + b] = (uint8_t)(offset >> (8 * b));
+    TEST_ASSERT_EQUAL(offset == bad.size(),
+                      rleParse(bad.data(), bad.size(), info));
+  }
+}
+
+// ============================================================================
+// LVGL DECODER
+// ============================================================================
+
+static lv_img_dsc_t lvglImage(const Image &img) {
+  lv_img_dsc_t dsc = {};
+  dsc.header.cf = LV_IMG_CF_USER_ENCODED_0;
+  dsc.header.w = img.width;
+  dsc.header.h = img.height;
+  dsc.data_size = img.stream.size();
+  dsc.data = img.stream.data();
+  return dsc;
+}
+
+// Read the image lines at the edges of every band, last band first, in
+// windows as a clipped draw asks for them
+static void readBandEdges(const Image &img) {
+  lv_img_dsc_t src = lvglImage(img);
+  lv_img_decoder_dsc_t dsc;
+  TEST_ASSERT_EQUAL(LV_RES_OK,
+                    lv_img_decoder_open(&dsc, &src, lv_color_black(), 0));
+  TEST_ASSERT_EQUAL_UINT32(img.width, dsc.header.w);
+  TEST_ASSERT_EQUAL_UINT32(img.height, dsc.header.h);
+  TEST_ASSERT_EQUAL_UINT32(img.bpp == 3 ? LV_IMG_CF_TRUE_COLOR_ALPHA
+                                        : LV_IMG_CF_TRUE_COLOR,
+                           dsc.header.cf);
+
+  static const struct {
+    uint16_t x, len;
+  } WINDOWS[] = {{0, WIDTH}, {0, 1}, {199, 2}, {160, 160}, {WIDTH - 1, 1}};
+  std::vector<uint8_t> buf((size_t)WIDTH * img.bpp);
+  for (int band = (IMG_Y + IMG_H - 1) / ROWS; band >= 0; band--) {
+    int first = band * ROWS - IMG_Y;
+    int last = first + ROWS - 1;
+    for (int y : {last, last + 1, first - 1, first}) {
+      if (y < 0 || y >= img.height)
+        continue;
+      for (const auto &w : WINDOWS) {
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(
+                                         &dsc, w.x, y, w.len, buf.data()));
+        TEST_ASSERT_EQUAL_MEMORY(expected(img, w.x, y), buf.data(),
+                                 (size_t)w.len * img.bpp);
+      }
+    }
+  }
+
+  TEST_ASSERT_EQUAL(LV_RES_INV,
+                    lv_img_decoder_read_line(&dsc, 0, img.height, 1,
+                                             buf.data()));
+  TEST_ASSERT_EQUAL(LV_RES_INV,
+                    lv_img_decoder_read_line(&dsc, 1, 0, WIDTH, buf.data()));
+  lv_img_decoder_close(&dsc);
+}
+
+static void test_read_line_at_band_edges() {
+  readBandEdges(s_opaque);
+  readBandEdges(s_alpha);
+}
+
+// ============================================================================
+// DRAWN THROUGH THE BANDED FLUSH
+// ============================================================================
+
+static lv_color_t s_mem[2][WIDTH * ROWS];
+static lv_color_t *s_bufs[2] = {s_mem[0], s_mem[1]};
+static lv_disp_draw_buf_t s_drawBuf;
+static lv_disp_drv_t s_drv;
+static FramebufferTransport *s_fb = nullptr;
+
+// As LvglPort's wait_cb
+static void waitCb(lv_disp_drv_t *) { s_fb->poll(true); }
+
+static void setUpDisplay() {
+  lv_init();
+  s_fb = new FramebufferTransport(WIDTH, HEIGHT);
+  lv_disp_draw_buf_init(&s_drawBuf, s_bufs[0], s_bufs[1], WIDTH * ROWS);
+  lv_disp_drv_init(&s_drv);
+  s_drv.hor_res = WIDTH;
+  s_drv.ver_res = HEIGHT;
+  s_drv.draw_buf = &s_drawBuf;
+  s_drv.wait_cb = waitCb;
+  bandedFlushInit(&s_drv, *s_fb, s_bufs, 2);
+  lv_disp_drv_register(&s_drv);
+  rleImageInit();
+}
+
+static void test_drawn_across_bands() {
+  // Opaque, so LVGL copies the decoded lines instead of blending them
+  static lv_img_dsc_t src = lvglImage(s_opaque);
+  lv_obj_t *screen = lv_obj_create(NULL);
+  lv_obj_remove_style_all(screen);
+  lv_obj_set_style_bg_opa(screen, LV_OPA_COVER, 0);
+  lv_obj_set_style_bg_color(screen, lv_color_black(), 0);
+  lv_obj_t *img = lv_img_create(screen);
+  lv_img_set_src(img, &src);
+  lv_obj_set_pos(img, 0, IMG_Y);
+  lv_scr_load(screen);
+  lv_refr_now(NULL);
+  s_fb->waitIdle();
+
+  for (uint16_t y = 0; y < IMG_H; y++) {
+    for (uint16_t x = 0; x < WIDTH; x++) {
+      const uint8_t *p = expected(s_opaque, x, y);
+      uint16_t want = (uint16_t)(p[0] << 8 | p[1]);
+      if (s_fb->pixelAt(x, IMG_Y + y) != want) {
+        TEST_ASSERT_EQUAL_HEX16(want, s_fb->pixelAt(x, IMG_Y + y));
+        return;
+      }
+    }
+  }
+  // Rows around the image keep the screen's background
+  TEST_ASSERT_EQUAL_HEX16(0, s_fb->pixelAt(0, IMG_Y - 1));
+  TEST_ASSERT_EQUAL_HEX16(0, s_fb->pixelAt(WIDTH - 1, IMG_Y + IMG_H));
+}
+
+void setUp() {}
+void tearDown() {}
+
+int main(int argc, char **argv) {
+  s_opaque = makeImage(WIDTH, IMG_H, 2);
+  s_alpha = makeImage(WIDTH, IMG_H, 3);
+  setUpDisplay();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_full_tokens_encoded);
+  RUN_TEST(test_every_line_whole);
+  RUN_TEST(test_every_window);
+  RUN_TEST(test_outside_image_rejected);
+  RUN_TEST(test_truncated_stream_rejected);
+  RUN_TEST(test_read_line_at_band_edges);
+  RUN_TEST(test_drawn_across_bands);
+  return UNITY_END();
+}
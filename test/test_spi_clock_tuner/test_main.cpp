@@ -0,0 +1,217 @@
+// Display/SpiClockTuner: spiTuneClock() against scripted probes that fail
+// from a given step on, that fail intermittently at the step that would
+// win, and that fail at the very first step; and against SimulatedSpiProbe
+// for marginal links over many seeds.
+//
+//   pio test -e native -f test_spi_clock_tuner
+
+#include <unity.h>
+
+#include "Display/SpiClockTuner.h"
+
+// Calls per pattern set: each round tests every pattern once
+static const uint16_t SEARCH_TESTS = SPI_TUNE_ROUNDS * SPI_TUNE_PATTERN_COUNT;
+static const uint16_t CONFIRM_TESTS = 2 * SEARCH_TESTS;
+
+static const uint32_t HZ_27 = SPI_TUNE_STEPS[0];
+static const uint32_t HZ_40 = SPI_TUNE_STEPS[1];
+static const uint32_t HZ_80 = SPI_TUNE_STEPS[2];
+
+// Fails every test at failFromHz and above, and at flakyHz the tests whose
+// 0-based index at that clock is set in flakyMask. Reads back through the
+// CRC like the panel, and counts the tests made at each step.
+class ScriptedProbe {
+public:
+  uint32_t failFromHz = UINT32_MAX;
+  uint32_t flakyHz = 0;
+  uint64_t flakyMask = 0;
+  uint16_t tests[SPI_TUNE_STEP_COUNT] = {};
+  uint16_t unknownClocks = 0;
+
+  bool test(uint32_t hz, uint8_t pattern, uint32_t seed) {
+    size_t step = 0;
+    while (step < SPI_TUNE_STEP_COUNT && SPI_TUNE_STEPS[step] != hz)
+      step++;
+    if (step == SPI_TUNE_STEP_COUNT) {
+      unknownClocks++;
+      return false;
+    }
+    uint16_t n = tests[step]++;
+    bool corrupt = hz >= failFromHz ||
+                   (hz == flakyHz && n < 64 && (flakyMask >> n & 1));
+
+    uint16_t strip[SPI_TUNE_PIXELS];
+    for (uint32_t i = 0; i < SPI_TUNE_PIXELS; i++)
+      strip[i] = spiTunePixel(pattern, i, seed);
+    if (corrupt)
+      strip[(seed * 7) % SPI_TUNE_PIXELS] ^= 0x0100;
+    return spiTuneCrc(strip, SPI_TUNE_PIXELS) ==
+           spiTunePatternCrc(pattern, seed);
+  }
+};
+
+static SpiTuneResult tune(uint32_t stableHz, uint32_t flakyHz,
+                          uint8_t failPer256, uint32_t seed = 1) {
+  SimulatedSpiProbe probe(stableHz, flakyHz, failPer256, seed);
+  return spiTuneClock(probe);
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+static void test_patterns_and_crc() {
+  TEST_ASSERT_TRUE(spiTunePatternCrc(0, 0) != spiTunePatternCrc(1, 0));
+  // Random pattern differs with every seed
+  TEST_ASSERT_TRUE(spiTunePatternCrc(3, 1) != spiTunePatternCrc(3, 2));
+  const uint16_t ab[] = {0x6162};
+  TEST_ASSERT_EQUAL_UINT32(0x9E83486D, spiTuneCrc(ab, 1)); // CRC-32 of "ab"
+
+  // A single flipped bit anywhere in a strip changes the CRC
+  for (uint8_t p = 0; p < SPI_TUNE_PATTERN_COUNT; p++) {
+    uint16_t strip[SPI_TUNE_PIXELS];
+    for (uint32_t i = 0; i < SPI_TUNE_PIXELS; i++)
+      strip[i] = spiTunePixel(p, i, 5);
+    TEST_ASSERT_EQUAL_UINT32(spiTunePatternCrc(p, 5),
+                             spiTuneCrc(strip, SPI_TUNE_PIXELS));
+    for (uint32_t i = 0; i < SPI_TUNE_PIXELS; i += 17) {
+      strip[i] ^= 1u << (i % 16);
+      TEST_ASSERT_TRUE(spiTuneCrc(strip, SPI_TUNE_PIXELS) !=
+                       spiTunePatternCrc(p, 5));
+      strip[i] ^= 1u << (i % 16);
+    }
+  }
+}
+
+static void test_clean_link_runs_fastest() {
+  ScriptedProbe probe;
+  SpiTuneResult r = spiTuneClock(probe);
+  TEST_ASSERT_TRUE(r.validated);
+  TEST_ASSERT_EQUAL_UINT32(HZ_80, r.hz);
+  TEST_ASSERT_EQUAL_UINT16(0, r.failures);
+  // Every step searched, the fastest confirmed with twice the rounds
+  TEST_ASSERT_EQUAL_UINT16(SEARCH_TESTS, probe.tests[0]);
+  TEST_ASSERT_EQUAL_UINT16(SEARCH_TESTS, probe.tests[1]);
+  TEST_ASSERT_EQUAL_UINT16(SEARCH_TESTS + CONFIRM_TESTS, probe.tests[2]);
+  TEST_ASSERT_EQUAL_UINT16(3 * SEARCH_TESTS + CONFIRM_TESTS, r.tests);
+  TEST_ASSERT_EQUAL_UINT16(0, probe.unknownClocks);
+}
+
+static void test_fails_at_each_step() {
+  // Broken from step k on: settles one step below, never tries above k
+  for (size_t k = 1; k < SPI_TUNE_STEP_COUNT; k++) {
+    ScriptedProbe probe;
+    probe.failFromHz = SPI_TUNE_STEPS[k];
+    SpiTuneResult r = spiTuneClock(probe);
+    TEST_ASSERT_TRUE(r.validated);
+    TEST_ASSERT_EQUAL_UINT32(SPI_TUNE_STEPS[k - 1], r.hz);
+    // The search stops at the first failed test
+    TEST_ASSERT_EQUAL_UINT16(1, r.failures);
+    TEST_ASSERT_EQUAL_UINT16(1, probe.tests[k]);
+    for (size_t above = k + 1; above < SPI_TUNE_STEP_COUNT; above++)
+      TEST_ASSERT_EQUAL_UINT16(0, probe.tests[above]);
+    // The first step needs no confirmation, faster ones do
+    uint16_t confirm = k - 1 > 0 ? CONFIRM_TESTS : 0;
+    TEST_ASSERT_EQUAL_UINT16(SEARCH_TESTS + confirm, probe.tests[k - 1]);
+  }
+}
+
+static void test_fails_at_last_pattern_of_a_step() {
+  // Passes all but the very last search test at 80 MHz
+  ScriptedProbe probe;
+  probe.flakyHz = HZ_80;
+  probe.flakyMask = 1ull << (SEARCH_TESTS - 1);
+  SpiTuneResult r = spiTuneClock(probe);
+  TEST_ASSERT_TRUE(r.validated);
+  TEST_ASSERT_EQUAL_UINT32(HZ_40, r.hz);
+  TEST_ASSERT_EQUAL_UINT16(SEARCH_TESTS, probe.tests[2]);
+  TEST_ASSERT_EQUAL_UINT16(SEARCH_TESTS + CONFIRM_TESTS, probe.tests[1]);
+}
+
+static void test_flaky_winning_step_fails_confirmation() {
+  // 80 MHz passes the search by luck and fails once in the longer run,
+  // at its first, a middle and its last confirmation test
+  const uint16_t fails[] = {SEARCH_TESTS, SEARCH_TESTS + CONFIRM_TESTS / 2,
+                            SEARCH_TESTS + CONFIRM_TESTS - 1};
+  for (uint16_t n : fails) {
+    ScriptedProbe probe;
+    probe.flakyHz = HZ_80;
+    probe.flakyMask = 1ull << n;
+    SpiTuneResult r = spiTuneClock(probe);
+    TEST_ASSERT_TRUE(r.validated);
+    TEST_ASSERT_EQUAL_UINT32(HZ_40, r.hz);
+    TEST_ASSERT_EQUAL_UINT16(1, r.failures);
+    TEST_ASSERT_EQUAL_UINT16(n + 1, probe.tests[2]);
+    // 40 MHz then has to survive the longer run itself
+    TEST_ASSERT_EQUAL_UINT16(SEARCH_TESTS + CONFIRM_TESTS, probe.tests[1]);
+  }
+}
+
+static void test_flaky_steps_fall_back_to_first() {
+  // 40 MHz wins the search (80 is broken) but fails its confirmation: the
+  // first step is kept without a confirmation of its own
+  ScriptedProbe probe;
+  probe.failFromHz = HZ_80;
+  probe.flakyHz = HZ_40;
+  probe.flakyMask = 1ull << (SEARCH_TESTS + 3);
+  SpiTuneResult r = spiTuneClock(probe);
+  TEST_ASSERT_TRUE(r.validated);
+  TEST_ASSERT_EQUAL_UINT32(HZ_27, r.hz);
+  TEST_ASSERT_EQUAL_UINT16(2, r.failures);
+  TEST_ASSERT_EQUAL_UINT16(SEARCH_TESTS, probe.tests[0]);
+}
+
+static void test_simulated_marginal_link_settles_at_40() {
+  // Marginal at 80 MHz: every seed must end at 40 MHz, whether 80 fails in
+  // the search or only in the confirmation
+  for (uint32_t s = 1; s <= 32; s++) {
+    SpiTuneResult r = tune(HZ_40, HZ_80, 128, s);
+    TEST_ASSERT_TRUE(r.validated);
+    TEST_ASSERT_EQUAL_UINT32(HZ_40, r.hz);
+  }
+}
+
+static void test_simulated_occasional_glitches_mostly_caught() {
+  // 1 in 16 strips glitches at 80 MHz: caught by the 36 strips the search
+  // and confirmation write there for most seeds, and no seed ends below
+  // the stable clock
+  uint32_t accepted = 0;
+  for (uint32_t s = 1; s <= 32; s++) {
+    SpiTuneResult r = tune(HZ_40, HZ_80, 16, s);
+    TEST_ASSERT_TRUE(r.hz >= HZ_40);
+    accepted += r.hz == HZ_80;
+  }
+  TEST_ASSERT_TRUE(accepted < 8);
+}
+
+static void test_fails_at_first_step() {
+  // Readback broken at the design clock: nothing else is tried, and the
+  // result is not validated so the caller stays at that clock
+  ScriptedProbe probe;
+  probe.failFromHz = HZ_27;
+  SpiTuneResult r = spiTuneClock(probe);
+  TEST_ASSERT_FALSE(r.validated);
+  TEST_ASSERT_EQUAL_UINT32(HZ_27, r.hz);
+  TEST_ASSERT_EQUAL_UINT16(1, r.tests);
+  TEST_ASSERT_EQUAL_UINT16(1, r.failures);
+  TEST_ASSERT_EQUAL_UINT16(0, probe.tests[1]);
+  TEST_ASSERT_EQUAL_UINT16(0, probe.tests[2]);
+
+  SpiTuneResult sim = tune(0, 0, 0);
+  TEST_ASSERT_FALSE(sim.validated);
+  TEST_ASSERT_EQUAL_UINT32(HZ_27, sim.hz);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_patterns_and_crc);
+  RUN_TEST(test_clean_link_runs_fastest);
+  RUN_TEST(test_fails_at_each_step);
+  RUN_TEST(test_fails_at_last_pattern_of_a_step);
+  RUN_TEST(test_flaky_winning_step_fails_confirmation);
+  RUN_TEST(test_flaky_steps_fall_back_to_first);
+  RUN_TEST(test_simulated_marginal_link_settles_at_40);
+  RUN_TEST(test_simulated_occasional_glitches_mostly_caught);
+  RUN_TEST(test_fails_at_first_step);
+  return UNITY_END();
+}
@@ -0,0 +1,83 @@
+// Util/SpscRing.h under a real producer and consumer thread.
+//
+//   pio test -e native -f test_spsc_ring
+
+#include <unity.h>
+
+#include <atomic>
+#include <thread>
+
+#include "Util/SpscRing.h"
+
+// Payload of two words, so a torn copy shows up as a mismatch
+struct Item {
+  uint32_t seq;
+  uint32_t check;
+};
+
+static constexpr uint32_t ATTEMPTS = 2000000;
+
+void setUp() {}
+void tearDown() {}
+
+static void test_full_ring_drops_and_keeps_order() {
+  SpscRing<uint32_t, 8> ring;
+  for (uint32_t i = 0; i < 13; i++)
+    TEST_ASSERT_EQUAL(i < 8, ring.push(i));
+  TEST_ASSERT_EQUAL_UINT32(8, ring.pushed());
+  TEST_ASSERT_EQUAL_UINT32(5, ring.dropped());
+
+  uint32_t v = 0;
+  for (uint32_t i = 0; i < 8; i++) {
+    TEST_ASSERT_TRUE(ring.pop(v));
+    TEST_ASSERT_EQUAL_UINT32(i, v);
+  }
+  TEST_ASSERT_FALSE(ring.pop(v));
+  TEST_ASSERT_TRUE(ring.empty());
+}
+
+// The producer never waits, so whatever the consumer does not keep up
+// with is dropped; what it does get must be in order and intact
+static void test_two_threads_fifo_and_loss_accounting() {
+  static SpscRing<Item, 64> ring;
+  std::atomic<bool> done{false};
+  uint32_t accepted = 0;
+
+  std::thread producer([&] {
+    for (uint32_t i = 0; i < ATTEMPTS; i++)
+      accepted += ring.push({i, ~i});
+    done.store(true, std::memory_order_release);
+  });
+
+  uint32_t received = 0;
+  uint32_t outOfOrder = 0;
+  uint32_t torn = 0;
+  int64_t last = -1;
+  for (;;) {
+    // Read before draining: once done is seen every push is visible
+    bool finished = done.load(std::memory_order_acquire);
+    Item item;
+    while (ring.pop(item)) {
+      outOfOrder += (int64_t)item.seq <= last;
+      torn += item.check != ~item.seq;
+      last = item.seq;
+      received++;
+    }
+    if (finished)
+      break;
+  }
+  producer.join();
+
+  TEST_ASSERT_EQUAL_UINT32(0, outOfOrder);
+  TEST_ASSERT_EQUAL_UINT32(0, torn);
+  TEST_ASSERT_EQUAL_UINT32(accepted, ring.pushed());
+  TEST_ASSERT_EQUAL_UINT32(ring.pushed(), received);
+  TEST_ASSERT_EQUAL_UINT32(ATTEMPTS, ring.pushed() + ring.dropped());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_full_ring_drops_and_keeps_order);
+  RUN_TEST(test_two_threads_fifo_and_loss_accounting);
+  return UNITY_END();
+}
@@ -0,0 +1,374 @@
+"""Build the asset pack read in place from flash by src/Assets/AssetStore.cpp.
+
+The pack format is documented in src/Assets/AssetPack.h. Every SquareLine
+image export in src/ui/images/ becomes an image entry named after its
+lv_img_dsc_t symbol, stored run-length encoded (tools/rle_images.py) or,
+when that saves less than a quarter, as raw pixels LVGL reads directly.
+Every font in assets/fonts.txt is rendered from its TrueType file at the
+given pixel size into a font entry (src/Assets/FontPack.h, needs Pillow);
+fonts whose file is missing are left out with a warning.
+
+As a PlatformIO pre-build script (instead of tools/rle_images.py, with
+src/ui/images_rle/ left out of build_src_filter):
+    extra_scripts = pre:tools/asset_pack.py
+it builds $BUILD_DIR/assets.bin when out of date, compiles a descriptor
+per image whose data is the name of its pack entry in place of the image
+(generated into $BUILD_DIR/asset_images/), and adds an `uploadassets`
+target that flashes the pack to the "assets" partition of partitions.csv.
+
+By hand:
+    python tools/asset_pack.py [output.bin]    build from this project
+    python tools/asset_pack.py --list pack.bin  print and check the index
+"""
+
+import os
+import struct
+import sys
+
+try:
+    Import("env")  # noqa: F821 (PlatformIO/SCons)
+except NameError:
+    env = None
+
+# SCons runs the script without __file__
+if env is not None:
+    TOOLS_DIR = os.path.join(env.subst("$PROJECT_DIR"), "tools")
+else:
+    TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, TOOLS_DIR)
+import rle_images  # noqa: E402
+
+MAGIC = b"APK1"
+HEADER_SIZE = 16
+ENTRY_SIZE = 48
+NAME_MAX = 32
+ALIGN = 16
+
+ASSET_RAW = 0
+ASSET_IMAGE = 1
+ASSET_FONT = 2
+
+IMG_RLE = 0
+IMG_RGB565 = 1
+IMG_RGB565_ALPHA = 2
+
+FONT_MAGIC = b"FNT1"
+FONT_HEADER_SIZE = 16
+FONT_GLYPH_SIZE = 16
+FONT_BPP = 4
+
+PARTITION = "assets"
+
+
+def fnv1a(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def align(n):
+    return (n + ALIGN - 1) // ALIGN * ALIGN
+
+
+def build_pack(entries):
+    """entries: dicts with name, type, format, width, height, data."""
+    entries = sorted(entries, key=lambda e: e["name"].encode())
+    names = [e["name"] for e in entries]
+    if len(set(names)) != len(names):
+        raise ValueError("duplicate asset names")
+
+    offset = align(HEADER_SIZE + ENTRY_SIZE * len(entries))
+    index = bytearray()
+    blobs = bytearray()
+    for e in entries:
+        name = e["name"].encode()
+        if not name or len(name) >= NAME_MAX:
+            raise ValueError("bad asset name %r" % e["name"])
+        index += name.ljust(NAME_MAX, b"\0")
+        index += struct.pack("<IIBBHHH", offset + len(blobs), len(e["data"]),
+                             e["type"], e["format"], e["width"], e["height"], 0)
+        blobs += e["data"]
+        blobs += b"\0" * (align(len(blobs)) - len(blobs))
+
+    size = offset + len(blobs)
+    header = MAGIC + struct.pack("<III", len(entries), size, fnv1a(index))
+    pad = b"\0" * (offset - HEADER_SIZE - len(index))
+    return header + bytes(index) + pad + bytes(blobs)
+
+
+def read_index(pack):
+    """Returns the entries of a pack, checking it like AssetPack::open()."""
+    if pack[:4] != MAGIC:
+        raise ValueError("not an asset pack")
+    count, size, checksum = struct.unpack_from("<III", pack, 4)
+    if size > len(pack):
+        raise ValueError("pack truncated: %u of %u bytes" % (len(pack), size))
+    index = pack[HEADER_SIZE:HEADER_SIZE + count * ENTRY_SIZE]
+    if fnv1a(index) != checksum:
+        raise ValueError("index checksum mismatch")
+    entries = []
+    for i in range(count):
+        raw = index[i * ENTRY_SIZE:(i + 1) * ENTRY_SIZE]
+        name = raw[:NAME_MAX].split(b"\0")[0].decode()
+        off, length, typ, fmt, w, h, _ = struct.unpack_from("<IIBBHHH", raw, NAME_MAX)
+        if off % ALIGN or off + length > size:
+            raise ValueError("%s: bad blob %u+%u" % (name, off, length))
+        entries.append(dict(name=name, offset=off, size=length, type=typ,
+                            format=fmt, width=w, height=h))
+    if [e["name"].encode() for e in entries] != sorted(e["name"].encode() for e in entries):
+        raise ValueError("index not sorted")
+    return entries
+
+
+def image_entry(path):
+    with open(path) as f:
+        name, width, height, cf, data = rle_images.parse_c_export(f.read())
+    converted = rle_images.drop_alpha(cf, data)
+    if converted is None:
+        return None
+    bpp, px = converted
+    stream = rle_images.encode(width, height, bpp, px)
+    if len(stream) * 4 < len(px) * 3:
+        fmt, blob = IMG_RLE, stream
+    else:
+        fmt, blob = (IMG_RGB565 if bpp == 2 else IMG_RGB565_ALPHA), px
+    return dict(name=name, type=ASSET_IMAGE, format=fmt, width=width,
+                height=height, data=blob)
+
+
+def pack_glyph(px):
+    """Glyph bitmap as FontPack.h stores it: 4-bit pixels packed, or the
+    token stream when that is smaller."""
+    def packed(values):
+        out = bytearray()
+        for i in range(0, len(values), 2):
+            out.append(values[i] << 4 | (values[i + 1] if i + 1 < len(values) else 0))
+        return out
+
+    raw = packed(px)
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(packed(chunk))
+
+    i = 0
+    while i < len(px):
+        run = 1
+        while i + run < len(px) and run < 256 and px[i + run] == px[i]:
+            run += 1
+        if run >= 4:
+            flush_literal()
+            out += bytes((0x80 | px[i], run - 1))
+        else:
+            literal.extend(px[i:i + run])
+        i += run
+    flush_literal()
+    return bytes(out) if len(out) < len(raw) else bytes(raw)
+
+
+def render_font(path, size, codepoints):
+    """Returns the FontPack.h blob of a TrueType font at size pixels."""
+    from PIL import Image, ImageDraw, ImageFont  # only needed for fonts
+
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+
+    def render(ch):
+        left, top, right, bottom = font.getbbox(ch)
+        w, h = max(right - left, 0), max(bottom - top, 0)
+        img = Image.new("L", (w, h), 0)
+        if w and h:
+            ImageDraw.Draw(img).text((-left, -top), ch, font=font, fill=255)
+        return (left, top, right, bottom), img.tobytes()
+
+    # What the font draws for code points it does not have
+    notdef = render(chr(0x10FFFD))
+
+    glyphs = []
+    for cp in sorted(set(codepoints)):
+        ch = chr(cp)
+        shape = render(ch)
+        if cp != 0x20 and shape == notdef:
+            continue
+        (left, top, right, bottom), pixels_8bit = shape
+        w, h = max(right - left, 0), max(bottom - top, 0)
+        if w > 255 or h > 255:
+            continue
+        px = [v >> 4 for v in pixels_8bit]
+        glyphs.append((cp, round(font.getlength(ch)), w, h, left, ascent - bottom,
+                       pack_glyph(px)))
+
+    table_end = FONT_HEADER_SIZE + FONT_GLYPH_SIZE * len(glyphs)
+    table = bytearray()
+    bitmaps = bytearray()
+    max_bytes = 0
+    for cp, adv, w, h, ofs_x, ofs_y, bitmap in glyphs:
+        max_bytes = max(max_bytes, (w * h * FONT_BPP + 7) // 8)
+        table += struct.pack("<IIHHBBbb", cp, table_end + len(bitmaps), len(bitmap),
+                             adv, w, h, max(-128, min(127, ofs_x)),
+                             max(-128, min(127, ofs_y)))
+        bitmaps += bitmap
+    header = FONT_MAGIC + struct.pack("<HBBbBBBHH", len(glyphs), ascent + descent,
+                                      descent, -max(1, size // 10),
+                                      max(1, size // 14), FONT_BPP, 0, max_bytes, 0)
+    return header + bytes(table) + bytes(bitmaps)
+
+
+def parse_ranges(text):
+    """"0x20-0x7E,0xB7" -> list of code points."""
+    cps = []
+    for part in text.split(","):
+        lo, _, hi = part.partition("-")
+        cps.extend(range(int(lo, 0), int(hi or lo, 0) + 1))
+    return cps
+
+
+def font_manifest(project_dir):
+    """Returns (name, size, code points, path) of every assets/fonts.txt line."""
+    path = os.path.join(project_dir, "assets", "fonts.txt")
+    fonts = []
+    if not os.path.exists(path):
+        return fonts
+    with open(path) as f:
+        for line in f:
+            cols = line.split("#")[0].split()
+            if not cols:
+                continue
+            name, size, ranges, ttf = cols
+            fonts.append((name, int(size), parse_ranges(ranges),
+                          os.path.join(project_dir, ttf)))
+    return fonts
+
+
+def font_entries(project_dir):
+    entries = []
+    for name, size, cps, ttf in font_manifest(project_dir):
+        if not os.path.exists(ttf):
+            print("asset_pack: %s skipped, %s not found" % (name, ttf))
+            continue
+        blob = render_font(ttf, size, cps)
+        glyphs = struct.unpack_from("<H", blob, 4)[0]
+        print("asset_pack: %s %u px, %u glyphs, %u bytes" % (name, size, glyphs, len(blob)))
+        entries.append(dict(name=name, type=ASSET_FONT, format=0, width=0,
+                            height=size, data=blob))
+    return entries
+
+
+def image_sources(project_dir):
+    src_dir = os.path.join(project_dir, "src", "ui", "images")
+    return [os.path.join(src_dir, f) for f in sorted(os.listdir(src_dir))
+            if f.endswith(".c")]
+
+
+def build_project(project_dir, out):
+    entries = [e for e in map(image_entry, image_sources(project_dir)) if e]
+    entries += font_entries(project_dir)
+    pack = build_pack(entries)
+    os.makedirs(os.path.dirname(os.path.abspath(out)), exist_ok=True)
+    with open(out, "wb") as f:
+        f.write(pack)
+    print("asset_pack: %u assets, %u bytes -> %s" % (len(entries), len(pack), out))
+    return len(pack)
+
+
+def partition(project_dir, label=PARTITION):
+    """Returns (offset, size) of a partition in partitions.csv."""
+    with open(os.path.join(project_dir, "partitions.csv")) as f:
+        for line in f:
+            cols = [c.strip() for c in line.split("#")[0].split(",")]
+            if len(cols) >= 5 and cols[0] == label:
+                return int(cols[3], 0), int(cols[4], 0)
+    raise ValueError("no %s partition in partitions.csv" % label)
+
+
+def write_stub(path, name, width, height, source):
+    """Descriptor whose data is the name of its pack entry."""
+    with open(path, "w") as f:
+        f.write("// Generated by tools/asset_pack.py from %s, do not edit.\n" % source)
+        f.write("// %ux%u, pixels in the asset pack (see src/Assets/AssetStore.h)\n\n"
+                % (width, height))
+        f.write("#include <lvgl.h>\n\n")
+        f.write("const lv_img_dsc_t %s = {\n" % name)
+        f.write("    .header.always_zero = 0,\n")
+        f.write("    .header.w = %u,\n" % width)
+        f.write("    .header.h = %u,\n" % height)
+        f.write('    .data_size = sizeof("%s"),\n' % name)
+        f.write("    .header.cf = LV_IMG_CF_USER_ENCODED_1,\n")
+        f.write('    .data = (const uint8_t *)"%s"\n' % name)
+        f.write("};\n")
+
+
+def write_stubs(project_dir, out_dir):
+    """Stubs for the images in the pack; the others are copied unchanged."""
+    os.makedirs(out_dir, exist_ok=True)
+    for src in image_sources(project_dir):
+        fname = os.path.basename(src)
+        dst = os.path.join(out_dir, fname)
+        if os.path.exists(dst) and os.path.getmtime(dst) >= os.path.getmtime(src):
+            continue
+        with open(src) as f:
+            text = f.read()
+        name, width, height, cf, data = rle_images.parse_c_export(text)
+        if rle_images.drop_alpha(cf, data) is None:
+            with open(dst, "w") as f:
+                f.write(text)
+        else:
+            write_stub(dst, name, width, height, fname)
+
+
+def pre_build(env):
+    project_dir = env.subst("$PROJECT_DIR")
+    out = os.path.join(env.subst("$BUILD_DIR"), "assets.bin")
+    sources = image_sources(project_dir) + [os.path.join(TOOLS_DIR, "asset_pack.py")]
+    manifest = os.path.join(project_dir, "assets", "fonts.txt")
+    if os.path.exists(manifest):
+        sources.append(manifest)
+        sources += [f[3] for f in font_manifest(project_dir) if os.path.exists(f[3])]
+    if (not os.path.exists(out) or
+            max(map(os.path.getmtime, sources)) > os.path.getmtime(out)):
+        build_project(project_dir, out)
+
+    stubs = os.path.join(env.subst("$BUILD_DIR"), "asset_images")
+    write_stubs(project_dir, stubs)
+    env.BuildSources(os.path.join("$BUILD_DIR", "asset_images_obj"), stubs)
+
+    offset, size = partition(project_dir)
+    if os.path.getsize(out) > size:
+        sys.exit("asset_pack: %s is larger than the %s partition (%u bytes)"
+                 % (out, PARTITION, size))
+    env.AddCustomTarget(
+        name="uploadassets",
+        dependencies=None,
+        actions=[
+            env.VerboseAction(env.AutodetectUploadPort, "Looking for upload port..."),
+            '"$PYTHONEXE" "$UPLOADER" --chip $BOARD_MCU --port "$UPLOAD_PORT" '
+            '--baud $UPLOAD_SPEED write_flash 0x%x "%s"' % (offset, out),
+        ],
+        title="Upload assets",
+        description="Flash the asset pack to the %s partition" % PARTITION,
+    )
+
+
+def main(argv):
+    if len(argv) == 2 and argv[0] == "--list":
+        with open(argv[1], "rb") as f:
+            for e in read_index(f.read()):
+                print("%-32s type %u format %u %4ux%-4u %8u bytes at 0x%x"
+                      % (e["name"], e["type"], e["format"], e["width"], e["height"],
+                         e["size"], e["offset"]))
+    elif len(argv) <= 1:
+        build_project(os.path.dirname(TOOLS_DIR), argv[0] if argv else "assets.bin")
+    else:
+        sys.exit(__doc__)
+
+
+if env is not None:
+    pre_build(env)
+elif __name__ == "__main__":
+    main(sys.argv[1:])
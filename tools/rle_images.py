@@ -0,0 +1,209 @@
+"""Convert SquareLine image exports to the run-length encoded format decoded
+by src/Display/RleImage.cpp.
+
+Every src/ui/images/<name>.c (the LVGL C arrays SquareLine exports from the
+project's PNGs) becomes src/ui/images_rle/<name>.c defining the same
+lv_img_dsc_t, so the screens need no changes. The raw exports are left out
+of the build (build_src_filter in platformio.ini). Images that are fully
+opaque lose their alpha channel. Formats other than true color are copied
+unchanged.
+
+As a PlatformIO pre-build script it converts whatever is out of date:
+    extra_scripts = pre:tools/rle_images.py
+Builds that keep the images in the asset pack use tools/asset_pack.py
+instead.
+By hand, from a SquareLine .c export or a PNG (needs Pillow):
+    python tools/rle_images.py input.{c,png} output.c [--name symbol]
+
+Stream layout (little-endian):
+    0   "RLE1"
+    4   u16 width, u16 height
+    8   u8 bytes per pixel: 2 (RGB565) or 3 (RGB565 + alpha), 3 bytes zero
+    12  u32 offset of every line's tokens from the start of the stream
+    ... tokens; a line never continues into the next one
+Token: a control byte n, then for n < 0x80 n + 1 literal pixels, for
+n >= 0x80 one pixel repeated (n & 0x7F) + 1 times. Pixels are stored in
+the byte order of the build's lv_color_t (LV_COLOR_16_SWAP).
+"""
+
+import os
+import re
+import struct
+import sys
+
+MAGIC = b"RLE1"
+MAX_RUN = 128
+
+
+def parse_c_export(text):
+    """Returns (name, width, height, cf, data) of a SquareLine image .c."""
+    name = re.search(r"const\s+lv_img_dsc_t\s+(\w+)\s*=", text).group(1)
+    width = int(re.search(r"\.header\.w\s*=\s*(\d+)", text).group(1))
+    height = int(re.search(r"\.header\.h\s*=\s*(\d+)", text).group(1))
+    cf = re.search(r"\.header\.cf\s*=\s*(\w+)", text).group(1)
+    body = re.search(r"_data\[\]\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    data = bytes(int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", body))
+    return name, width, height, cf, data
+
+
+def load_png(path, swap=True):
+    """Returns (width, height, cf, data) of a PNG as RGB565 + alpha."""
+    from PIL import Image  # only needed for PNG input
+
+    img = Image.open(path).convert("RGBA")
+    out = bytearray()
+    for r, g, b, a in img.getdata():
+        c = (r >> 3) << 11 | (g >> 2) << 5 | b >> 3
+        out += struct.pack(">H" if swap else "<H", c)
+        out.append(a)
+    return img.width, img.height, "LV_IMG_CF_TRUE_COLOR_ALPHA", bytes(out)
+
+
+def pixels(data, bpp):
+    return [data[i:i + bpp] for i in range(0, len(data), bpp)]
+
+
+def encode_line(line):
+    out = bytearray()
+    i = 0
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(len(chunk) - 1)
+            for px in chunk:
+                out.extend(px)
+
+    while i < len(line):
+        run = 1
+        while i + run < len(line) and run < MAX_RUN and line[i + run] == line[i]:
+            run += 1
+        if run >= 2:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.extend(line[i])
+        else:
+            literal.append(line[i])
+        i += run
+    flush_literal()
+    return bytes(out)
+
+
+def encode(width, height, bpp, data):
+    px = pixels(data, bpp)
+    lines = [encode_line(px[y * width:(y + 1) * width]) for y in range(height)]
+    header = MAGIC + struct.pack("<HHB3x", width, height, bpp)
+    offset = len(header) + 4 * height
+    offsets = []
+    for line in lines:
+        offsets.append(offset)
+        offset += len(line)
+    return header + struct.pack("<%dI" % height, *offsets) + b"".join(lines)
+
+
+def drop_alpha(cf, data):
+    """Returns (bpp, pixels) with the alpha byte removed if fully opaque,
+    or None if the format is not handled."""
+    if cf == "LV_IMG_CF_TRUE_COLOR":
+        return 2, data
+    if cf == "LV_IMG_CF_TRUE_COLOR_ALPHA":
+        if all(a == 0xFF for a in data[2::3]):
+            return 2, b"".join(data[i:i + 2] for i in range(0, len(data), 3))
+        return 3, data
+    return None
+
+
+def to_rle(width, height, cf, data):
+    """Returns the RLE stream, or None if the format is not handled."""
+    converted = drop_alpha(cf, data)
+    if converted is None:
+        return None
+    bpp, px = converted
+    return encode(width, height, bpp, px)
+
+
+def write_c(path, name, width, height, stream, source):
+    rows = []
+    for i in range(0, len(stream), 24):
+        rows.append("    " + ",".join("0x%02X" % b for b in stream[i:i + 24]) + ",")
+    with open(path, "w") as f:
+        f.write("// Generated by tools/rle_images.py from %s, do not edit.\n" % source)
+        f.write("// %ux%u, %u bytes (run-length encoded, see src/Display/RleImage.h)\n\n"
+                % (width, height, len(stream)))
+        f.write('#include "../ui.h"\n\n')
+        f.write("#ifndef LV_ATTRIBUTE_MEM_ALIGN\n    #define LV_ATTRIBUTE_MEM_ALIGN\n#endif\n\n")
+        f.write("const LV_ATTRIBUTE_MEM_ALIGN uint8_t %s_data[] = {\n" % name)
+        f.write("\n".join(rows))
+        f.write("\n};\n")
+        f.write("const lv_img_dsc_t %s = {\n" % name)
+        f.write("    .header.always_zero = 0,\n")
+        f.write("    .header.w = %u,\n" % width)
+        f.write("    .header.h = %u,\n" % height)
+        f.write("    .data_size = sizeof(%s_data),\n" % name)
+        f.write("    .header.cf = LV_IMG_CF_USER_ENCODED_0,\n")
+        f.write("    .data = %s_data\n" % name)
+        f.write("};\n")
+
+
+def convert(src, dst, name=None):
+    if src.lower().endswith(".png"):
+        width, height, cf, data = load_png(src)
+        name = name or re.sub(r"\W", "_", "ui_img_" + os.path.basename(src))
+    else:
+        with open(src) as f:
+            text = f.read()
+        parsed_name, width, height, cf, data = parse_c_export(text)
+        name = name or parsed_name
+        if to_rle(width, height, cf, data) is None:
+            with open(dst, "w") as f:
+                f.write(text)
+            return None
+
+    stream = to_rle(width, height, cf, data)
+    write_c(dst, name, width, height, stream, os.path.basename(src))
+    return len(data), len(stream)
+
+
+def convert_project(project_dir):
+    src_dir = os.path.join(project_dir, "src", "ui", "images")
+    dst_dir = os.path.join(project_dir, "src", "ui", "images_rle")
+    os.makedirs(dst_dir, exist_ok=True)
+    for fname in sorted(os.listdir(src_dir)):
+        if not fname.endswith(".c"):
+            continue
+        src = os.path.join(src_dir, fname)
+        dst = os.path.join(dst_dir, fname)
+        if os.path.exists(dst) and os.path.getmtime(dst) >= os.path.getmtime(src):
+            continue
+        sizes = convert(src, dst)
+        if sizes:
+            print("rle_images: %s %u -> %u bytes" % (fname, sizes[0], sizes[1]))
+        else:
+            print("rle_images: %s copied (format not encoded)" % fname)
+
+
+def main(argv):
+    args = [a for a in argv if not a.startswith("--")]
+    sym = None
+    if "--name" in argv:
+        sym = argv[argv.index("--name") + 1]
+        args.remove(sym)
+    if len(args) == 0:
+        convert_project(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+    elif len(args) == 2:
+        print(convert(args[0], args[1], sym))
+    else:
+        sys.exit(__doc__)
+
+
+try:
+    Import("env")  # noqa: F821 (PlatformIO/SCons)
+except NameError:
+    env = None
+
+if env is not None:
+    convert_project(env.subst("$PROJECT_DIR"))
+elif __name__ == "__main__":
+    main(sys.argv[1:])